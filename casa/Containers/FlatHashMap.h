@@ -0,0 +1,150 @@
+//# FlatHashMap.h: A hash map using open addressing
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_FLATHASHMAP_H
+#define CASA_FLATHASHMAP_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // <summary>
+  // A hash map using open addressing
+  // </summary>
+  //
+  // <use visibility=export>
+  //
+  // <reviewed reviewer="" date="" tests="tFlatHashMap.cc" demos="">
+  // </reviewed>
+  //
+  // <synopsis>
+  // FlatHashMap maps keys to values like <src>std::unordered_map</src>,
+  // but keeps the keys and values in flat vectors instead of a node per
+  // entry. A key is looked up using linear probing, which usually needs
+  // a single cache line. It makes lookups several times faster, in
+  // particular for integer keys.
+  // <br>The map only supports insertion and lookup, not removal.
+  // The number of slots is a power of 2 and is doubled when the map
+  // gets more than half full.
+  // <p>
+  // The hash value given by the <src>Hash</src> functor is mixed before
+  // being used, because <src>std::hash</src> of an integer is usually the
+  // integer itself, which gives poor spreading of consecutive keys.
+  // Function <src>mix</src> can also be used by other hash tables.
+  // </synopsis>
+  //
+  // <example>
+  // <srcblock>
+  //   FlatHashMap<Int64,Int64> map;
+  //   map.insert (17, 0);
+  //   map.insert (3, 1);
+  //   const Int64* value = map.find (3);    // points to 1
+  // </srcblock>
+  // </example>
+  //
+  // <motivation>
+  // Lookups of keys like antenna or spectral window ids are done millions
+  // of times, so they should be as fast as possible.
+  // </motivation>
+  //
+  // <templating arg=K>
+  //  <li> the key type must have a default constructor and operator==.
+  // </templating>
+  // <templating arg=V>
+  //  <li> the value type must have a default constructor.
+  // </templating>
+
+  template <typename K, typename V, typename Hash=std::hash<K>>
+  class FlatHashMap {
+  public:
+    // Create an empty map with room for at least the given number of keys.
+    explicit FlatHashMap (size_t nkeys=0);
+
+    // Get the number of keys.
+    size_t size() const
+      { return size_p; }
+
+    // Is the map empty?
+    Bool empty() const
+      { return size_p == 0; }
+
+    // Remove all keys.
+    void clear();
+
+    // Make room for at least the given number of keys.
+    void reserve (size_t nkeys);
+
+    // Insert a key with its value if the key is not in the map yet.
+    // It returns a pointer to the value of the key and tells if the key
+    // was inserted. The pointer is valid until the next insert.
+    std::pair<V*,Bool> insert (const K& key, const V& value);
+
+    // Find the value of a key. A null pointer is returned if not found.
+    // <group>
+    const V* find (const K& key) const;
+    V* find (const K& key);
+    // </group>
+
+    // Mix the bits of a hash value (the finalizer of splitmix64).
+    static uInt64 mix (uInt64 hash)
+    {
+      hash ^= hash >> 30;
+      hash *= 0xbf58476d1ce4e5b9ULL;
+      hash ^= hash >> 27;
+      hash *= 0x94d049bb133111ebULL;
+      hash ^= hash >> 31;
+      return hash;
+    }
+
+  private:
+    // Find the slot of a key. If not found, it is the first free slot.
+    size_t findSlot (const K& key) const;
+
+    // Resize to the given number of slots (must be a power of 2)
+    // and reinsert all keys.
+    void rehash (size_t nslots);
+
+    //# Data
+    std::vector<K>     keys_p;
+    std::vector<V>     values_p;
+    std::vector<uChar> used_p;
+    size_t             size_p;
+    size_t             mask_p;
+    Hash               hash_p;
+  };
+
+
+} //# NAMESPACE CASACORE - END
+
+#ifndef CASACORE_NO_AUTO_TEMPLATES
+#include <casacore/casa/Containers/FlatHashMap.tcc>
+#endif //# CASACORE_NO_AUTO_TEMPLATES
+#endif
@@ -0,0 +1,133 @@
+//# FlatHashMap.tcc: A hash map using open addressing
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_FLATHASHMAP_TCC
+#define CASA_FLATHASHMAP_TCC
+
+//# Includes
+#include <casacore/casa/Containers/FlatHashMap.h>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  template <typename K, typename V, typename Hash>
+  FlatHashMap<K,V,Hash>::FlatHashMap (size_t nkeys)
+    : size_p (0),
+      mask_p (0)
+  {
+    reserve (nkeys);
+  }
+
+  template <typename K, typename V, typename Hash>
+  void FlatHashMap<K,V,Hash>::clear()
+  {
+    keys_p.clear();
+    values_p.clear();
+    used_p.clear();
+    size_p = 0;
+    mask_p = 0;
+  }
+
+  template <typename K, typename V, typename Hash>
+  void FlatHashMap<K,V,Hash>::reserve (size_t nkeys)
+  {
+    // Keep the map at most half full.
+    size_t nslots = 16;
+    while (nslots < 2*nkeys) {
+      nslots *= 2;
+    }
+    if (nslots > used_p.size()) {
+      rehash (nslots);
+    }
+  }
+
+  template <typename K, typename V, typename Hash>
+  size_t FlatHashMap<K,V,Hash>::findSlot (const K& key) const
+  {
+    size_t slot = mix(hash_p(key)) & mask_p;
+    while (used_p[slot]  &&  !(keys_p[slot] == key)) {
+      slot = (slot + 1) & mask_p;
+    }
+    return slot;
+  }
+
+  template <typename K, typename V, typename Hash>
+  std::pair<V*,Bool> FlatHashMap<K,V,Hash>::insert (const K& key,
+                                                    const V& value)
+  {
+    if (2*(size_p+1) > used_p.size()) {
+      rehash (std::max (size_t(16), 2*used_p.size()));
+    }
+    size_t slot = findSlot (key);
+    if (used_p[slot]) {
+      return std::make_pair (&values_p[slot], False);
+    }
+    keys_p[slot]   = key;
+    values_p[slot] = value;
+    used_p[slot]   = 1;
+    size_p++;
+    return std::make_pair (&values_p[slot], True);
+  }
+
+  template <typename K, typename V, typename Hash>
+  const V* FlatHashMap<K,V,Hash>::find (const K& key) const
+  {
+    if (size_p == 0) {
+      return 0;
+    }
+    size_t slot = findSlot (key);
+    return used_p[slot]  ?  &values_p[slot] : 0;
+  }
+
+  template <typename K, typename V, typename Hash>
+  V* FlatHashMap<K,V,Hash>::find (const K& key)
+  {
+    return const_cast<V*>
+      (static_cast<const FlatHashMap<K,V,Hash>*>(this)->find (key));
+  }
+
+  template <typename K, typename V, typename Hash>
+  void FlatHashMap<K,V,Hash>::rehash (size_t nslots)
+  {
+    std::vector<K>     oldKeys (nslots);
+    std::vector<V>     oldValues (nslots);
+    std::vector<uChar> oldUsed (nslots, 0);
+    oldKeys.swap (keys_p);
+    oldValues.swap (values_p);
+    oldUsed.swap (used_p);
+    mask_p = nslots - 1;
+    for (size_t i=0; i<oldUsed.size(); ++i) {
+      if (oldUsed[i]) {
+        size_t slot = findSlot (oldKeys[i]);
+        keys_p[slot]   = std::move (oldKeys[i]);
+        values_p[slot] = std::move (oldValues[i]);
+        used_p[slot]   = 1;
+      }
+    }
+  }
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
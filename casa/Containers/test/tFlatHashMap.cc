@@ -0,0 +1,97 @@
+//# tFlatHashMap.cc: Test program for class FlatHashMap
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Containers/FlatHashMap.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+
+void testInt()
+{
+  FlatHashMap<Int64,Int64> map;
+  AlwaysAssertExit (map.empty());
+  AlwaysAssertExit (map.find(0) == 0);
+  // Insert many keys, so the map is resized several times.
+  // Use keys with a large stride as well as consecutive keys.
+  for (Int64 i=0; i<10000; ++i) {
+    std::pair<Int64*,Bool> res = map.insert (i*1024, i);
+    AlwaysAssertExit (res.second  &&  *res.first == i);
+  }
+  for (Int64 i=0; i<1000; ++i) {
+    map.insert (-i-1, 10000+i);
+  }
+  AlwaysAssertExit (map.size() == 11000);
+  // An existing key is not overwritten.
+  std::pair<Int64*,Bool> res = map.insert (2048, -5);
+  AlwaysAssertExit (!res.second  &&  *res.first == 2);
+  AlwaysAssertExit (map.size() == 11000);
+  for (Int64 i=0; i<10000; ++i) {
+    const Int64* value = map.find (i*1024);
+    AlwaysAssertExit (value  &&  *value == i);
+    AlwaysAssertExit (map.find(i*1024 + 1) == 0);
+  }
+  for (Int64 i=0; i<1000; ++i) {
+    AlwaysAssertExit (*map.find(-i-1) == 10000+i);
+  }
+  // A value can be changed.
+  *map.find(1024) = 77;
+  AlwaysAssertExit (*map.find(1024) == 77);
+  map.clear();
+  AlwaysAssertExit (map.empty()  &&  map.find(1024) == 0);
+  map.insert (1024, 3);
+  AlwaysAssertExit (*map.find(1024) == 3);
+}
+
+void testString()
+{
+  FlatHashMap<String,Int> map(5);
+  for (Int i=0; i<500; ++i) {
+    map.insert ("key" + String::toString(i), i);
+  }
+  AlwaysAssertExit (map.size() == 500);
+  for (Int i=0; i<500; ++i) {
+    AlwaysAssertExit (*map.find("key" + String::toString(i)) == i);
+  }
+  AlwaysAssertExit (map.find("key500") == 0);
+  AlwaysAssertExit (map.find("") == 0);
+}
+
+int main()
+{
+  try {
+    testInt();
+    testString();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  cout << "OK" << endl;
+  return 0;
+}
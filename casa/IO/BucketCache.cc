@@ -26,8 +26,12 @@
 
 //# Includes
 #include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketCacheIO.h>
+#include <casacore/casa/IO/BucketCacheBudget.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -56,11 +60,16 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
   its_SlotNr        (nrOfBuckets, Int(-1)),
   its_BucketNr      (cacheSize, uInt(0)),
   its_Dirty         (cacheSize, uInt(0)),
-  its_LRU           (cacheSize, uInt(0)),
-  its_LRUCounter    (0),
+  its_LRU           (cacheSize, uInt64(0)),
+  its_LastAccess    (0),
+  its_NrToRelease   (0),
+  its_KeepBuckets   (False),
   its_Buffer        (0),
   its_NrOfFree      (0),
-  its_FirstFree     (-1)
+  its_FirstFree     (-1),
+  its_NrPrefetch    (0),
+  its_LastBucketNr  (-2),
+  its_BatchNext     (0)
 {
     initStatistics();
     // The bucketsize must be set.
@@ -87,6 +96,16 @@ BucketCache::BucketCache (BucketFile* file, Int64 startOffset,
 	    its_CurNrOfBuckets = its_NewNrOfBuckets;
 	}
     }
+    // Use asynchronous IO if defined in the aipsrc file.
+    uInt nthreads, nprefetch, maxQueue;
+    AipsrcValue<uInt>::find (nthreads, "bucketcache.async.nthreads", 0);
+    if (nthreads > 0) {
+        AipsrcValue<uInt>::find (nprefetch, "bucketcache.async.prefetch", 4);
+        AipsrcValue<uInt>::find (maxQueue, "bucketcache.async.maxqueue", 16);
+        setAsyncIO (nthreads, nprefetch, maxQueue);
+    }
+    // Take part in the process-wide memory budget.
+    BucketCacheBudget::registerCache (this);
 }
 
 BucketCache::~BucketCache()
@@ -94,10 +113,45 @@ BucketCache::~BucketCache()
     // Clear the entire cache.
     // It is not flushed (that should have been done before).
     // In that way no needless flushes are done for a temporary table.
+    // Outstanding writes are finished; errors cannot be reported anymore.
+    try {
+        waitAsyncIO();
+    } catch (const std::exception&) {
+    }
     clear (0, False);
+    BucketCacheBudget::unregisterCache (this);
+    its_AsyncIO.reset();
     delete [] its_Buffer;
 }
 
+Bool BucketCache::setAsyncIO (uInt nthreads, uInt nprefetch, uInt maxQueue)
+{
+    // Finish the outstanding IO of the current IO object.
+    waitAsyncIO();
+    its_AsyncIO.reset();
+    its_NrPrefetch = 0;
+    its_Batch.clear();
+    its_BatchNext = 0;
+    if (nthreads == 0) {
+        return True;
+    }
+    // Positional IO is not possible for a MultiFile or buffered file.
+    if (its_file->isMultiFile()  ||  its_file->isBuffered()) {
+        return False;
+    }
+    its_AsyncIO.reset (new BucketCacheIO (its_file, its_BucketSize,
+                                          nthreads, maxQueue));
+    its_NrPrefetch = nprefetch;
+    return True;
+}
+
+void BucketCache::waitAsyncIO()
+{
+    if (its_AsyncIO) {
+        its_AsyncIO->wait();
+    }
+}
+
 void BucketCache::clear (uInt fromSlot, Bool doFlush)
 {
     if (doFlush) {
@@ -109,10 +163,17 @@ void BucketCache::clear (uInt fromSlot, Bool doFlush)
 	its_SlotNr[its_BucketNr[i]] = -1;
     }
     if (fromSlot == 0) {
-	its_LRUCounter = 0;
 	initStatistics();
+        if (its_AsyncIO) {
+            // Make sure that data will be reread from the file.
+            its_AsyncIO->wait();
+            its_AsyncIO->discardPrefetched();
+            its_Batch.clear();
+            its_BatchNext = 0;
+        }
     }
     if (fromSlot < its_CacheSizeUsed) {
+        BucketCacheBudget::release (this, its_CacheSizeUsed - fromSlot);
 	its_CacheSizeUsed = fromSlot;
     }
 }
@@ -130,6 +191,8 @@ Bool BucketCache::flush (uInt fromSlot)
 	    hasWritten = True;
 	}
     }
+    // Wait until the data are written.
+    waitAsyncIO();
     return hasWritten;
 }
 
@@ -193,14 +256,11 @@ void BucketCache::setDirty()
 
 void BucketCache::setLRU()
 {
-    // When the LRU counter would wrap, clear all LRU info in the cache.
-    if (its_LRUCounter == 4294967295u) {
-	its_LRUCounter = 0;
-	for (uInt i=0; i<its_CacheSizeUsed; i++) {
-	    its_LRU[i] = 0;
-	}
-    }
-    its_LRU[its_ActualSlot] = ++its_LRUCounter;
+    // Use the global counter, so the least recently used buckets of
+    // all caches can be found.
+    uInt64 tick = BucketCacheBudget::tick();
+    its_LRU[its_ActualSlot] = tick;
+    its_LastAccess.store (tick, std::memory_order_relaxed);
 }
 
 char* BucketCache::getBucket (uInt bucketNr)
@@ -209,6 +269,20 @@ char* BucketCache::getBucket (uInt bucketNr)
 	throw (indexError<Int> (bucketNr));
     }
     naccess_p++;
+    // Release slots if asked to do so to meet the memory budget.
+    if (its_NrToRelease.load (std::memory_order_relaxed) > 0
+    &&  !its_KeepBuckets) {
+        releaseForBudget();
+    }
+    // Continue scheduling a batch or read ahead in case of sequential access.
+    if (its_AsyncIO) {
+        if (its_BatchNext < its_Batch.size()) {
+            submitBatch();
+        } else if (Int64(bucketNr) == its_LastBucketNr + 1) {
+            prefetchBuckets (bucketNr);
+        }
+        its_LastBucketNr = bucketNr;
+    }
     // Test if it is already in the cache.
     if (its_SlotNr[bucketNr] >= 0) {
 	its_ActualSlot = its_SlotNr[bucketNr];
@@ -254,6 +328,9 @@ uInt BucketCache::addBucket (char* data)
     if (its_FirstFree >= 0) {
 	// There is a free list, so get the first bucket from it.
 	bucketNr = its_FirstFree;
+        if (its_AsyncIO) {
+            its_AsyncIO->waitBucket (bucketNr);
+        }
 	its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
 	its_file->read (its_Buffer,
 		   CanonicalConversion::canonicalSize (static_cast<Int*>(0)));
@@ -281,6 +358,9 @@ void BucketCache::removeBucket()
     // Thus store the bucket nr of the first free in this bucket
     // and make this bucket the first free.
     uInt bucketNr = its_BucketNr[its_ActualSlot];
+    if (its_AsyncIO) {
+        its_AsyncIO->waitBucket (bucketNr);
+    }
     CanonicalConversion::fromLocal (its_Buffer, its_FirstFree);
     its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
     its_file->write (its_Buffer, its_BucketSize);
@@ -321,11 +401,15 @@ void BucketCache::checkOffset (uInt length, Int64 offset) const
 
 void BucketCache::getSlot (uInt bucketNr)
 {
-    if (its_CacheSizeUsed < its_CacheSize) {
+    // A new slot can only be used if the memory budget allows it
+    // (or if the buckets have to be kept).
+    // Otherwise the least recently used slot is reused.
+    if (its_CacheSizeUsed < its_CacheSize
+    &&  BucketCacheBudget::acquire (this, its_KeepBuckets)) {
 	its_ActualSlot = its_CacheSizeUsed++;
     }else{
 	its_ActualSlot = 0;
-	uInt least = its_LRU[0];
+	uInt64 least = its_LRU[0];
 	for (uInt i=1; i<its_CacheSizeUsed; i++) {
 	    if (its_LRU[i] < least) {
 		least = its_LRU[i];
@@ -347,25 +431,151 @@ void BucketCache::getSlot (uInt bucketNr)
 }
 
 
+Int BucketCache::lruSlot (uInt64& lru) const
+{
+    Int slotNr = -1;
+    for (uInt i=0; i<its_CacheSizeUsed; i++) {
+        if (i != its_ActualSlot  &&  (slotNr < 0  ||  its_LRU[i] < lru)) {
+            slotNr = i;
+            lru    = its_LRU[i];
+        }
+    }
+    return slotNr;
+}
+
+void BucketCache::setKeepBuckets (Bool keep)
+{
+    if (keep  &&  its_NrToRelease.load (std::memory_order_relaxed) > 0) {
+        releaseForBudget();
+    }
+    its_KeepBuckets = keep;
+}
+
+void BucketCache::releaseForBudget()
+{
+    uInt nr = its_NrToRelease.exchange (0, std::memory_order_relaxed);
+    for (uInt i=0; i<nr; i++) {
+        uInt64 lru;
+        Int slotNr = lruSlot (lru);
+        if (slotNr < 0) {
+            break;
+        }
+        releaseSlot (slotNr);
+    }
+}
+
+void BucketCache::releaseSlot (uInt slotNr)
+{
+    if (its_Dirty[slotNr]) {
+        writeBucket (slotNr);
+    }
+    if (its_Cache[slotNr] != 0) {
+        its_DeleteCallBack (its_Owner, its_Cache[slotNr]);
+        its_SlotNr[its_BucketNr[slotNr]] = -1;
+    }
+    // Move the last used slot to the freed slot to keep the used
+    // slots contiguous.
+    uInt lastSlot = its_CacheSizeUsed - 1;
+    if (slotNr != lastSlot) {
+        its_Cache[slotNr]    = its_Cache[lastSlot];
+        its_BucketNr[slotNr] = its_BucketNr[lastSlot];
+        its_Dirty[slotNr]    = its_Dirty[lastSlot];
+        its_LRU[slotNr]      = its_LRU[lastSlot];
+        if (its_Cache[slotNr] != 0) {
+            its_SlotNr[its_BucketNr[slotNr]] = slotNr;
+        }
+        if (its_ActualSlot == lastSlot) {
+            its_ActualSlot = slotNr;
+        }
+    }
+    its_Cache[lastSlot] = 0;
+    its_Dirty[lastSlot] = 0;
+    its_LRU[lastSlot]   = 0;
+    its_CacheSizeUsed   = lastSlot;
+    nevict_p++;
+    BucketCacheBudget::release (this, 1, True);
+}
+
+
 void BucketCache::writeBucket (uInt slotNr)
 {
 ///    cout << "write " << its_BucketNr[slotNr] << " " << slotNr;
     its_WriteCallBack (its_Owner, its_Buffer, its_Cache[slotNr]);
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->write (its_Buffer, its_BucketSize);
+    Int64 offset = its_StartOffset + Int64(its_BucketNr[slotNr]) * its_BucketSize;
+    if (its_AsyncIO) {
+        // The data are copied, so its_Buffer can be reused immediately.
+        its_AsyncIO->write (its_BucketNr[slotNr], offset, its_Buffer);
+    } else {
+        its_file->seek (offset);
+        its_file->write (its_Buffer, its_BucketSize);
+    }
     its_Dirty[slotNr] = 0;
     nwrite_p++;
 }
 void BucketCache::readBucket (uInt slotNr)
 {
 ///    cout << "read " << its_BucketNr[slotNr] << " " << slotNr;
-    its_file->seek (its_StartOffset +
-		    Int64(its_BucketNr[slotNr]) * its_BucketSize);
-    its_file->read (its_Buffer, its_BucketSize);
+    uInt bucketNr = its_BucketNr[slotNr];
+    // Use the prefetched data if available. Otherwise wait for a possible
+    // outstanding write of the bucket before reading it.
+    if (!its_AsyncIO  ||  !its_AsyncIO->takePrefetched (bucketNr, its_Buffer)) {
+        if (its_AsyncIO) {
+            its_AsyncIO->waitBucket (bucketNr);
+        }
+        its_file->seek (its_StartOffset + Int64(bucketNr) * its_BucketSize);
+        its_file->read (its_Buffer, its_BucketSize);
+    }
     its_Cache[slotNr] = its_ReadCallBack (its_Owner, its_Buffer);
     nread_p++;
 }
+void BucketCache::prefetchBuckets (uInt bucketNr)
+{
+    // Only buckets existing in the file can be read.
+    uInt endNr = std::min (bucketNr + its_NrPrefetch + 1, its_CurNrOfBuckets);
+    for (uInt i=bucketNr+1; i<endNr; i++) {
+        if (its_SlotNr[i] < 0) {
+            // Stop if the queue is full.
+            if (! its_AsyncIO->prefetch (i, its_StartOffset +
+                                            Int64(i) * its_BucketSize)) {
+                break;
+            }
+        }
+    }
+}
+
+void BucketCache::prefetch (const std::vector<uInt>& bucketNrs)
+{
+    if (! its_AsyncIO) {
+        return;
+    }
+    // Remove the buckets still prefetched for a previous batch.
+    its_AsyncIO->discardPrefetched();
+    its_Batch.clear();
+    its_BatchNext = 0;
+    its_Batch.reserve (bucketNrs.size());
+    for (uInt bucketNr : bucketNrs) {
+        if (bucketNr < its_CurNrOfBuckets  &&  its_SlotNr[bucketNr] < 0) {
+            its_Batch.push_back (bucketNr);
+        }
+    }
+    submitBatch();
+}
+
+void BucketCache::submitBatch()
+{
+    while (its_BatchNext < its_Batch.size()) {
+        uInt bucketNr = its_Batch[its_BatchNext];
+        // Stop if the queue is full.
+        if (! its_AsyncIO->prefetch (bucketNr, its_StartOffset +
+                                     Int64(bucketNr) * its_BucketSize)) {
+            return;
+        }
+        its_BatchNext++;
+    }
+    its_Batch.clear();
+    its_BatchNext = 0;
+}
+
 void BucketCache::initializeBuckets (uInt bucketNr)
 {
     // Initialize this bucket and all uninitialized ones before it.
@@ -401,6 +611,16 @@ void BucketCache::showStatistics (ostream& os) const
     if (nwrite_p > 0) {
 	os << "#writes:   " << nwrite_p << endl;
     }
+    if (nevict_p > 0) {
+	os << "#evicted:  " << nevict_p << endl;
+    }
+    if (its_AsyncIO) {
+        os << "#asyncthr: " << its_AsyncIO->nthreads() << endl;
+        os << "#prefetch: " << its_AsyncIO->nprefetch()
+           << "         used: " << its_AsyncIO->nprefetchUsed() << endl;
+        os << "#asyncwr:  " << its_AsyncIO->nwrite()
+           << "         queue-waits: " << its_AsyncIO->nqueueWait() << endl;
+    }
     os << "#accesses: " << naccess_p;
     if (naccess_p > 0) {
 	os << "        hit-rate:  "
@@ -416,6 +636,15 @@ void BucketCache::initStatistics()
     nread_p   = 0;
     ninit_p   = 0;
     nwrite_p  = 0;
+    nevict_p  = 0;
+    if (its_AsyncIO) {
+        its_AsyncIO->initStatistics();
+    }
+}
+
+uInt BucketCache::nPrefetchUsed() const
+{
+    return (its_AsyncIO  ?  its_AsyncIO->nprefetchUsed() : 0);
 }
 
 } //# NAMESPACE CASACORE - END
@@ -31,6 +31,8 @@
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
+#include <atomic>
+#include <memory>
 #include <vector>
 
 //# Forward clarations
@@ -39,6 +41,9 @@
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
+//# Forward declarations
+class BucketCacheIO;
+
 // <summary>
 // Define the type of the static read and write function.
 // </summary>
@@ -142,6 +147,40 @@ typedef void (*BucketCacheDeleteBuffer) (void* ownerObject, char* buffer);
 // <p>
 // Statistics are kept to know how efficient the cache is working.
 // It is possible to initialize and show the statistics.
+// <p>
+// Optionally the file IO can be done asynchronously by a small pool of
+// IO threads (see class <linkto class=BucketCacheIO>BucketCacheIO</linkto>).
+// It can be enabled using the function <src>setAsyncIO</src> or, for all
+// BucketCache objects, using the aipsrc variables
+// <src>bucketcache.async.nthreads</src> (default 0, i.e. synchronous IO),
+// <src>bucketcache.async.prefetch</src> (default 4) and
+// <src>bucketcache.async.maxqueue</src> (default 16).
+// In asynchronous mode:
+// <ul>
+//  <li> When <src>getBucket</src> detects sequential access (i.e. a bucket
+//       following the previously accessed bucket), the next buckets
+//       (not in the cache yet) are read in the background.
+//  <li> A dirty bucket removed from the cache is written in the background.
+//       Function <src>flush</src> waits until all writes are done.
+//  <li> Function <src>prefetch</src> can be used to schedule the reads of
+//       an arbitrary list of buckets as a single batch. The IO threads
+//       read them in parallel, so the file system gets many requests at
+//       the same time. It is useful if the caller knows which buckets it
+//       will access (e.g. the tiles of a slice in a tiled hypercube).
+//       The part of the batch not fitting in the queue is scheduled when
+//       buckets of the batch are accessed.
+// </ul>
+// The conversion callback functions are always called in the caller's
+// thread, so they do not need to be thread-safe.
+// Asynchronous IO cannot be used for a file in a MultiFileBase.
+// <p>
+// All BucketCache objects in a process register themselves in
+// <linkto class=BucketCacheBudget>BucketCacheBudget</linkto>, which can
+// limit the total memory used by the caches. If a budget is set and
+// exceeded, a cache needing a new slot reuses one of its own slots and
+// asks the least recently used other caches to release a slot.
+// A cache does that itself on its next access, so it is always done by
+// the thread using the cache.
 // </synopsis> 
 
 // <motivation>
@@ -275,6 +314,15 @@ public:
     // A pointer to the data in converted format is returned.
     char* getBucket (uInt bucketNr);
 
+    // Keep all buckets gotten hereafter in the cache until called with
+    // False, so the pointers returned by <src>getBucket</src> stay valid
+    // (e.g., to copy the data of several buckets in parallel).
+    // Meanwhile new slots are used regardless of the memory budget and
+    // no slots are released for it. Slots asked for by the budget are
+    // released when switching it on. The number of different buckets
+    // gotten must not exceed the cache size.
+    void setKeepBuckets (Bool keep);
+
     // Extend the file with the given number of buckets.
     // The buckets get initialized when they are acquired
     // (using getBucket) for the first time.
@@ -312,13 +360,51 @@ public:
     // Get the number of free buckets.
     uInt nFreeBucket() const;
 
+    // Enable asynchronous IO using the given number of IO threads.
+    // When sequential access is detected, the next <src>nprefetch</src>
+    // buckets are read in the background. At most <src>maxQueue</src>
+    // buckets can be outstanding.
+    // A zero number of threads disables asynchronous IO (after waiting for
+    // the outstanding writes to finish).
+    // It returns False if asynchronous IO cannot be used for the file.
+    Bool setAsyncIO (uInt nthreads, uInt nprefetch=4, uInt maxQueue=16);
+
+    // Is asynchronous IO used?
+    Bool isAsyncIO() const;
+
+    // Schedule the asynchronous read of the given buckets as a single batch.
+    // The buckets are read in the given order; buckets already in the cache
+    // or not in the file yet are skipped. A previous batch is discarded.
+    // Nothing is done if asynchronous IO is not used.
+    void prefetch (const std::vector<uInt>& bucketNrs);
+
     // (Re)initialize the cache statistics.
     void initStatistics();
 
     // Show the statistics.
     void showStatistics (ostream& os) const;
 
+    // Get the number of bucket accesses and the number of buckets read
+    // from the file since the statistics were initialized.
+    // <group>
+    uInt nAccess() const
+      { return naccess_p; }
+    uInt nRead() const
+      { return nread_p; }
+    // </group>
+
+    // Get the number of buckets read using asynchronous read-ahead
+    // since the statistics were initialized (0 for synchronous IO).
+    uInt nPrefetchUsed() const;
+
+    // Get the size of a bucket (in bytes).
+    uInt bucketSize() const
+      { return its_BucketSize; }
+
 private:
+    // BucketCacheBudget can ask the cache to release buckets.
+    friend class BucketCacheBudget;
+
     // The file used.
     BucketFile* its_file;
     // The owner object.
@@ -353,10 +439,16 @@ private:
     std::vector<uInt>  its_BucketNr;
     // Determine if a block is dirty (i.e. changed) (1=dirty).
     std::vector<uInt>  its_Dirty;
-    // Determine when a block is used for the last time.
-    std::vector<uInt>  its_LRU;
-    // The Least Recently Used counter.
-    uInt         its_LRUCounter;
+    // Determine when a block is used for the last time
+    // (using the global counter of BucketCacheBudget).
+    std::vector<uInt64> its_LRU;
+    // The value of the global counter when the cache was accessed last.
+    std::atomic<uInt64> its_LastAccess;
+    // The number of slots to release on the next access (as requested
+    // by BucketCacheBudget).
+    std::atomic<uInt> its_NrToRelease;
+    // Keep the buckets gotten in the cache (see setKeepBuckets)?
+    Bool its_KeepBuckets;
     // The internal buffer.
     char*        its_Buffer;
     // The number of free buckets.
@@ -368,6 +460,16 @@ private:
     uInt nread_p;
     uInt ninit_p;
     uInt nwrite_p;
+    uInt nevict_p;
+    // The asynchronous IO object (null is synchronous IO).
+    std::unique_ptr<BucketCacheIO> its_AsyncIO;
+    // The number of buckets to read ahead for asynchronous IO.
+    uInt its_NrPrefetch;
+    // The last bucket accessed (to detect sequential access).
+    Int64 its_LastBucketNr;
+    // The batch of buckets to prefetch and the next one to schedule.
+    std::vector<uInt> its_Batch;
+    size_t its_BatchNext;
 
 
     // Copy constructor is not possible.
@@ -388,6 +490,16 @@ private:
     // Read a bucket.
     void readBucket (uInt slotNr);
 
+    // Schedule the read of the buckets following the given bucket
+    // (if not in the cache yet).
+    void prefetchBuckets (uInt bucketNr);
+
+    // Schedule the reads of the batch as far as the queue allows.
+    void submitBatch();
+
+    // Wait until the outstanding asynchronous writes are done.
+    void waitAsyncIO();
+
     // Initialize the bucket buffer.
     // The uninitialized buckets before this bucket are also initialized.
     // It returns a pointer to the buffer.
@@ -395,6 +507,17 @@ private:
 
     // Check if the offset of a non-cached part is correct.
     void checkOffset (uInt length, Int64 offset) const;
+
+    // Release the slots requested by BucketCacheBudget.
+    void releaseForBudget();
+
+    // Get the least recently used slot and its access counter, ignoring
+    // the current slot. It returns -1 if there is no such slot.
+    Int lruSlot (uInt64& lru) const;
+
+    // Remove the bucket in the given slot from the cache (to meet the
+    // budget). It is written first if dirty.
+    void releaseSlot (uInt slotNr);
 };
 
 
@@ -408,6 +531,9 @@ inline Int BucketCache::firstFreeBucket() const
 inline uInt BucketCache::nFreeBucket() const
     { return its_NrOfFree; }
 
+inline Bool BucketCache::isAsyncIO() const
+    { return its_AsyncIO != nullptr; }
+
 
 
 
@@ -0,0 +1,186 @@
+//# BucketCacheBudget.cc: Process-wide memory budget for all bucket caches
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+//# Includes
+#include <casacore/casa/IO/BucketCacheBudget.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+std::atomic<uInt64> BucketCacheBudget::theirTick (0);
+
+namespace {
+    // The state of the budget. It is created on first use to avoid
+    // problems with the order of static initialization.
+    struct BudgetState
+    {
+        BudgetState()
+            : budget (0), used (0), nevicted (0)
+        {
+            uInt mib;
+            AipsrcValue<uInt>::find (mib, "bucketcache.budget", 0);
+            budget = Int64(mib) * 1024 * 1024;
+        }
+        std::mutex             mutex;
+        // The registered caches and the number of slots used by them.
+        std::map<BucketCache*,uInt> caches;
+        Int64                  budget;
+        Int64                  used;
+        uInt64                 nevicted;
+    };
+
+    BudgetState& budgetState()
+    {
+        static BudgetState state;
+        return state;
+    }
+}
+
+
+void BucketCacheBudget::setBudget (Int64 nbytes)
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    st.budget = (nbytes < 0  ?  0 : nbytes);
+}
+
+Int64 BucketCacheBudget::budget()
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    return st.budget;
+}
+
+Int64 BucketCacheBudget::usedSize()
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    return st.used;
+}
+
+uInt BucketCacheBudget::nrCaches()
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    return st.caches.size();
+}
+
+uInt64 BucketCacheBudget::nrEvicted()
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    return st.nevicted;
+}
+
+void BucketCacheBudget::showStatistics (ostream& os)
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    os << "budget:    " << st.budget << endl;
+    os << "used:      " << st.used << endl;
+    os << "#caches:   " << st.caches.size() << endl;
+    os << "#evicted:  " << st.nevicted << endl;
+}
+
+void BucketCacheBudget::registerCache (BucketCache* cache)
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    st.caches[cache] = 0;
+}
+
+void BucketCacheBudget::unregisterCache (BucketCache* cache)
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    st.caches.erase (cache);
+}
+
+void BucketCacheBudget::release (BucketCache* cache, uInt nslots,
+                                 Bool evicted)
+{
+    BudgetState& st = budgetState();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    st.used -= Int64(nslots) * cache->bucketSize();
+    std::map<BucketCache*,uInt>::iterator iter = st.caches.find (cache);
+    if (iter != st.caches.end()) {
+        iter->second -= std::min (nslots, iter->second);
+    }
+    if (evicted) {
+        st.nevicted += nslots;
+    }
+}
+
+Bool BucketCacheBudget::acquire (BucketCache* cache, Bool force)
+{
+    BudgetState& st = budgetState();
+    uInt bucketSize = cache->bucketSize();
+    std::lock_guard<std::mutex> lock(st.mutex);
+    std::map<BucketCache*,uInt>::iterator iter = st.caches.find (cache);
+    // A cache always gets its first slot.
+    if (st.budget == 0  ||  st.used + bucketSize <= st.budget
+    ||  iter == st.caches.end()  ||  iter->second == 0) {
+        st.used += bucketSize;
+        if (iter != st.caches.end()) {
+            iter->second++;
+        }
+        return True;
+    }
+    // Ask the least recently used other cache that can spare a slot
+    // (besides the slots already asked for) to release one.
+    // Only the thread using a cache can do that, so it is done by the
+    // cache itself on its next access.
+    BucketCache* victim = 0;
+    uInt64 least = 0;
+    for (const std::pair<BucketCache* const,uInt>& cp : st.caches) {
+        if (cp.first != cache) {
+            uInt nrel = cp.first->its_NrToRelease.load
+                                          (std::memory_order_relaxed);
+            uInt64 last = cp.first->its_LastAccess.load
+                                          (std::memory_order_relaxed);
+            if (cp.second > nrel + 1  &&  (victim == 0  ||  last < least)) {
+                victim = cp.first;
+                least  = last;
+            }
+        }
+    }
+    if (victim) {
+        victim->its_NrToRelease.fetch_add (1, std::memory_order_relaxed);
+    }
+    if (force) {
+        st.used += bucketSize;
+        iter->second++;
+    }
+    return force;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,160 @@
+//# BucketCacheBudget.h: Process-wide memory budget for all bucket caches
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_BUCKETCACHEBUDGET_H
+#define CASA_BUCKETCACHEBUDGET_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/iosfwd.h>
+#include <atomic>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class BucketCache;
+
+
+// <summary>
+// Process-wide memory budget for all bucket caches
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tBucketCacheBudget" demos="">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Each <linkto class=BucketCache>BucketCache</linkto> object (as used by
+// the standard, incremental and tiled storage managers) is sized
+// independently, so a process having many tables open can use a lot of
+// memory for its caches. BucketCacheBudget keeps track of the memory used
+// by all BucketCache objects in a process and limits it to a budget.
+// <p>
+// All BucketCache objects register themselves. When a cache needs a new
+// slot while the budget is exceeded, it reuses its own least recently used
+// slot instead. Furthermore, the least recently used other cache is asked
+// to release a slot. For this purpose all caches use a global access
+// counter to keep track of the least recently used caches and buckets.
+// <br>A BucketCache is not thread-safe, so another cache cannot be
+// reduced by the thread needing the slot. Instead, a cache releases the
+// slots asked for on its next access, thus by the thread using it.
+// It removes its least recently used buckets (after writing them if
+// changed), but never its current bucket (i.e. the last one returned by
+// <src>getBucket</src>).
+// <br>A cache can be told to keep the buckets gotten (see
+// <src>BucketCache::setKeepBuckets</src>), for instance while the data of
+// several tiles are copied in parallel. Meanwhile it uses new slots
+// regardless of the budget and does not release slots for it.
+// <p>
+// Thus the budget is a soft limit. A cache always gets its first slot,
+// and the memory of a cache that is not accessed anymore is only
+// released when the cache is cleared or deleted.
+// <p>
+// The memory used by a cache is estimated as the number of buckets in it
+// times the bucket size.
+// <br>The default budget is defined by the aipsrc variable
+// <src>bucketcache.budget</src> (in MiB). The default is 0, which means
+// that the caches are not limited.
+// </synopsis>
+
+// <motivation>
+// Running many pipelines in a single process, each accessing several
+// tables, should not lead to excessive memory usage, while the caches of
+// the tables being accessed actively should still be as large as needed.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  // Limit the memory used by all bucket caches to 256 MiB.
+//  BucketCacheBudget::setBudget (256*1024*1024);
+//  ...
+//  cout << BucketCacheBudget::usedSize() << " bytes used in "
+//       << BucketCacheBudget::nrCaches() << " caches" << endl;
+// </srcblock>
+// </example>
+
+class BucketCacheBudget
+{
+public:
+    // Set the budget (in bytes) for all bucket caches in the process.
+    // A value of 0 means no limit.
+    // The caches are not reduced immediately, but only when a cache
+    // needs a new slot.
+    static void setBudget (Int64 nbytes);
+
+    // Get the budget (in bytes). 0 means no limit.
+    static Int64 budget();
+
+    // Get the memory (in bytes) used by all caches.
+    static Int64 usedSize();
+
+    // Get the number of registered caches.
+    static uInt nrCaches();
+
+    // Get the number of buckets removed because of the budget.
+    static uInt64 nrEvicted();
+
+    // Show the budget and usage.
+    static void showStatistics (ostream& os);
+
+    // Get the next value of the global access counter.
+    static uInt64 tick()
+      { return theirTick.fetch_add (1, std::memory_order_relaxed) + 1; }
+
+    // Register or unregister a cache.
+    // <group>
+    static void registerCache (BucketCache* cache);
+    static void unregisterCache (BucketCache* cache);
+    // </group>
+
+    // Account for a new slot in the given cache.
+    // If the budget would be exceeded, the least recently used other
+    // cache is asked to release a slot on its next access. Furthermore
+    // False is returned, unless <src>force=True</src>; the cache should
+    // then reuse one of its slots.
+    static Bool acquire (BucketCache* cache, Bool force = False);
+
+    // Account for the given number of slots released by a cache.
+    // <src>evicted=True</src> means that they were released to meet
+    // the budget.
+    static void release (BucketCache* cache, uInt nslots,
+                         Bool evicted = False);
+
+private:
+    // The global access counter.
+    static std::atomic<uInt64> theirTick;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
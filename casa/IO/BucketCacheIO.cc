@@ -0,0 +1,263 @@
+//# BucketCacheIO.cc: Asynchronous read-ahead and write-behind for BucketCache
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/BucketCacheIO.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
+#include <cstring>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+BucketCacheIO::BucketCacheIO (BucketFile* file, uInt bucketSize,
+                              uInt nthreads, uInt maxQueue)
+: itsFile       (file),
+  itsBucketSize (bucketSize),
+  itsMaxQueue   (std::max(maxQueue, 1u)),
+  itsStop       (False),
+  itsNrActive   (0),
+  itsNrLookup   (0)
+{
+    initStatistics();
+    nthreads = std::max(nthreads, 1u);
+    itsThreads.reserve (nthreads);
+    for (uInt i=0; i<nthreads; ++i) {
+        itsThreads.emplace_back (&BucketCacheIO::run, this);
+    }
+}
+
+BucketCacheIO::~BucketCacheIO()
+{
+    {
+        std::unique_lock<std::mutex> lock(itsMutex);
+        itsDoneCond.wait (lock, [this]{ return itsQueue.empty()
+                                               && itsNrActive == 0; });
+        itsStop = True;
+    }
+    itsRequestCond.notify_all();
+    for (std::thread& thr : itsThreads) {
+        thr.join();
+    }
+}
+
+void BucketCacheIO::initStatistics()
+{
+    itsNPrefetch     = 0;
+    itsNPrefetchUsed = 0;
+    itsNWrite        = 0;
+    itsNQueueWait    = 0;
+}
+
+Bool BucketCacheIO::prefetch (uInt bucketNr, Int64 offset)
+{
+    {
+        std::lock_guard<std::mutex> lock(itsMutex);
+        if (itsPrefetched.find(bucketNr) != itsPrefetched.end()
+        ||  itsPendingWrites.find(bucketNr) != itsPendingWrites.end()) {
+            return True;
+        }
+        if (nrOutstanding() >= itsMaxQueue) {
+            removeStale();
+            if (nrOutstanding() >= itsMaxQueue) {
+                return False;
+            }
+        }
+        Prefetched& pf = itsPrefetched[bucketNr];
+        pf.ready    = False;
+        pf.failed   = False;
+        pf.lookupNr = itsNrLookup;
+        itsQueue.push_back (Request{bucketNr, offset, False,
+                                    std::vector<char>()});
+        itsNPrefetch++;
+    }
+    itsRequestCond.notify_one();
+    return True;
+}
+
+Bool BucketCacheIO::takePrefetched (uInt bucketNr, char* buffer)
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsNrLookup++;
+    std::map<uInt,Prefetched>::iterator iter = itsPrefetched.find (bucketNr);
+    if (iter == itsPrefetched.end()) {
+        return False;
+    }
+    // Wait until the read is done. Note that the iterator stays valid,
+    // because only the caller's thread erases entries.
+    itsDoneCond.wait (lock, [&iter]{ return iter->second.ready; });
+    Bool ok = !iter->second.failed;
+    if (ok) {
+        memcpy (buffer, iter->second.data.data(), itsBucketSize);
+        itsNPrefetchUsed++;
+    }
+    itsPrefetched.erase (iter);
+    lock.unlock();
+    // A slot in the queue has become available.
+    itsDoneCond.notify_all();
+    return ok;
+}
+
+void BucketCacheIO::write (uInt bucketNr, Int64 offset, const char* data)
+{
+    std::vector<char> buf (data, data + itsBucketSize);
+    {
+        std::unique_lock<std::mutex> lock(itsMutex);
+        rethrow();
+        // A prefetched copy of this bucket is outdated.
+        std::map<uInt,Prefetched>::iterator iter =
+                                              itsPrefetched.find (bucketNr);
+        if (iter != itsPrefetched.end()) {
+            itsDoneCond.wait (lock, [&iter]{ return iter->second.ready; });
+            itsPrefetched.erase (iter);
+        }
+        // Prefetched buckets not taken yet would block forever,
+        // so do not take them into account.
+        if (nrInFlight() >= itsMaxQueue) {
+            itsNQueueWait++;
+            itsDoneCond.wait (lock, [this]{
+                return nrInFlight() < itsMaxQueue; });
+        }
+        itsPendingWrites[bucketNr]++;
+        itsQueue.push_back (Request{bucketNr, offset, True, std::move(buf)});
+        itsNWrite++;
+    }
+    itsRequestCond.notify_one();
+}
+
+void BucketCacheIO::waitBucket (uInt bucketNr)
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsDoneCond.wait (lock, [this, bucketNr]{
+        return itsPendingWrites.find(bucketNr) == itsPendingWrites.end(); });
+    rethrow();
+}
+
+void BucketCacheIO::wait()
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    itsDoneCond.wait (lock, [this]{ return itsQueue.empty()
+                                           && itsNrActive == 0; });
+    rethrow();
+}
+
+void BucketCacheIO::discardPrefetched()
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    // Remove the requests not started yet.
+    std::deque<Request>::iterator iter = itsQueue.begin();
+    while (iter != itsQueue.end()) {
+        if (iter->isWrite) {
+            ++iter;
+        } else {
+            iter = itsQueue.erase (iter);
+        }
+    }
+    // Wait for the reads in progress and remove all buffers.
+    itsDoneCond.wait (lock, [this]{
+        for (const auto& pf : itsPrefetched) {
+            if (!pf.second.ready) {
+                return itsNrActive == 0  &&  itsQueue.empty();
+            }
+        }
+        return True; });
+    itsPrefetched.clear();
+}
+
+void BucketCacheIO::removeStale()
+{
+    std::map<uInt,Prefetched>::iterator iter = itsPrefetched.begin();
+    while (iter != itsPrefetched.end()) {
+        if (iter->second.ready
+        &&  itsNrLookup - iter->second.lookupNr > 2 * uInt64(itsMaxQueue)) {
+            iter = itsPrefetched.erase (iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+void BucketCacheIO::rethrow()
+{
+    if (! itsError.empty()) {
+        String msg = itsError;
+        itsError = String();
+        throw AipsError ("BucketCache asynchronous IO failed: " + msg);
+    }
+}
+
+void BucketCacheIO::run()
+{
+    std::unique_lock<std::mutex> lock(itsMutex);
+    while (True) {
+        itsRequestCond.wait (lock, [this]{ return itsStop
+                                                  || !itsQueue.empty(); });
+        if (itsQueue.empty()) {
+            return;             // itsStop is set
+        }
+        Request req (std::move(itsQueue.front()));
+        itsQueue.pop_front();
+        itsNrActive++;
+        std::vector<char> data;
+        String error;
+        lock.unlock();
+        // Do the IO without holding the lock.
+        try {
+            if (req.isWrite) {
+                itsFile->pwrite (req.data.data(), itsBucketSize, req.offset);
+            } else {
+                data.resize (itsBucketSize);
+                itsFile->pread (data.data(), itsBucketSize, req.offset);
+            }
+        } catch (const std::exception& x) {
+            error = x.what();
+        }
+        lock.lock();
+        itsNrActive--;
+        if (req.isWrite) {
+            std::map<uInt,uInt>::iterator iter =
+                                        itsPendingWrites.find (req.bucketNr);
+            if (--iter->second == 0) {
+                itsPendingWrites.erase (iter);
+            }
+            if (! error.empty()) {
+                itsError = error;
+            }
+        } else {
+            // The entry might have been removed by discardPrefetched.
+            std::map<uInt,Prefetched>::iterator iter =
+                                           itsPrefetched.find (req.bucketNr);
+            if (iter != itsPrefetched.end()) {
+                iter->second.data.swap (data);
+                iter->second.failed = !error.empty();
+                iter->second.ready  = True;
+            }
+        }
+        itsDoneCond.notify_all();
+    }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,221 @@
+//# BucketCacheIO.h: Asynchronous read-ahead and write-behind for BucketCache
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_BUCKETCACHEIO_H
+#define CASA_BUCKETCACHEIO_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class BucketFile;
+
+
+// <summary>
+// Asynchronous read-ahead and write-behind for BucketCache
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tBucketCache" demos="">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+//   <li> <linkto class=BucketFile>BucketFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// BucketCacheIO holds a small pool of IO threads doing the file IO for
+// a <linkto class=BucketCache>BucketCache</linkto> object in the background.
+// <br>A prefetch request reads a bucket (in canonical format) into a buffer
+// held by this object. When the BucketCache needs the bucket, it takes
+// the data from that buffer (waiting if the read is still in progress)
+// instead of reading the file itself.
+// <br>A write request copies the bucket data (in canonical format) into
+// a buffer which is written by an IO thread, so the caller does not need
+// to wait for the write to finish.
+// <p>
+// The number of outstanding requests (including prefetched buckets not
+// taken yet) is bounded. A prefetch request is ignored if the limit is
+// reached, while a write request waits until a slot is available.
+// Only requests in progress count for a write request.
+// <br>A prefetched bucket that is not taken within twice the maximum
+// number of outstanding requests (counted as calls to
+// <src>takePrefetched</src>) is considered stale and is removed when
+// the limit is reached. Thus buckets prefetched for an access pattern
+// that was not continued cannot block new prefetches.
+// <p>
+// The file IO is done using the positional <src>pread</src> and
+// <src>pwrite</src> functions of <linkto class=BucketFile>BucketFile</linkto>,
+// so it does not interfere with the seek/read/write done by the
+// BucketCache itself (e.g. for the free bucket list).
+// <br>An exception thrown by a background write is stored and rethrown
+// in the caller's thread by the next <src>write</src> or <src>wait</src>.
+// A failing prefetch is silently ignored; the bucket will be read again
+// synchronously.
+// </synopsis>
+
+// <motivation>
+// Sequential reading of a large table on a network file system is
+// latency-bound. Overlapping the IO with the processing of the data
+// can improve performance considerably.
+// </motivation>
+
+class BucketCacheIO
+{
+public:
+    // Create the IO thread pool for the given file.
+    // The number of threads and the maximum number of outstanding
+    // requests must be at least 1.
+    BucketCacheIO (BucketFile* file, uInt bucketSize,
+                   uInt nthreads, uInt maxQueue);
+
+    // The destructor waits until all outstanding requests are done.
+    ~BucketCacheIO();
+
+    // Forbid copy constructor.
+    BucketCacheIO (const BucketCacheIO&) = delete;
+
+    // Forbid assignment.
+    BucketCacheIO& operator= (const BucketCacheIO&) = delete;
+
+    // Schedule the read of the given bucket at the given file offset.
+    // Nothing is done if the bucket is already prefetched or if a write
+    // for it is outstanding. False is returned if the queue is full.
+    Bool prefetch (uInt bucketNr, Int64 offset);
+
+    // Copy the prefetched data of the given bucket into the buffer.
+    // It waits if the read is still in progress.
+    // False is returned if the bucket was not prefetched (or failed).
+    Bool takePrefetched (uInt bucketNr, char* buffer);
+
+    // Schedule the write of the given bucket data at the given file offset.
+    // The data are copied, so the buffer can be reused immediately.
+    // It waits while the queue is full.
+    void write (uInt bucketNr, Int64 offset, const char* data);
+
+    // Wait until the outstanding writes of the given bucket are done.
+    void waitBucket (uInt bucketNr);
+
+    // Wait until all outstanding requests are done.
+    // An exception from a failed write is rethrown.
+    void wait();
+
+    // Remove all prefetched buckets (after waiting for reads in progress).
+    void discardPrefetched();
+
+    // Get the number of threads.
+    uInt nthreads() const
+      { return itsThreads.size(); }
+
+    // Get the statistics.
+    // <group>
+    uInt nprefetch() const
+      { return itsNPrefetch; }
+    uInt nprefetchUsed() const
+      { return itsNPrefetchUsed; }
+    uInt nwrite() const
+      { return itsNWrite; }
+    uInt nqueueWait() const
+      { return itsNQueueWait; }
+    void initStatistics();
+    // </group>
+
+private:
+    // A request for an IO thread.
+    struct Request {
+      uInt  bucketNr;
+      Int64 offset;
+      Bool  isWrite;
+      std::vector<char> data;   // only used for writes
+    };
+    // A prefetched bucket.
+    struct Prefetched {
+      Bool ready;
+      Bool failed;
+      // The value of itsNrLookup when the request was done.
+      uInt64 lookupNr;
+      std::vector<char> data;
+    };
+
+    // The function run by each IO thread.
+    void run();
+
+    // Get the number of requests in progress or queued.
+    size_t nrInFlight() const
+      { return itsNrActive + itsQueue.size(); }
+
+    // Get the number of outstanding requests (including prefetched buckets).
+    size_t nrOutstanding() const
+      { return nrInFlight() + itsPrefetched.size(); }
+
+    // Remove the stale prefetched buckets.
+    // The mutex must be locked by the caller.
+    void removeStale();
+
+    // Rethrow a stored exception (and clear it).
+    // The mutex must be locked by the caller.
+    void rethrow();
+
+    BucketFile*                  itsFile;
+    uInt                         itsBucketSize;
+    uInt                         itsMaxQueue;
+    Bool                         itsStop;
+    size_t                       itsNrActive;
+    std::mutex                   itsMutex;
+    // Signals a new request or stop to the IO threads.
+    std::condition_variable      itsRequestCond;
+    // Signals the end of a request to the waiting callers.
+    std::condition_variable      itsDoneCond;
+    std::deque<Request>          itsQueue;
+    std::map<uInt,Prefetched>    itsPrefetched;
+    // Number of calls to takePrefetched (to age prefetched buckets).
+    uInt64                       itsNrLookup;
+    // Number of outstanding writes per bucket.
+    std::map<uInt,uInt>          itsPendingWrites;
+    std::vector<std::thread>     itsThreads;
+    String                       itsError;
+    // The statistics.
+    uInt itsNPrefetch;
+    uInt itsNPrefetchUsed;
+    uInt itsNWrite;
+    uInt itsNQueueWait;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
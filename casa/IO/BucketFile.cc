@@ -209,6 +209,17 @@ uInt BucketFile::write (const void* buffer, uInt length)
     return length;
 }
 
+uInt BucketFile::pread (void* buffer, uInt length, Int64 offset)
+{
+  return file_p->pread (length, offset, buffer);
+}
+
+uInt BucketFile::pwrite (const void* buffer, uInt length, Int64 offset)
+{
+  file_p->pwrite (length, offset, buffer);
+  return length;
+}
+
 void BucketFile::seek (Int64 offset)
 {
     AlwaysAssert (bufferedFile_p == 0, AipsError);
@@ -173,6 +173,18 @@ public:
     // Write bytes into the file.
     virtual uInt write (const void* buffer, uInt length);
 
+    // Read or write bytes at the given offset in the file.
+    // Unlike <src>seek</src> followed by <src>read</src> or <src>write</src>
+    // the file pointer is not used, so these functions can be used by
+    // multiple threads at the same time (as done by the asynchronous IO
+    // of class <linkto class=BucketCache>BucketCache</linkto>).
+    // Note that is only the case for a normal file; the MultiFileBase
+    // classes are not thread-safe.
+    // <group>
+    virtual uInt pread (void* buffer, uInt length, Int64 offset);
+    virtual uInt pwrite (const void* buffer, uInt length, Int64 offset);
+    // </group>
+
     // Seek in the file.
     // <group>
     virtual void seek (Int64 offset);
@@ -190,6 +202,9 @@ public:
     Bool isBuffered() const;
     // </group>
 
+    // Is the file part of a MultiFileBase?
+    Bool isMultiFile() const;
+
 private:
     // The file name.
     String name_p;
@@ -231,6 +246,8 @@ inline Bool BucketFile::isMapped() const
     { return isMapped_p; }
 inline Bool BucketFile::isBuffered() const
     { return bufSize_p>0; }
+inline Bool BucketFile::isMultiFile() const
+    { return mfile_p != nullptr; }
 
 
 } //# NAMESPACE CASACORE - END
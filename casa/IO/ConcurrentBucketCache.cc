@@ -0,0 +1,272 @@
+//# ConcurrentBucketCache.cc: Thread-safe read-only cache for buckets in a file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <thread>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+ConcurrentBucketCache::ConcurrentBucketCache (BucketFile* file,
+                                              Int64 startOffset,
+                                              uInt bucketSize,
+                                              uInt nrOfBuckets,
+                                              uInt cacheSize,
+                                              void* ownerObject,
+                                              BucketCacheToLocal readCallBack,
+                                              BucketCacheDeleteBuffer deleteCallBack,
+                                              uInt nstripes)
+: itsFile           (file),
+  itsStartOffset    (startOffset),
+  itsBucketSize     (bucketSize),
+  itsNrBuckets      (nrOfBuckets),
+  itsNrSlots        (0),
+  itsNrStripes      (std::max(nstripes, 1u)),
+  itsOwner          (ownerObject),
+  itsReadCallBack   (readCallBack),
+  itsDeleteCallBack (deleteCallBack),
+  itsStripes        (new Stripe[itsNrStripes]),
+  itsClockHand      (0)
+{
+    initStatistics();
+    allocate (cacheSize);
+}
+
+ConcurrentBucketCache::~ConcurrentBucketCache()
+{
+    deleteSlots();
+}
+
+void ConcurrentBucketCache::allocate (uInt cacheSize)
+{
+    itsNrSlots = std::max (cacheSize, 1u);
+    itsSlots.reset (new Slot[itsNrSlots]);
+    for (uInt i=0; i<itsNrSlots; ++i) {
+        itsSlots[i].pinCount = 0;
+        itsSlots[i].refBit   = False;
+        itsSlots[i].bucketNr = -1;
+        itsSlots[i].ready    = False;
+        itsSlots[i].data     = 0;
+    }
+}
+
+void ConcurrentBucketCache::deleteSlots()
+{
+    for (uInt i=0; i<itsNrSlots; ++i) {
+        if (itsSlots[i].data != 0) {
+            itsDeleteCallBack (itsOwner, itsSlots[i].data);
+            itsSlots[i].data = 0;
+        }
+    }
+    for (uInt i=0; i<itsNrStripes; ++i) {
+        itsStripes[i].map.clear();
+    }
+}
+
+void ConcurrentBucketCache::clear()
+{
+    deleteSlots();
+    allocate (itsNrSlots);
+}
+
+void ConcurrentBucketCache::resize (uInt cacheSize)
+{
+    deleteSlots();
+    allocate (cacheSize);
+}
+
+void ConcurrentBucketCache::resync (uInt nrBucket)
+{
+    clear();
+    itsNrBuckets = nrBucket;
+}
+
+const char* ConcurrentBucketCache::pinBucket (uInt bucketNr, uInt& slotNr)
+{
+    if (bucketNr >= itsNrBuckets) {
+        throw AipsError ("ConcurrentBucketCache::pinBucket: bucket "
+                         + String::toString(bucketNr) + " does not exist");
+    }
+    itsNAccess++;
+    Stripe& str = stripe (bucketNr);
+    while (True) {
+        {
+            std::unique_lock<std::mutex> lock(str.mutex);
+            std::unordered_map<uInt,uInt>::const_iterator iter =
+                                                     str.map.find (bucketNr);
+            if (iter != str.map.end()) {
+                slotNr = iter->second;
+                Slot& slot = itsSlots[slotNr];
+                slot.pinCount++;
+                slot.refBit = True;
+                if (! slot.ready) {
+                    // Another thread is reading the bucket.
+                    itsNWait++;
+                    str.cond.wait (lock, [&slot, bucketNr]{
+                        return slot.ready  ||  slot.bucketNr != bucketNr; });
+                }
+                if (slot.ready) {
+                    return slot.data;
+                }
+                // The read failed in the other thread, so try it again.
+                slot.pinCount--;
+                continue;
+            }
+        }
+        // The bucket is not in the cache, so get a free slot.
+        // Note that the mutex is not held, because it might require
+        // the mutex of another stripe.
+        slotNr = claimSlot();
+        Slot& slot = itsSlots[slotNr];
+        {
+            std::lock_guard<std::mutex> lock(str.mutex);
+            if (str.map.find (bucketNr) != str.map.end()) {
+                // Another thread has added the bucket in the meantime.
+                slot.pinCount--;
+                continue;
+            }
+            str.map[bucketNr] = slotNr;
+            slot.bucketNr = bucketNr;
+            slot.ready    = False;
+            slot.refBit   = True;
+        }
+        // Read the bucket without holding the mutex.
+        try {
+            readBucket (slot, bucketNr);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(str.mutex);
+                str.map.erase (bucketNr);
+                slot.bucketNr = -1;
+            }
+            slot.pinCount--;
+            str.cond.notify_all();
+            throw;
+        }
+        {
+            std::lock_guard<std::mutex> lock(str.mutex);
+            slot.ready = True;
+        }
+        str.cond.notify_all();
+        return slot.data;
+    }
+}
+
+void ConcurrentBucketCache::unpinBucket (uInt slotNr)
+{
+    itsSlots[slotNr].pinCount--;
+}
+
+uInt ConcurrentBucketCache::claimSlot()
+{
+    uInt nscan = 0;
+    while (True) {
+        // Yield if all slots appear to be pinned.
+        if (++nscan > 2*itsNrSlots) {
+            std::this_thread::yield();
+            nscan = 0;
+        }
+        uInt slotNr = itsClockHand++ % itsNrSlots;
+        Slot& slot = itsSlots[slotNr];
+        if (slot.pinCount != 0) {
+            continue;
+        }
+        // Give a recently used bucket a second chance.
+        if (slot.refBit.exchange (False)) {
+            continue;
+        }
+        uInt expected = 0;
+        if (! slot.pinCount.compare_exchange_strong (expected, 1)) {
+            continue;
+        }
+        // The slot is claimed, so its bucket number cannot change anymore.
+        // Remove the bucket from its stripe, unless another thread has
+        // found and pinned it in the meantime.
+        if (slot.bucketNr >= 0) {
+            Stripe& str = stripe (slot.bucketNr);
+            std::lock_guard<std::mutex> lock(str.mutex);
+            if (slot.pinCount != 1) {
+                slot.pinCount--;
+                continue;
+            }
+            str.map.erase (slot.bucketNr);
+            slot.bucketNr = -1;
+            slot.ready    = False;
+            itsNEvict++;
+        }
+        return slotNr;
+    }
+}
+
+void ConcurrentBucketCache::readBucket (Slot& slot, uInt bucketNr)
+{
+    std::vector<char> buffer(itsBucketSize);
+    Int64 offset = itsStartOffset + Int64(bucketNr) * itsBucketSize;
+    if (itsFile->isMultiFile()) {
+        std::lock_guard<std::mutex> lock(itsIOMutex);
+        itsFile->pread (buffer.data(), itsBucketSize, offset);
+    } else {
+        itsFile->pread (buffer.data(), itsBucketSize, offset);
+    }
+    char* data = itsReadCallBack (itsOwner, buffer.data());
+    if (slot.data != 0) {
+        itsDeleteCallBack (itsOwner, slot.data);
+    }
+    slot.data = data;
+    itsNRead++;
+}
+
+void ConcurrentBucketCache::initStatistics()
+{
+    itsNAccess = 0;
+    itsNRead   = 0;
+    itsNWait   = 0;
+    itsNEvict  = 0;
+}
+
+void ConcurrentBucketCache::showStatistics (ostream& os) const
+{
+    os << "cacheSize: " << itsNrSlots << " (*" << itsBucketSize
+       << ")" << endl;
+    os << "#buckets:  " << itsNrBuckets << endl;
+    os << "#stripes:  " << itsNrStripes << endl;
+    os << "#accesses: " << itsNAccess << endl;
+    os << "#reads:    " << itsNRead << endl;
+    if (itsNEvict > 0) {
+        os << "#evicted:  " << itsNEvict << endl;
+    }
+    if (itsNWait > 0) {
+        os << "#waits:    " << itsNWait << endl;
+    }
+}
+
+
+} //# NAMESPACE CASACORE - END
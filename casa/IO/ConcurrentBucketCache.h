@@ -0,0 +1,272 @@
+//# ConcurrentBucketCache.h: Thread-safe read-only cache for buckets in a file
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef CASA_CONCURRENTBUCKETCACHE_H
+#define CASA_CONCURRENTBUCKETCACHE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+//# Forward clarations
+#include <casacore/casa/iosfwd.h>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward declarations
+class BucketFile;
+
+
+// <summary>
+// Thread-safe read-only cache for buckets in a file
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tConcurrentBucketCache" demos="">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+//   <li> <linkto class=BucketFile>BucketFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// ConcurrentBucketCache is a variant of
+// <linkto class=BucketCache>BucketCache</linkto> that can be used by
+// multiple threads at the same time. It only supports reading of buckets,
+// so it can only be used for files that are not changed while the cache
+// is in use.
+// <p>
+// A bucket has to be pinned before its data can be used. A pinned bucket
+// stays in the cache until it is unpinned, so its data can be used safely
+// while other threads access other buckets. The class
+// <linkto class=ConcurrentBucketCache:Pinned>ConcurrentBucketCache::Pinned</linkto>
+// can be used to unpin a bucket automatically.
+// <p>
+// To reduce contention, the map of bucket numbers to cache slots is divided
+// into a number of stripes, each with its own mutex. A bucket is mapped to
+// stripe <src>bucketNr % nstripes</src>. A mutex is never held while a
+// bucket is read from the file, so threads accessing buckets in the cache
+// are not held up by a thread waiting for IO. A thread needing a bucket
+// being read by another thread waits for that read to finish.
+// <p>
+// If the cache is full, the CLOCK algorithm (an approximation of LRU)
+// determines the bucket to remove. Each slot has a reference bit set when
+// the bucket is accessed. The clock hand sweeps the slots and removes the
+// first unpinned bucket whose reference bit is not set, clearing the bits
+// it passes.
+// <p>
+// The conversion of the bucket data to local format is done by the same
+// callback functions as used by BucketCache. They have to be thread-safe.
+// <br>The file is read using the positional read function of
+// <linkto class=BucketFile>BucketFile</linkto>. Reads from a
+// <linkto class=MultiFileBase>MultiFile</linkto> are serialized, because
+// it cannot be read by multiple threads at the same time.
+// </synopsis>
+
+// <motivation>
+// BucketCache keeps its state in plain data structures without any
+// synchronisation, so a storage manager using it can only be used by a
+// single thread. Reading a table by multiple threads requires a cache
+// that can be shared.
+// </motivation>
+
+// <example>
+// <srcblock>
+// ConcurrentBucketCache cache (&file, 0, 32768, nbucket, 64, this,
+//                              readCallBack, deleteCallBack);
+// #pragma omp parallel for
+// for (uInt i=0; i<nbucket; ++i) {
+//     ConcurrentBucketCache::Pinned pin (cache, i);
+//     process (pin.data());
+// }
+// </srcblock>
+// </example>
+
+class ConcurrentBucketCache
+{
+public:
+    // Helper class to unpin a bucket automatically at destruction.
+    class Pinned
+    {
+    public:
+        // Pin the given bucket.
+        Pinned (ConcurrentBucketCache& cache, uInt bucketNr)
+          : itsCache (cache),
+            itsData  (cache.pinBucket (bucketNr, itsSlot))
+          {}
+        // Unpin the bucket.
+        ~Pinned()
+          { itsCache.unpinBucket (itsSlot); }
+        Pinned (const Pinned&) = delete;
+        Pinned& operator= (const Pinned&) = delete;
+        // Get the data of the bucket (in local format).
+        const char* data() const
+          { return itsData; }
+    private:
+        ConcurrentBucketCache& itsCache;
+        uInt        itsSlot;
+        const char* itsData;
+    };
+
+    // Create the cache for (a part of) a file.
+    // The file part used starts at startOffset. Its length is
+    // bucketSize*nrOfBuckets bytes.
+    // The cache size must be at least 1.
+    ConcurrentBucketCache (BucketFile* file, Int64 startOffset,
+                           uInt bucketSize, uInt nrOfBuckets, uInt cacheSize,
+                           void* ownerObject,
+                           BucketCacheToLocal readCallBack,
+                           BucketCacheDeleteBuffer deleteCallBack,
+                           uInt nstripes = 16);
+
+    ~ConcurrentBucketCache();
+
+    // Forbid copy constructor.
+    ConcurrentBucketCache (const ConcurrentBucketCache&) = delete;
+
+    // Forbid assignment.
+    ConcurrentBucketCache& operator= (const ConcurrentBucketCache&) = delete;
+
+    // Pin the given bucket and return a pointer to its data.
+    // It is read if not in the cache yet. The slot number is returned
+    // in <src>slotNr</src> and has to be used to unpin the bucket.
+    // An exception is thrown if the bucket number is out of range.
+    // If all slots are pinned, it waits until a slot gets available.
+    const char* pinBucket (uInt bucketNr, uInt& slotNr);
+
+    // Unpin the bucket in the given slot.
+    void unpinBucket (uInt slotNr);
+
+    // Remove all buckets from the cache, so they will be reread.
+    // It must not be called while buckets are pinned.
+    void clear();
+
+    // Resize the cache. It clears the cache.
+    // It must not be called while buckets are pinned.
+    void resize (uInt cacheSize);
+
+    // Resynchronize the object (after another process updated the file).
+    // It clears the cache and sets the number of buckets.
+    // It must not be called while buckets are pinned.
+    void resync (uInt nrBucket);
+
+    // Get the current cache size (in buckets).
+    uInt cacheSize() const
+      { return itsNrSlots; }
+
+    // Get the number of buckets in the file part.
+    uInt nBucket() const
+      { return itsNrBuckets; }
+
+    // Show the statistics.
+    void showStatistics (ostream& os) const;
+
+    // Initialize the statistics.
+    void initStatistics();
+
+    // Get the number of bucket accesses and the number of buckets read
+    // from the file since the statistics were initialized.
+    // <group>
+    uInt nAccess() const
+      { return itsNAccess; }
+    uInt nRead() const
+      { return itsNRead; }
+    // </group>
+
+    // Get the size of a bucket (in bytes).
+    uInt bucketSize() const
+      { return itsBucketSize; }
+
+private:
+    // A slot in the cache.
+    // The bucket number and ready flag are protected by the mutex of the
+    // stripe containing the bucket.
+    struct Slot {
+      std::atomic<uInt> pinCount;
+      std::atomic<Bool> refBit;
+      Int64             bucketNr;     // -1 if slot is empty
+      Bool              ready;        // True if data are read
+      char*             data;
+    };
+    // A stripe of the bucket map.
+    struct Stripe {
+      std::mutex                     mutex;
+      std::condition_variable        cond;
+      std::unordered_map<uInt,uInt>  map;
+    };
+
+    // Allocate the slots and stripes.
+    void allocate (uInt cacheSize);
+
+    // Delete the data in all slots.
+    void deleteSlots();
+
+    // Get the stripe for a bucket.
+    Stripe& stripe (uInt bucketNr)
+      { return itsStripes[bucketNr % itsNrStripes]; }
+
+    // Find an unpinned slot using the CLOCK algorithm, remove its bucket
+    // from the map, and return it pinned.
+    uInt claimSlot();
+
+    // Read the bucket into the slot (which is pinned by the caller).
+    void readBucket (Slot& slot, uInt bucketNr);
+
+    BucketFile*             itsFile;
+    Int64                   itsStartOffset;
+    uInt                    itsBucketSize;
+    uInt                    itsNrBuckets;
+    uInt                    itsNrSlots;
+    uInt                    itsNrStripes;
+    void*                   itsOwner;
+    BucketCacheToLocal      itsReadCallBack;
+    BucketCacheDeleteBuffer itsDeleteCallBack;
+    std::unique_ptr<Slot[]>   itsSlots;
+    std::unique_ptr<Stripe[]> itsStripes;
+    // The hand of the clock.
+    std::atomic<uInt>       itsClockHand;
+    // Serializes the reads of a MultiFile.
+    std::mutex              itsIOMutex;
+    // The statistics.
+    std::atomic<uInt>       itsNAccess;
+    std::atomic<uInt>       itsNRead;
+    std::atomic<uInt>       itsNWait;
+    std::atomic<uInt>       itsNEvict;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -26,6 +26,7 @@
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/iostream.h>
 
@@ -38,6 +39,7 @@ void a (Bool);
 void b (Bool);
 void c (uInt bufSize);
 void d (uInt bufSize);
+void e();
 
 int main (int argc, const char*[])
 {
@@ -52,6 +54,7 @@ int main (int argc, const char*[])
 //	d (1024);
 //	d (32768);
 //	d (327680);
+	e();
     } catch (std::exception& x) {
 	cout << "Caught an exception: " << x.what() << endl;
 	return 1;
@@ -254,3 +257,69 @@ void d (uInt)
     timer.show();
     cout << "<<<" << endl;
 }
+
+// Test asynchronous IO.
+void e()
+{
+    {
+        // Create the file using a small cache, so buckets are written
+        // in the background when removed from the cache.
+        BucketFile file ("tBucketCache_tmp.data2");
+        file.open();
+        BucketCache cache (&file, 512, 32768, 0, 4, 0, aToLocal, aFromLocal,
+                           aInitBuffer, aDeleteBuffer);
+        AlwaysAssertExit (cache.setAsyncIO (2, 4, 8));
+        AlwaysAssertExit (cache.isAsyncIO());
+        for (Int i=0; i<200; i++) {
+            char* ptr = new char[32768];
+            memset (ptr, 0, 32768);
+            *(Int*)ptr = i;
+            *(Int*)(ptr+32760) = i+1000;
+            cache.addBucket (ptr);
+        }
+        // Update some buckets after they have been removed from the cache.
+        for (Int i=0; i<200; i+=20) {
+            char* buf = cache.getBucket (i);
+            *(Int*)(buf+32760) = i+2000;
+            cache.setDirty();
+        }
+        cache.flush();
+        cout << "wrote async " << cache.nBucket() << " buckets" << endl;
+    }
+    // Read the file sequentially and randomly with read-ahead.
+    BucketFile file("tBucketCache_tmp.data2", False);
+    file.open();
+    BucketCache cache (&file, 512, 32768, 200, 4, 0, aToLocal, aFromLocal,
+                       aInitBuffer, aDeleteBuffer);
+    AlwaysAssertExit (cache.setAsyncIO (2, 4, 8));
+    for (uInt j=0; j<3; j++) {
+        for (Int i=0; i<200; i++) {
+            Int bucketNr = (j==1 ? (i*37)%200 : i);
+            char* buf = cache.getBucket (bucketNr);
+            Int exp = bucketNr + (bucketNr%20 == 0 ? 2000 : 1000);
+            if (*(Int*)buf != bucketNr  ||  *(Int*)(buf+32760) != exp) {
+                cout << "Error in async bucket " << bucketNr << endl;
+            }
+        }
+    }
+    // Sequential access must have used prefetched buckets.
+    AlwaysAssertExit (cache.nPrefetchUsed() > 0);
+    // Short sequential bursts at random places leave prefetched buckets
+    // that are never used. They should not block the read-ahead of a
+    // sequential pass afterwards.
+    for (Int i=0; i<20; i++) {
+        cache.getBucket (100 + (i*53)%90);
+        cache.getBucket (101 + (i*53)%90);
+    }
+    // Let the outstanding reads finish (flush waits for all IO).
+    cache.flush();
+    cache.initStatistics();
+    for (Int i=0; i<100; i++) {
+        cache.getBucket (i);
+    }
+    AlwaysAssertExit (cache.nPrefetchUsed() > 50);
+    AlwaysAssertExit (cache.isAsyncIO());
+    AlwaysAssertExit (cache.setAsyncIO (0));
+    AlwaysAssertExit (! cache.isAsyncIO());
+    cout << "checked async " << cache.nBucket() << " buckets" << endl;
+}
@@ -0,0 +1,176 @@
+//# tBucketCacheBudget.cc: Test program for the BucketCacheBudget class
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/IO/BucketCacheBudget.h>
+#include <casacore/casa/IO/BucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <thread>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the BucketCacheBudget class
+// </summary>
+
+const uInt bucketSize = 1024;
+const uInt nbucket = 8;
+
+char* toLocal (void*, const char* data)
+{
+    char* ptr = new char[bucketSize];
+    memcpy (ptr, data, bucketSize);
+    return ptr;
+}
+void fromLocal (void*, char* data, const char* local)
+{
+    memcpy (data, local, bucketSize);
+}
+char* initBuffer (void*)
+{
+    char* ptr = new char[bucketSize];
+    memset (ptr, 0, bucketSize);
+    return ptr;
+}
+void deleteBuffer (void*, char* buffer)
+{
+    delete [] buffer;
+}
+
+BucketCache* makeCache (BucketFile& file, uInt cacheSize)
+{
+    return new BucketCache (&file, 0, bucketSize, 0, cacheSize, 0,
+                            toLocal, fromLocal, initBuffer, deleteBuffer);
+}
+
+// Write buckets with a value identifying the cache and bucket.
+void fill (BucketCache& cache, Int id)
+{
+    for (uInt i=0; i<nbucket; ++i) {
+        char* buf = initBuffer(0);
+        *(Int*)buf = id*100 + i;
+        cache.addBucket (buf);
+    }
+    cache.flush();
+}
+
+void check (BucketCache& cache, Int id, uInt bucketNr)
+{
+    AlwaysAssertExit (*(Int*)(cache.getBucket(bucketNr)) ==
+                      Int(id*100 + bucketNr));
+}
+
+void doIt()
+{
+    AlwaysAssertExit (BucketCacheBudget::budget() == 0);
+    BucketFile file1("tBucketCacheBudget_tmp.dat1");
+    BucketFile file2("tBucketCacheBudget_tmp.dat2");
+    BucketCache* cache1 = makeCache (file1, nbucket);
+    BucketCache* cache2 = makeCache (file2, nbucket);
+    AlwaysAssertExit (BucketCacheBudget::nrCaches() == 2);
+    // Without a budget both caches can be filled entirely.
+    fill (*cache1, 1);
+    fill (*cache2, 2);
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 2*nbucket*bucketSize);
+    cache1->clear();
+    cache2->clear();
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 0);
+    // Now limit the caches to 6 buckets in total.
+    BucketCacheBudget::setBudget (6*bucketSize);
+    for (uInt i=0; i<4; ++i) {
+        check (*cache1, 1, i);
+    }
+    // Make bucket 0 the most recently used one.
+    check (*cache1, 1, 0);
+    for (uInt i=0; i<4; ++i) {
+        check (*cache2, 2, i);
+    }
+    // Cache2 could only get 2 slots and has asked cache1 to release 2.
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 6*bucketSize);
+    AlwaysAssertExit (BucketCacheBudget::nrEvicted() == 0);
+    // Cache1 removes its 2 least recently used buckets on its next access.
+    // Buckets 0 and 3 should still be in cache1, so not be reread.
+    cache1->initStatistics();
+    check (*cache1, 1, 0);
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 4*bucketSize);
+    AlwaysAssertExit (BucketCacheBudget::nrEvicted() == 2);
+    check (*cache1, 1, 3);
+    check (*cache1, 1, 1);
+    cache1->showStatistics (cout);
+    // Changed buckets must be written before being removed.
+    for (uInt i=0; i<nbucket; ++i) {
+        *(Int*)(cache2->getBucket(i)) += 1000;
+        cache2->setDirty();
+    }
+    cout << "nr of buckets used: "
+         << BucketCacheBudget::usedSize() / bucketSize << endl;
+    for (uInt i=0; i<nbucket; ++i) {
+        check (*cache1, 1, i);
+    }
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 6*bucketSize);
+    // Cache2 writes the buckets it releases.
+    for (uInt i=0; i<nbucket; ++i) {
+        check (*cache2, 12, i);
+    }
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 6*bucketSize);
+    cout << "checked budget in a single thread" << endl;
+    // A cache used by another thread releases slots in that thread,
+    // so the budget is met when that thread accesses the cache again.
+    cache1->clear();
+    cache2->clear();
+    std::thread thr([cache2]() {
+        for (uInt i=0; i<4; ++i) {
+            check (*cache2, 12, i);
+        }
+    });
+    thr.join();
+    for (uInt i=0; i<4; ++i) {
+        check (*cache1, 1, i);
+    }
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 6*bucketSize);
+    std::thread thr2([cache2]() {
+        check (*cache2, 12, 3);
+    });
+    thr2.join();
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 4*bucketSize);
+    cout << "checked budget with multiple threads" << endl;
+    delete cache1;
+    delete cache2;
+    AlwaysAssertExit (BucketCacheBudget::nrCaches() == 0);
+    AlwaysAssertExit (BucketCacheBudget::usedSize() == 0);
+    BucketCacheBudget::setBudget (0);
+}
+
+int main()
+{
+    try {
+        doIt();
+    } catch (const std::exception& x) {
+        cout << "Caught an exception: " << x.what() << endl;
+        return 1;
+    }
+    return 0;                           // exit with success status
+}
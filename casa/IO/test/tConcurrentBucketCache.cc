@@ -0,0 +1,165 @@
+//# tConcurrentBucketCache.cc: Test program for the ConcurrentBucketCache class
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the ConcurrentBucketCache class
+// </summary>
+
+const uInt bucketSize = 1024;
+const uInt nrBucket   = 100;
+
+// The toLocal function converts the Ints in the bucket to local format.
+char* toLocal (void*, const char* data)
+{
+    char* ptr = new char[bucketSize];
+    CanonicalConversion::toLocal ((Int*)ptr, data, bucketSize/sizeof(Int));
+    return ptr;
+}
+void deleteBuffer (void*, char* buffer)
+{
+    delete [] buffer;
+}
+
+// Check that all values in the bucket are equal to the bucket number.
+Bool checkBucket (const char* data, uInt bucketNr)
+{
+    const Int* values = (const Int*)data;
+    for (uInt i=0; i<bucketSize/sizeof(Int); ++i) {
+        if (values[i] != Int(bucketNr+i)) {
+            return False;
+        }
+    }
+    return True;
+}
+
+void makeFile()
+{
+    BucketFile file ("tConcurrentBucketCache_tmp.data");
+    file.open();
+    std::vector<Int> values(bucketSize/sizeof(Int));
+    std::vector<char> buf(bucketSize);
+    for (uInt i=0; i<nrBucket; ++i) {
+        for (uInt j=0; j<values.size(); ++j) {
+            values[j] = i+j;
+        }
+        CanonicalConversion::fromLocal (buf.data(), values.data(),
+                                        values.size());
+        file.write (buf.data(), bucketSize);
+    }
+}
+
+// Read all buckets sequentially.
+void a()
+{
+    BucketFile file ("tConcurrentBucketCache_tmp.data", False);
+    file.open();
+    ConcurrentBucketCache cache (&file, 0, bucketSize, nrBucket, 10, 0,
+                                 toLocal, deleteBuffer, 4);
+    for (uInt i=0; i<nrBucket; ++i) {
+        ConcurrentBucketCache::Pinned pin (cache, i);
+        AlwaysAssertExit (checkBucket (pin.data(), i));
+    }
+    // Pinning a bucket twice gives the same data.
+    {
+        ConcurrentBucketCache::Pinned pin1 (cache, 3);
+        ConcurrentBucketCache::Pinned pin2 (cache, 3);
+        AlwaysAssertExit (pin1.data() == pin2.data());
+    }
+    // A non-existing bucket cannot be pinned.
+    Bool failed = False;
+    try {
+        ConcurrentBucketCache::Pinned pin (cache, nrBucket);
+    } catch (const AipsError& x) {
+        failed = True;
+    }
+    AlwaysAssertExit (failed);
+    cache.resize (5);
+    AlwaysAssertExit (cache.cacheSize() == 5);
+    for (uInt i=0; i<nrBucket; i+=7) {
+        ConcurrentBucketCache::Pinned pin (cache, i);
+        AlwaysAssertExit (checkBucket (pin.data(), i));
+    }
+    cout << "read " << nrBucket << " buckets sequentially" << endl;
+}
+
+// Read the buckets in random order from multiple threads.
+// The cache is small, so buckets are evicted all the time.
+void b (uInt nthread, uInt cacheSize)
+{
+    BucketFile file ("tConcurrentBucketCache_tmp.data", False);
+    file.open();
+    ConcurrentBucketCache cache (&file, 0, bucketSize, nrBucket, cacheSize, 0,
+                                 toLocal, deleteBuffer);
+    std::atomic<uInt> nerr(0);
+    std::vector<std::thread> threads;
+    for (uInt t=0; t<nthread; ++t) {
+        threads.emplace_back ([&cache, &nerr, t]() {
+            uInt seed = 12345 + t;
+            for (uInt i=0; i<5000; ++i) {
+                seed = seed * 1103515245 + 12345;
+                uInt bucketNr = (seed >> 8) % nrBucket;
+                ConcurrentBucketCache::Pinned pin (cache, bucketNr);
+                if (! checkBucket (pin.data(), bucketNr)) {
+                    nerr++;
+                }
+            }
+        });
+    }
+    for (std::thread& thr : threads) {
+        thr.join();
+    }
+    AlwaysAssertExit (nerr == 0);
+    cout << "read buckets randomly using " << nthread << " threads and "
+         << cacheSize << " slots" << endl;
+    cout << ">>>" << endl;
+    cache.showStatistics (cout);
+    cout << "<<<" << endl;
+}
+
+int main()
+{
+    try {
+        makeFile();
+        a();
+        b (1, 10);
+        b (8, 10);
+        b (8, 4);
+        b (4, 200);
+    } catch (const std::exception& x) {
+        cout << "Caught an exception: " << x.what() << endl;
+        return 1;
+    }
+    return 0;                           // exit with success status
+}
@@ -259,6 +259,30 @@ void Sort::addKey (SortKey* key)
 }
 
 
+Bool Sort::canRadixSort() const
+{
+    for (size_t i=0; i<nrkey_p; i++) {
+        // Only ObjCompare objects tell the data type of the key.
+        switch (keys_p[i]->cmpObj_p->dataType()) {
+        case TpBool:
+        case TpChar:
+        case TpUChar:
+        case TpShort:
+        case TpUShort:
+        case TpInt:
+        case TpUInt:
+        case TpInt64:
+        case TpFloat:
+        case TpDouble:
+            break;
+        default:
+            return False;
+        }
+    }
+    return True;
+}
+
+
 uInt Sort::sort (Vector<uInt>& indexVector, uInt nrrec,
                  int options, Bool tryGenSort) const
   { return doSort (indexVector, nrrec, options, tryGenSort); }
@@ -267,6 +291,14 @@ uInt64 Sort::sort (Vector<uInt64>& indexVector, uInt64 nrrec,
                    int options, Bool tryGenSort) const
   { return doSort (indexVector, nrrec, options, tryGenSort); }
 
+uInt Sort::partialSort (Vector<uInt>& indexVector, uInt nrrec, uInt nrout,
+                        int options) const
+  { return doPartialSort (indexVector, nrrec, nrout, options); }
+
+uInt64 Sort::partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                          uInt64 nrout, int options) const
+  { return doPartialSort (indexVector, nrrec, nrout, options); }
+
 uInt Sort::unique (Vector<uInt>& uniqueVector, uInt nrrec) const
   { return doUnique (uniqueVector, nrrec); }
 
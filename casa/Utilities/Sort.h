@@ -119,8 +119,19 @@ protected:
 // If sorting on a single key with a standard data type is done,
 // Sort will use GenSortIndirect to speed up the sort.
 // <br>
-// Four sort algorithms are provided:
+// Five sort algorithms are provided:
 // <DL>
+//  <DT> <src>Sort::RadixSort</src>
+//  <DD> The LSD radix sort has O(n*k) behaviour (k is the total number of
+//       bytes in the keys) and uses multiple threads if possible.
+//       It can only be used if all keys have a standard numeric data type
+//       (Bool, integer, Float or Double) given by its DataType, thus
+//       not for strings or if a user-defined comparison object is used.
+//       In that case the default sort algorithm is used instead.
+//       It is usually the fastest algorithm for large arrays with keys
+//       like the time and antenna numbers in a MeasurementSet.
+//       It needs extra arrays to hold the keys and indices.
+//       NaN values are put after all other values.
 //  <DT> <src>Sort::ParSort</src>
 //  <DD> The parallel merge sort is the fastest if it can use multiple threads.
 //       For a single thread it has O(n*log(n)) behaviour, but is slower
@@ -141,6 +152,7 @@ protected:
 // </DL>
 // The default is to use QuickSort for small arrays or if only a single
 // thread can be used. Otherwise ParSort is the default.
+// RadixSort is never used by default; it has to be asked for explicitly.
 // 
 // All sort algorithms are <em>stable</em>, which means that the original
 // order is kept when keys are equal.
@@ -250,7 +262,8 @@ public:
                  InsSort=2,         // use insertion sort algorithm
                  QuickSort=4,       // use Quicksort algorithm
                  ParSort=8,         // use parallel merge sort algorithm
-                 NoDuplicates=16};  // skip data with equal sort keys
+                 NoDuplicates=16,   // skip data with equal sort keys
+                 RadixSort=32};     // use (parallel) radix sort if possible
 
     // Enumerate the sort order:
     enum Order {Ascending=-1,
@@ -328,6 +341,25 @@ public:
     uInt64 sort (Vector<uInt64>& indexVector, uInt64 nrrec,
                  int options = DefaultSort, Bool tryGenSort = True) const;
 
+    // Partially sort the data array of <src>nrrec</src> records, thus only
+    // determine the indices of the first <src>nrout</src> records in the
+    // requested order (e.g., for a top-N selection).
+    // It returns the number of resulting records (at most <src>nrout</src>).
+    // The indices array is resized to that number. The result is the same
+    // as the first part of the result of a full sort (thus stable as well).
+    // <br>The first records are found using a heap of <src>nrout</src>
+    // elements, which is O(n*log(nrout)). If possible, the data are divided
+    // in parts handled by multiple threads whose results are merged.
+    // A full sort is done if <src>nrout</src> is not small compared to
+    // <src>nrrec</src> or if <src>Sort::NoDuplicates</src> is given.
+    // The sort algorithm given in the options is only used in that case.
+    // <group>
+    uInt partialSort (Vector<uInt>& indexVector, uInt nrrec, uInt nrout,
+                      int options = DefaultSort) const;
+    uInt64 partialSort (Vector<uInt64>& indexVector, uInt64 nrrec,
+                        uInt64 nrout, int options = DefaultSort) const;
+    // </group>
+
     // Get all unique records in a sorted array. The array order is
     // given in the indexVector (as possibly returned by the sort function).
     // The default indexVector is 0..nrrec-1.
@@ -364,6 +396,10 @@ private:
     T doSort (Vector<T>& indexVector, T nrrec,
               int options = DefaultSort, Bool tryGenSort = True) const;
 
+    template<typename T>
+    T doPartialSort (Vector<T>& indexVector, T nrrec, T nrout,
+                     int options) const;
+
     template <typename T>
     T doUnique (Vector<T>& uniqueVector, T nrrec) const;
     template <typename T>
@@ -394,6 +430,27 @@ private:
     // to use. It defaults to the number of cores.
     template<typename T>
     T parSort (int nthr, T nrrec, T* inx) const;
+
+    // Tell if all keys are numeric keys that can be sorted by radixSort.
+    Bool canRadixSort() const;
+
+    // Do an LSD radix sort using the given maximum number of threads.
+    // Each key is converted to an unsigned integer with the same order,
+    // whereafter a stable counting sort is done on each byte of it,
+    // starting with the least significant byte of the least significant key.
+    // Bytes that are the same for all records are skipped.
+    template<typename T>
+    T radixSort (int nthr, T nrrec, T* inx) const;
+
+    // Fill the radix sort values of a key for the records in the order
+    // given by the index. The bits of the values are inverted if
+    // <src>invert</src> is set. It returns the number of bytes per value.
+    template<typename T>
+    uInt radixValues (const SortKey& key, Bool invert, int nthr, T nrrec,
+                      const T* inx, uInt64* values) const;
+    template<typename V, typename T>
+    static uInt radixFill (const SortKey& key, Bool invert, int nthr, T nrrec,
+                           const T* inx, uInt64* values);
     template<typename T>
     void merge (T* inx, T* tmp, T size, T* index,
                 T nparts) const;
@@ -417,6 +474,14 @@ private:
     T heapSortNoDup (T nr, T* indices) const;
     // </group>
 
+    // Find the first <src>nrout</src> of <src>nr</src> records using a heap
+    // and store their indices in order in <src>heap</src>.
+    // The records are given by the candidate indices or, if
+    // <src>cand</src> is a null pointer, by the indices from
+    // <src>start</src> on.
+    template<typename T>
+    void heapTopN (T nr, const T* cand, T start, T nrout, T* heap) const;
+
     // Siftdown algorithm for heapsort.
     template<typename T>
     void siftDown (T low, T up, T* indices) const;
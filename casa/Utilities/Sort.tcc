@@ -30,6 +30,11 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/SortError.h>
 #include <casacore/casa/Arrays/ArrayMath.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -44,8 +49,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (nrrec == 0) {
       return nrrec;
     }
+    //# A radix sort can only be done for numeric keys.
+    //# Otherwise use the default sort.
+    Bool radix = False;
+    if (opt - (opt & NoDuplicates) == RadixSort) {
+      radix = canRadixSort();
+      if (!radix) {
+        opt = (opt & NoDuplicates) + DefaultSort;
+      }
+    }
     //# Try if we can use the faster GenSort when we have one key only.
-    if (doTryGenSort  &&  nrkey_p == 1) {
+    if (doTryGenSort  &&  nrkey_p == 1  &&  !radix) {
       uInt n = keys_p[0]->tryGenSort (indexVector, nrrec, opt);
       if (n > 0) {
         return n;
@@ -99,6 +113,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         n = insSortNoDup (nrrec, inx);
       }
       break;
+    case RadixSort:
+      n = radixSort (nthr, nrrec, inx);
+      if (nodup) {
+        n = insSortNoDup (nrrec, inx);
+      }
+      break;
     default:
       throw SortInvOpt();
     }
@@ -111,6 +131,87 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return n;
   }
 
+  template<typename T>
+  T Sort::doPartialSort (Vector<T>& indexVector, T nrrec, T nrout,
+                         int opt) const
+  {
+    if (nrout > nrrec) {
+      nrout = nrrec;
+    }
+    if (nrout == 0) {
+      indexVector.resize (0);
+      return 0;
+    }
+    // A full sort is faster if a large part of the records is needed.
+    // Duplicates can only be removed by a full sort.
+    if (nrout > nrrec/4  ||  (opt & NoDuplicates) != 0) {
+      T n = doSort (indexVector, nrrec, opt);
+      if (n > nrout) {
+        indexVector.resize (nrout, True);
+        n = nrout;
+      }
+      return n;
+    }
+    // Only use multiple threads if the parts are large compared to the heap.
+    int nthr = 1;
+#ifdef _OPENMP
+    nthr = omp_get_max_threads();
+    T maxthr = nrrec / std::max(T(1000), 4*nrout);
+    if (T(nthr) > maxthr) nthr = std::max(T(1), maxthr);
+#endif
+    indexVector.resize (nrout);
+    Bool del;
+    T* inx = indexVector.getStorage (del);
+    if (nthr == 1) {
+      heapTopN (nrrec, static_cast<const T*>(0), T(0), nrout, inx);
+    } else {
+      // Each thread finds the first records in its part.
+      // Thereafter the first records of all those are found.
+      Block<T> cand(nthr*nrout);
+      T step = nrrec/nthr;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+      for (int i=0; i<nthr; ++i) {
+        T st = i*step;
+        T nr = (i == nthr-1  ?  nrrec-st : step);
+        heapTopN (nr, static_cast<const T*>(0), st, nrout,
+                  cand.storage() + i*nrout);
+      }
+      heapTopN (T(cand.nelements()), cand.storage(), T(0), nrout, inx);
+    }
+    indexVector.putStorage (inx, del);
+    return nrout;
+  }
+
+  template<typename T>
+  void Sort::heapTopN (T nr, const T* cand, T start, T nrout, T* heap) const
+  {
+    // Use 1-based indexing as in heapSort.
+    T* hp = heap-1;
+    for (T i=0; i<nrout; ++i) {
+      heap[i] = (cand  ?  cand[i] : start+i);
+    }
+    // Build a heap whose root is the last record in the requested order.
+    T j;
+    for (j=nrout/2; j>=1; j--) {
+      siftDown (j, nrout, hp);
+    }
+    // Replace the root by each record that has to precede it.
+    for (T i=nrout; i<nr; ++i) {
+      T index = (cand  ?  cand[i] : start+i);
+      if (compare (index, hp[1]) > 0) {
+        hp[1] = index;
+        siftDown (T(1), nrout, hp);
+      }
+    }
+    // Sort the heap.
+    for (j=nrout; j>=2; j--) {
+      swap (T(1), j, hp);
+      siftDown (T(1), j-1, hp);
+    }
+  }
+
   template<typename T>
   T Sort::doUnique (Vector<T>& uniqueVector, T nrrec) const
   {
@@ -216,6 +317,155 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return nrrec;
   }  
 
+  template<typename T>
+  T Sort::radixSort (int nthr, T nrrec, T* inx) const
+  {
+    // Only use multiple threads if each thread has enough records.
+    T maxthr = std::max (T(1), T(nrrec / 65536));
+    if (T(nthr) > maxthr) nthr = maxthr;
+    // If all keys are descending, sort ascending and reverse the result,
+    // because compare puts equal keys in reversed order as well.
+    Bool reverse = (order_p == Descending);
+    Block<uInt64> values1(nrrec);
+    Block<uInt64> values2(nrrec);
+    Block<T> inxtmp(nrrec);
+    uInt64* val    = values1.storage();
+    uInt64* valtmp = values2.storage();
+    T* ind    = inx;
+    T* indtmp = inxtmp.storage();
+    // Histogram (thereafter output position) of the byte values per thread.
+    std::vector<T> hist(nthr*256);
+    T step = (nrrec + nthr - 1) / nthr;
+    // Start with the least significant key.
+    for (size_t k=nrkey_p; k>0; --k) {
+      const SortKey& key = *keys_p[k-1];
+      uInt nbytes = radixValues (key, !reverse && key.order_p == Descending,
+                                 nthr, nrrec, ind, val);
+      for (uInt b=0; b<nbytes; ++b) {
+        uInt shift = 8*b;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+        for (int t=0; t<nthr; ++t) {
+          T* hp = hist.data() + t*256;
+          std::fill (hp, hp+256, T(0));
+          T end = std::min (nrrec, T((t+1)*step));
+          for (T i=t*step; i<end; ++i) {
+            hp[(val[i] >> shift) & 255]++;
+          }
+        }
+        // Determine the output position of each byte value per thread.
+        // The byte can be skipped if it has the same value for all records.
+        T pos = 0;
+        Bool same = False;
+        for (uInt v=0; v<256 && !same; ++v) {
+          T nv = 0;
+          for (int t=0; t<nthr; ++t) {
+            T n = hist[t*256 + v];
+            hist[t*256 + v] = pos;
+            pos += n;
+            nv  += n;
+          }
+          same = (nv == nrrec);
+        }
+        if (same) {
+          continue;
+        }
+        // Move the records to their output position which keeps
+        // the order of equal bytes (thus the sort is stable).
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+        for (int t=0; t<nthr; ++t) {
+          T* hp = hist.data() + t*256;
+          T end = std::min (nrrec, T((t+1)*step));
+          for (T i=t*step; i<end; ++i) {
+            T p = hp[(val[i] >> shift) & 255]++;
+            valtmp[p] = val[i];
+            indtmp[p] = ind[i];
+          }
+        }
+        std::swap (val, valtmp);
+        std::swap (ind, indtmp);
+      }
+    }
+    if (ind != inx) {
+      std::copy (ind, ind+nrrec, inx);
+    }
+    if (reverse) {
+      std::reverse (inx, inx+nrrec);
+    }
+    return nrrec;
+  }
+
+  template<typename T>
+  uInt Sort::radixValues (const SortKey& key, Bool invert, int nthr,
+                          T nrrec, const T* inx, uInt64* values) const
+  {
+    switch (key.cmpObj_p->dataType()) {
+    case TpBool:
+      return radixFill<Bool> (key, invert, nthr, nrrec, inx, values);
+    case TpChar:
+      return radixFill<Char> (key, invert, nthr, nrrec, inx, values);
+    case TpUChar:
+      return radixFill<uChar> (key, invert, nthr, nrrec, inx, values);
+    case TpShort:
+      return radixFill<Short> (key, invert, nthr, nrrec, inx, values);
+    case TpUShort:
+      return radixFill<uShort> (key, invert, nthr, nrrec, inx, values);
+    case TpInt:
+      return radixFill<Int> (key, invert, nthr, nrrec, inx, values);
+    case TpUInt:
+      return radixFill<uInt> (key, invert, nthr, nrrec, inx, values);
+    case TpInt64:
+      return radixFill<Int64> (key, invert, nthr, nrrec, inx, values);
+    case TpFloat:
+      return radixFill<Float> (key, invert, nthr, nrrec, inx, values);
+    case TpDouble:
+      return radixFill<Double> (key, invert, nthr, nrrec, inx, values);
+    default:
+      throw SortInvOpt();
+    }
+  }
+
+  template<typename V, typename T>
+  uInt Sort::radixFill (const SortKey& key, Bool invert, int nthr,
+                        T nrrec, const T* inx, uInt64* values)
+  {
+    // The unsigned integer type with the size of the key.
+    typedef typename std::conditional<sizeof(V)==1, uChar,
+      typename std::conditional<sizeof(V)==2, uShort,
+      typename std::conditional<sizeof(V)==4, uInt,
+                                uInt64>::type>::type>::type U;
+    const U signBit = U(U(1) << (8*sizeof(U) - 1));
+    const U mask = (invert  ?  U(~U(0)) : U(0));
+    const char* data = static_cast<const char*>(key.data_p);
+    size_t incr = key.incr_p;
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nthr)
+#endif
+    for (Int64 i=0; i<Int64(nrrec); ++i) {
+      V v = *reinterpret_cast<const V*>(data + inx[i]*incr);
+      U u;
+      if constexpr (std::is_floating_point<V>::value) {
+        // Negative values have all bits inverted, others only the sign bit.
+        // -0 is the same as 0 and NaN is put after all other values.
+        if (std::isnan(v)) {
+          u = ~U(0);
+        } else {
+          if (v == 0) v = 0;
+          memcpy (&u, &v, sizeof(U));
+          u = ((u & signBit) != 0  ?  U(~u) : U(u | signBit));
+        }
+      } else {
+        // Flip the sign bit of signed integers.
+        u = U(U(v) ^ (std::is_signed<V>::value  ?  signBit : U(0)));
+      }
+      values[i] = U(u ^ mask);
+    }
+    return sizeof(U);
+  }
+
   template<typename T>
   void Sort::merge (T* inx, T* tmp, T nrrec, T* index,
                     T nparts) const
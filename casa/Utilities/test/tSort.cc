@@ -27,9 +27,11 @@
 
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/stdlib.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
 
 #include <casacore/casa/namespace.h>
 // This program test the class Sort.
@@ -282,12 +284,112 @@ void sort_test_unique()
     cout << endl;
 }
 
+// Test partialSort by comparing its result with the start of a full sort.
+// Many equal keys are used to check if the partial sort is stable.
+void sort_test_partial (Sort::Order order)
+{
+    const uInt64 nrdata = 100000;
+    Vector<Int> data(nrdata);
+    Vector<Double> data2(nrdata);
+    for (uInt64 i=0; i<nrdata; i++) {
+      data[i]  = rand()%50;
+      data2[i] = rand()%100;
+    }
+    Sort sort;
+    sort.sortKey (data.data(), TpInt, 0, order);
+    sort.sortKey (data2.data(), TpDouble);
+    Vector<uInt64> full;
+    sort.sort (full, nrdata);
+    uInt64 nrout[] = {0, 1, 7, 100, 2500, 30000, nrdata, nrdata+10};
+    for (uInt64 nr : nrout) {
+      Vector<uInt64> part;
+      uInt64 n = sort.partialSort (part, nrdata, nr);
+      AlwaysAssertExit (n == std::min(nr, nrdata));
+      AlwaysAssertExit (part.size() == n);
+      for (uInt64 i=0; i<n; i++) {
+        AlwaysAssertExit (part[i] == full[i]);
+      }
+    }
+    // Check with duplicates removed. Which of the equal records is kept
+    // is undefined, so only compare the keys.
+    Vector<uInt64> full1, part1;
+    uInt64 nfull = sort.sort (full1, nrdata, Sort::NoDuplicates);
+    uInt64 n = sort.partialSort (part1, nrdata, 10, Sort::NoDuplicates);
+    AlwaysAssertExit (nfull > 10  &&  n == 10);
+    for (uInt64 i=0; i<n; i++) {
+      AlwaysAssertExit (data[part1[i]] == data[full1[i]]  &&
+                        data2[part1[i]] == data2[full1[i]]);
+    }
+    cout << "partialSort ok" << endl;
+}
+
+// Test radixSort by comparing its result with the result of a quicksort
+// for keys of various types in ascending and/or descending order.
+void sort_test_radix (Sort::Order order1, Sort::Order order2)
+{
+    const uInt64 nrdata = 200000;
+    Vector<Short>  datas(nrdata);
+    Vector<Int64>  datal(nrdata);
+    Vector<uInt>   datau(nrdata);
+    Vector<Float>  dataf(nrdata);
+    Vector<Double> datad(nrdata);
+    Vector<Bool>   datab(nrdata);
+    Vector<String> datastr(nrdata);
+    for (uInt64 i=0; i<nrdata; i++) {
+      datas[i] = rand()%20 - 10;
+      datal[i] = (Int64(rand()%30) - 15) << 40;
+      datau[i] = rand()%1000 * 10000000;
+      dataf[i] = rand()%100 - 49.5;
+      datad[i] = (rand()%100 - 50) * 1e10;
+      datab[i] = rand()%2 == 0;
+      datastr[i] = String::toString (rand()%10);
+    }
+    // Check that -0 equals 0.
+    datad[0] = -0.;
+    datad[1] = 0.;
+    Sort sort1;
+    sort1.sortKey (datab.data(), TpBool, 0, order1);
+    sort1.sortKey (datas.data(), TpShort, 0, order2);
+    sort1.sortKey (datad.data(), TpDouble, 0, order1);
+    Sort sort2;
+    sort2.sortKey (dataf.data(), TpFloat, 0, order2);
+    sort2.sortKey (datal.data(), TpInt64, 0, order2);
+    sort2.sortKey (datau.data(), TpUInt, 0, order1);
+    Sort sort3;
+    sort3.sortKey (datad.data(), TpDouble, 0, order1);
+    // A string key cannot be handled by radix sort.
+    Sort sort4;
+    sort4.sortKey (datas.data(), TpShort, 0, order1);
+    sort4.sortKey (datastr.data(), TpString, 0, order2);
+    for (Sort* sort : {&sort1, &sort2, &sort3, &sort4}) {
+      Vector<uInt64> inx1, inx2;
+      sort->sort (inx1, nrdata, Sort::QuickSort, False);
+      sort->sort (inx2, nrdata, Sort::RadixSort, False);
+      AlwaysAssertExit (allEQ (inx1, inx2));
+      Vector<uInt> inx3;
+      sort->sort (inx3, uInt(nrdata), Sort::RadixSort);
+      for (uInt64 i=0; i<nrdata; i++) {
+        AlwaysAssertExit (inx3[i] == inx1[i]);
+      }
+      uInt64 n1 = sort->sort (inx1, nrdata,
+                              Sort::QuickSort | Sort::NoDuplicates);
+      uInt64 n2 = sort->sort (inx2, nrdata,
+                              Sort::RadixSort | Sort::NoDuplicates);
+      AlwaysAssertExit (n1 == n2  &&  n1 < nrdata);
+      Vector<uInt64> uniq;
+      sort->sort (inx1, nrdata, Sort::QuickSort);
+      AlwaysAssertExit (sort->unique (uniq, inx1) == n2);
+    }
+    cout << "radixSort ok" << endl;
+}
+
 int main()
 {
     sortit (Sort::InsSort);
     sortit (Sort::ParSort);
     sortit (Sort::QuickSort);
     sortit (Sort::HeapSort);
+    sortit (Sort::RadixSort);
 
     // Sort a longer array and check its result.
     sortall (Sort::InsSort, Sort::Ascending);
@@ -306,8 +408,17 @@ int main()
     sortall (Sort::ParSort | Sort::NoDuplicates, Sort::Descending);
     sortall (Sort::QuickSort | Sort::NoDuplicates, Sort::Descending);
     sortall (Sort::HeapSort | Sort::NoDuplicates, Sort::Descending);
+    sortall (Sort::RadixSort, Sort::Ascending);
+    sortall (Sort::RadixSort | Sort::NoDuplicates, Sort::Ascending);
+    sortall (Sort::RadixSort, Sort::Descending);
+    sortall (Sort::RadixSort | Sort::NoDuplicates, Sort::Descending);
 
     sort_test_unique();
+    sort_test_partial (Sort::Ascending);
+    sort_test_partial (Sort::Descending);
+    sort_test_radix (Sort::Ascending, Sort::Ascending);
+    sort_test_radix (Sort::Descending, Sort::Descending);
+    sort_test_radix (Sort::Ascending, Sort::Descending);
 
     return 0;                              // exit with success status
 }
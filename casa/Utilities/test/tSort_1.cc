@@ -27,6 +27,8 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/OS/Timer.h>
 #include <casacore/casa/sstream.h>
 #include <casacore/casa/stdlib.h>
@@ -110,7 +112,9 @@ int main(int argc, const char* argv[])
     delete [] a6;
     delete [] a7;
 
-    sort2 (nr);
+    if (! sort2 (nr)) {
+	success = False;
+    }
 
     if (success) {
 	return 0;
@@ -321,6 +325,43 @@ Bool sort2 (uInt nr)
     sort.sort (inx1, vec1.size(), Sort::ParSort);
     cout << "parsort2  ";
     timer.show();
+    timer.mark();
+    Vector<uInt> inx2;
+    sort.sort (inx2, vec1.size(), Sort::RadixSort);
+    cout << "radixsort2";
+    timer.show();
+    if (! (allEQ(inx, inx1)  &&  allEQ(inx, inx2))) {
+      cout << "Different results of sort on 2 keys" << endl;
+      return False;
+    }
+  }
+  {
+    // Sort on time (descending) and baseline like a MeasurementSet.
+    Vector<Double> times(vec1.size());
+    for (uInt i=0; i<times.size(); ++i) {
+      times[i] = 4.5e9 + 10*(rand()%nrt);
+    }
+    Sort sort;
+    sort.sortKey (times.data(), TpDouble, 0, Sort::Descending);
+    sort.sortKey (vec1.data(), TpInt);
+    sort.sortKey (vec2.data(), TpInt);
+    Vector<uInt> inx, inx1, inx2;
+    Timer timer;
+    sort.sort (inx, vec1.size(), Sort::QuickSort);
+    cout << "quicksort3";
+    timer.show();
+    timer.mark();
+    sort.sort (inx1, vec1.size(), Sort::ParSort);
+    cout << "parsort3  ";
+    timer.show();
+    timer.mark();
+    sort.sort (inx2, vec1.size(), Sort::RadixSort);
+    cout << "radixsort3";
+    timer.show();
+    if (! (allEQ(inx, inx1)  &&  allEQ(inx, inx2))) {
+      cout << "Different results of sort on 3 keys" << endl;
+      return False;
+    }
   }
   {
     Timer timer;
@@ -111,6 +111,10 @@ public:
     void showCacheStatistics (ostream& os) const
       { itsDataManager->showCacheStatistics (os); }
 
+    // Get IO statistics.
+    DataManIOStats ioStatistics() const
+      { return itsDataManager->ioStatistics(); }
+
 protected:
     // Get the data manager for the given data manager or column name.
     DataManager* baseDataManager() const
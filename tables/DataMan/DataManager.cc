@@ -162,6 +162,11 @@ void DataManager::setMaximumCacheSize (uInt)
 void DataManager::showCacheStatistics (ostream&) const
 {}
 
+DataManIOStats DataManager::ioStatistics() const
+{
+  return DataManIOStats();
+}
+
 void DataManager::setTsmOption (const TSMOption& tsmOption)
 {
   AlwaysAssert (!multiFile_p, AipsError);
@@ -307,6 +312,9 @@ Bool DataManager::canRemoveColumn() const
 Bool DataManager::canRenameColumn() const
     { return True; }
 
+Bool DataManager::canReadConcurrently() const
+    { return False; }
+
 void DataManager::addRow64 (rownr_t nrrow)
 {
   AlwaysAssert (nrrow < std::numeric_limits<uInt>::max(), AipsError);
@@ -71,6 +71,29 @@ typedef DataManager* (*DataManagerCtor) (const String& dataManagerType,
 // </group>
 
 
+// <summary>
+// IO statistics of a data manager
+// </summary>
+
+// <use visibility=export>
+
+// <synopsis>
+// DataManIOStats holds the number of bucket (or tile) accesses of a
+// storage manager, how many of them had to be read from the file, and the
+// number of bytes read. They are counted since the data manager was opened
+// (or since its statistics were initialized).
+// It is used by TaQL's PROFILE style to show the IO done in each step of
+// a query.
+// </synopsis>
+
+struct DataManIOStats
+{
+  uInt64 nAccess    = 0;
+  uInt64 nRead      = 0;
+  uInt64 nBytesRead = 0;
+};
+
+
 // <summary>
 // Abstract base class for a data manager
 // </summary>
@@ -343,6 +366,10 @@ public:
     // Does the data manager allow to rename columns? (default yes)
     virtual Bool canRenameColumn() const;
 
+    // Can the columns of the data manager be read by multiple threads
+    // at the same time? (default no)
+    virtual Bool canReadConcurrently() const;
+
     // Set the maximum cache size (in bytes) to be used by a storage manager.
     // The default implementation does nothing.
     virtual void setMaximumCacheSize (uInt nMiB);
@@ -350,6 +377,9 @@ public:
     // Show the data manager's IO statistics. By default it does nothing.
     virtual void showCacheStatistics (std::ostream&) const;
 
+    // Get the data manager's IO statistics. By default they are all zero.
+    virtual DataManIOStats ioStatistics() const;
+
     // Create a column in the data manager on behalf of a table column.
     // It calls makeXColumn and checks the data type.
     // <group>
@@ -309,6 +309,65 @@ void DataManagerColumn::putArrayColumnCellsV (const RefRows& rows,
 {
   putArrayColumnCellsBase (rows, arr);
 }
+const void* DataManagerColumn::getArrayColumnPtr (rownr_t, rownr_t)
+{
+  return 0;
+}
+Bool DataManagerColumn::getZoneMinMax (rownr_t, rownr_t&, rownr_t&,
+                                       Double&, Double&)
+{
+  return False;
+}
+
+template<typename T>
+static void updateMinMaxT (const T* data, rownr_t nr,
+                           Double& minVal, Double& maxVal)
+{
+  for (rownr_t i=0; i<nr; ++i) {
+    Double val = data[i];
+    //# NaN is ignored, because a comparison with NaN is always false.
+    if (val < minVal) minVal = val;
+    if (val > maxVal) maxVal = val;
+  }
+}
+
+Bool DataManagerColumn::updateMinMax (int dataType, const void* data,
+                                      rownr_t nr,
+                                      Double& minVal, Double& maxVal)
+{
+  switch (dataType) {
+  case TpChar:
+    updateMinMaxT (static_cast<const Char*>(data), nr, minVal, maxVal);
+    break;
+  case TpUChar:
+    updateMinMaxT (static_cast<const uChar*>(data), nr, minVal, maxVal);
+    break;
+  case TpShort:
+    updateMinMaxT (static_cast<const Short*>(data), nr, minVal, maxVal);
+    break;
+  case TpUShort:
+    updateMinMaxT (static_cast<const uShort*>(data), nr, minVal, maxVal);
+    break;
+  case TpInt:
+    updateMinMaxT (static_cast<const Int*>(data), nr, minVal, maxVal);
+    break;
+  case TpUInt:
+    updateMinMaxT (static_cast<const uInt*>(data), nr, minVal, maxVal);
+    break;
+  case TpInt64:
+    updateMinMaxT (static_cast<const Int64*>(data), nr, minVal, maxVal);
+    break;
+  case TpFloat:
+    updateMinMaxT (static_cast<const Float*>(data), nr, minVal, maxVal);
+    break;
+  case TpDouble:
+    updateMinMaxT (static_cast<const Double*>(data), nr, minVal, maxVal);
+    break;
+  default:
+    return False;
+  }
+  return True;
+}
 void DataManagerColumn::getSliceV (rownr_t rownr, const Slicer& slicer, ArrayBase& arr)
 {
   getSliceBase (rownr, slicer, arr);
@@ -366,6 +366,28 @@ public:
     virtual void getArrayColumnCellsV (const RefRows& rownrs,
 				       ArrayBase& data);
 
+    // Get a pointer to the array values in the given consecutive rows
+    // if the data manager holds them contiguously in memory in local
+    // format, so they can be used without copying (e.g. memory-mapped).
+    // All arrays in the rows must have the same shape.
+    // The pointer is valid until the column is written, rows are added
+    // or removed, or the table is closed.
+    // The default implementation returns a null pointer, meaning that
+    // the data have to be copied.
+    virtual const void* getArrayColumnPtr (rownr_t startRow, rownr_t nrow);
+
+    // Get the minimum and maximum value in the zone of rows (e.g. a bucket)
+    // containing the given row of a numeric scalar column.
+    // The zone is returned as its first and last row number.
+    // NaN values are ignored, so <src>minVal > maxVal</src> if the zone
+    // only contains NaN values.
+    // It makes it possible to skip entire zones when selecting rows.
+    // The default implementation returns False, meaning that the data
+    // manager does not have such statistics.
+    virtual Bool getZoneMinMax (rownr_t rownr, rownr_t& startRow,
+                                rownr_t& endRow, Double& minVal,
+                                Double& maxVal);
+
     // Put some array values in the column.
     // The array given in <src>data</src> has to have the correct shape
     // (which is guaranteed by the ArrayColumn getColumn function).
@@ -430,6 +452,13 @@ public:
       { return colName_p; }
 
 protected:
+    // Update the minimum and maximum with the given values of a numeric
+    // data type (Bool, complex and String are not numeric).
+    // NaN values are ignored.
+    // It returns False if the data type is not numeric.
+    static Bool updateMinMax (int dataType, const void* data, rownr_t nr,
+                              Double& minVal, Double& maxVal);
+
     // Get the scalar value in the given row.
     // The default implementation throws an "invalid operation" exception.
     // <group>
@@ -35,13 +35,16 @@
 #include <casacore/casa/Utilities/ValType.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
 #include <casacore/casa/IO/LECanonicalIO.h>
 #include <casacore/casa/IO/FiledesIO.h>
 #include <casacore/casa/OS/DOos.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/ostream.h>
+#include <algorithm>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -53,6 +56,7 @@ ISMBase::ISMBase (uInt bucketSize, Bool checkBucketSize, uInt cacheSize)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  concurrentCache_p (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (cacheSize),
@@ -74,6 +78,7 @@ ISMBase::ISMBase (const String& dataManagerName,
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  concurrentCache_p (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (cacheSize),
@@ -94,6 +99,7 @@ ISMBase::ISMBase (const String& dataManagerName, const Record& spec)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  concurrentCache_p (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (1),
@@ -124,6 +130,7 @@ ISMBase::ISMBase (const ISMBase& that)
   iosfile_p         (0),
   uniqnr_p          (0),
   cache_p           (0),
+  concurrentCache_p (0),
   file_p            (0),
   index_p           (0),
   persCacheSize_p   (that.persCacheSize_p),
@@ -143,6 +150,7 @@ ISMBase::~ISMBase()
 	delete colSet_p[i];
     }
     delete index_p;
+    delete concurrentCache_p;
     delete cache_p;
     delete file_p;
     delete [] tempBuffer_p;
@@ -192,6 +200,9 @@ void ISMBase::clearCache()
     if (cache_p != 0) {
 	cache_p->clear();
     }
+    if (concurrentCache_p != 0) {
+	concurrentCache_p->clear();
+    }
 }
 
 void ISMBase::showCacheStatistics (ostream& os) const
@@ -201,6 +212,64 @@ void ISMBase::showCacheStatistics (ostream& os) const
 	cache_p->showStatistics (os);
 	os << "<<<" << endl;
     }
+    if (concurrentCache_p != 0) {
+	os << ">>> IncrementalStMan concurrent cache statistics:" << endl;
+	concurrentCache_p->showStatistics (os);
+	os << "<<<" << endl;
+    }
+}
+
+DataManIOStats ISMBase::ioStatistics() const
+{
+    DataManIOStats stats;
+    if (cache_p != 0) {
+	stats.nAccess    += cache_p->nAccess();
+	stats.nRead      += cache_p->nRead();
+	stats.nBytesRead += uInt64(cache_p->nRead()) * cache_p->bucketSize();
+    }
+    if (concurrentCache_p != 0) {
+	stats.nAccess    += concurrentCache_p->nAccess();
+	stats.nRead      += concurrentCache_p->nRead();
+	stats.nBytesRead += uInt64(concurrentCache_p->nRead()) *
+	                    concurrentCache_p->bucketSize();
+    }
+    return stats;
+}
+
+Bool ISMBase::canReadConcurrently() const
+{
+    return isConcurrentRead();
+}
+
+void ISMBase::setConcurrentRead (Bool concurrentRead)
+{
+    if (concurrentRead == isConcurrentRead()) {
+	return;
+    }
+    if (concurrentRead) {
+	if (table().isWritable()) {
+	    throw DataManError ("IncrementalStMan " + dataManName_p +
+				": concurrent read mode can only be used for "
+				"a table opened readonly");
+	}
+	// Make sure the file is opened and the index is read.
+	BucketCache& cache = getCache();
+	// Each thread pins a single bucket at a time, so make sure there are
+	// sufficient slots for all threads.
+	uInt cacheSize = std::max(cacheSize_p, 2*uInt(OMP::maxThreads()) + 2);
+	concurrentCache_p = new ConcurrentBucketCache (file_p, 512, bucketSize_p,
+						       cache.nBucket(),
+						       cacheSize, this,
+						       ISMBucket::readCallBack,
+						       ISMBucket::deleteCallBack);
+    } else {
+	delete concurrentCache_p;
+	concurrentCache_p = 0;
+    }
+    // The column caches cannot be used by multiple threads.
+    for (uInt i=0; i<ncolumn(); i++) {
+	colSet_p[i]->columnCache().invalidate();
+    }
 }
 
 void ISMBase::showIndexStatistics (ostream& os)
@@ -270,6 +339,10 @@ void ISMBase::setCacheSize (uInt cacheSize, Bool canExceedNrBuckets)
     if (cache_p != 0) {
 	cache_p->resize (cacheSize_p);
     }
+    if (concurrentCache_p != 0) {
+	concurrentCache_p->resize (std::max(cacheSize_p,
+				       concurrentCache_p->cacheSize()));
+    }
 }
 
 void ISMBase::makeCache()
@@ -404,6 +477,22 @@ ISMBucket* ISMBase::getBucket (rownr_t rownr, rownr_t& bucketStartRow,
     return (ISMBucket*) (getCache().getBucket (bucketNr));
 }
 
+const ISMBucket* ISMBase::getBucketPinned (rownr_t rownr,
+					   rownr_t& bucketStartRow,
+					   rownr_t& bucketNrrow, uInt& slotNr)
+{
+    // The index is only read, so it can be used by multiple threads.
+    uInt bucketNr = index_p->getBucketNr (rownr, bucketStartRow,
+					  bucketNrrow);
+    return (const ISMBucket*) (concurrentCache_p->pinBucket (bucketNr,
+							     slotNr));
+}
+
+void ISMBase::unpinBucket (uInt slotNr)
+{
+    concurrentCache_p->unpinBucket (slotNr);
+}
+
 ISMBucket* ISMBase::nextBucket (uInt& cursor, rownr_t& bucketStartRow,
 				rownr_t& bucketNrrow)
 {
@@ -529,6 +618,8 @@ void ISMBase::removeColumn (DataManagerColumn* colp)
 
 void ISMBase::recreate()
 {
+    delete concurrentCache_p;
+    concurrentCache_p = 0;
     delete index_p;
     index_p = 0;
     delete cache_p;
@@ -590,6 +681,9 @@ rownr_t ISMBase::resync64 (rownr_t nrrow)
     if (cache_p != 0) {
 	cache_p->resync (nbucketInit_p, nFreeBucket_p, firstFree_p);
     }
+    if (concurrentCache_p != 0) {
+	concurrentCache_p->resync (cache_p->nBucket());
+    }
     uInt nrcol = ncolumn();
     for (uInt i=0; i<nrcol; i++) {
 	colSet_p[i]->resync (nrrow_p);
@@ -645,6 +739,8 @@ StManArrayFile* ISMBase::openArrayFile (ByteIO::OpenOption opt)
 
 void ISMBase::reopenRW()
 {
+    // The concurrent cache can only be used for reading.
+    setConcurrentRead (False);
     file_p->setRW();
     uInt nrcol = ncolumn();
     for (uInt i=0; i<nrcol; i++) {
@@ -654,6 +750,8 @@ void ISMBase::reopenRW()
 
 void ISMBase::deleteManager()
 {
+    delete concurrentCache_p;
+    concurrentCache_p = 0;
     delete iosfile_p;
     iosfile_p = 0;
     // Clear cache without flushing.
@@ -32,12 +32,14 @@
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/iosfwd.h>
+#include <mutex>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 //# Forward declarations
 class BucketCache;
 class BucketFile;
+class ConcurrentBucketCache;
 class ISMBucket;
 class ISMIndex;
 class ISMColumn;
@@ -65,6 +67,16 @@ class StManArrayFile;
 // <synopsis>
 // The behaviour of this class is described in
 // <linkto class="IncrementalStMan:description">IncrementalStMan</linkto>.
+// <p>
+// A table opened readonly can be read by multiple threads at the same time
+// after switching on concurrent read mode with
+// <src>setConcurrentRead</src>. In that mode the buckets are accessed
+// using a <linkto class=ConcurrentBucketCache>ConcurrentBucketCache</linkto>,
+// so scalar columns can be read in parallel. The accesses to array
+// columns are serialized.
+// <br>Note that the table locking is not thread-safe, so the table should
+// be opened without read locking (e.g. TableLock::UserNoReadLocking).
+// </synopsis>
 
 // <motivation>
 // The public interface of ISMBase is quite large, because the other
@@ -154,6 +166,25 @@ public:
     // Show the statistics of all caches used.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Get the IO statistics of all caches used.
+    virtual DataManIOStats ioStatistics() const;
+
+    // Switch the concurrent read mode on or off (see the synopsis).
+    // It can only be switched on if the table is not writable.
+    // It is switched off automatically when the table is reopened for
+    // read/write.
+    void setConcurrentRead (Bool concurrentRead);
+
+    // Is the concurrent read mode on?
+    Bool isConcurrentRead() const;
+
+    // The columns can be read by multiple threads in concurrent read mode.
+    virtual Bool canReadConcurrently() const;
+
+    // Get a lock to serialize the accesses that cannot be done by multiple
+    // threads. The lock is only acquired in concurrent read mode.
+    std::unique_lock<std::recursive_mutex> concurrentLock();
+
     // Show the index statistics.
     void showIndexStatistics (ostream& os);
 
@@ -175,6 +206,16 @@ public:
     ISMBucket* getBucket (rownr_t rownr, rownr_t& bucketStartRow,
 			  rownr_t& bucketNrrow);
 
+    // Get the bucket containing the given row from the concurrent cache
+    // and pin it. Also return the first and last row of that bucket and
+    // the slot to be used to unpin it.
+    // It can only be used in concurrent read mode.
+    const ISMBucket* getBucketPinned (rownr_t rownr, rownr_t& bucketStartRow,
+                                      rownr_t& bucketNrrow, uInt& slotNr);
+
+    // Unpin a bucket pinned by <src>getBucketPinned</src>.
+    void unpinBucket (uInt slotNr);
+
     // Get the next bucket.
     // cursor=0 indicates the start of the iteration.
     // The first bucket returned is the bucket containing the rownr
@@ -353,6 +394,10 @@ private:
     PtrBlock<ISMColumn*>  colSet_p;
     // The cache with the ISM buckets.
     BucketCache* cache_p;
+    // The cache used in concurrent read mode (0 if not in that mode).
+    ConcurrentBucketCache* concurrentCache_p;
+    // The mutex serializing the other accesses in concurrent read mode.
+    std::recursive_mutex concurrentMutex_p;
     // The file containing all data.
     BucketFile*  file_p;
     // The ISM bucket index.
@@ -392,6 +437,19 @@ inline uInt ISMBase::cacheSize() const
     return cacheSize_p;
 }
 
+inline Bool ISMBase::isConcurrentRead() const
+{
+    return concurrentCache_p != 0;
+}
+
+inline std::unique_lock<std::recursive_mutex> ISMBase::concurrentLock()
+{
+    if (concurrentCache_p != 0) {
+	return std::unique_lock<std::recursive_mutex> (concurrentMutex_p);
+    }
+    return std::unique_lock<std::recursive_mutex>();
+}
+
 inline uInt ISMBase::uniqueNr()
 {
     return uniqnr_p++;
@@ -111,12 +111,13 @@ uInt& ISMBucket::getOffset (uInt colnr, rownr_t rownr)
 }
 
 uInt ISMBucket::getInterval (uInt colnr, rownr_t rownr, rownr_t bucketNrrow,
-			     rownr_t& start, rownr_t& end, uInt& offset) const
+			     rownr_t& start, rownr_t& end, uInt& offset,
+                             uInt lower) const
 {
     Block<rownr_t>& rowIndex = *(rowIndex_p[colnr]);
     Bool found;
     uInt inx = binarySearchBrackets (found, rowIndex,
-				     rownr, indexUsed_p[colnr]);
+				     rownr, indexUsed_p[colnr] - lower, lower);
     uInt index = inx;
     // If no exact match, start of interval is previous index.
     if (!found) {
@@ -151,8 +151,11 @@ public:
     // and the offset of its current value.
     // It returns the index where the row number can be put in the
     // bucket index.
+    // The search in the bucket index starts at index <src>lower</src>,
+    // which can be used to speed up accessing rows in ascending order.
     uInt getInterval (uInt colnr, rownr_t rownr, rownr_t bucketNrrow,
-		      rownr_t& start, rownr_t& end, uInt& offset) const;
+		      rownr_t& start, rownr_t& end, uInt& offset,
+                      uInt lower = 0) const;
 
     // Is the bucket large enough to add a value?
     Bool canAddData (uInt leng) const;
@@ -35,6 +35,8 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <algorithm>
+#include <limits>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -120,6 +122,50 @@ IPosition ISMColumn::shape (rownr_t)
     return shape_p;
 }
 
+Bool ISMColumn::getZoneMinMax (rownr_t rownr, rownr_t& startRow,
+                               rownr_t& endRow, Double& minVal,
+                               Double& maxVal)
+{
+    // Only scalars of a numeric type can be handled.
+    // Buckets cannot be accessed this way in concurrent read mode.
+    if (! isFixedShape()  ||  shape_p.nelements() > 0
+    ||  stmanPtr_p->isConcurrentRead()) {
+        return False;
+    }
+    switch (dataType()) {
+    case TpBool:
+    case TpComplex:
+    case TpDComplex:
+    case TpString:
+        return False;
+    default:
+        break;
+    }
+    rownr_t bucketStartRow;
+    rownr_t bucketNrrow;
+    ISMBucket* bucket = stmanPtr_p->getBucket (rownr, bucketStartRow,
+					       bucketNrrow);
+    startRow = bucketStartRow;
+    endRow   = bucketStartRow + bucketNrrow - 1;
+    minVal   = std::numeric_limits<Double>::infinity();
+    maxVal   = -minVal;
+    // Each value in the bucket is only stored once for a run of rows.
+    const Block<uInt>& offIndex = bucket->offIndex (colnr_p);
+    uInt nused = bucket->indexUsed (colnr_p);
+    // Read the values into a buffer aligned and large enough for each
+    // of the numeric data types, so it can be used as such by updateMinMax.
+    alignas(Double) alignas(Int64) char value[sizeof(Double)];
+    static_assert (sizeof(Int64) <= sizeof(value),
+                   "buffer too small for Int64");
+    for (uInt i=0; i<nused; ++i) {
+        readFunc_p (value, bucket->get (offIndex[i]), nrcopy_p);
+        if (! updateMinMax (dataType(), value, 1, minVal, maxVal)) {
+            return False;
+        }
+    }
+    return True;
+}
+
 
 void ISMColumn::addRow (rownr_t, rownr_t)
 {
@@ -178,67 +224,116 @@ void ISMColumn::remove (rownr_t bucketRownr, ISMBucket* bucket, rownr_t bucketNr
 
 void ISMColumn::getBool (rownr_t rownr, Bool* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Bool*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(Bool*)lastValue_p;
+    }
 }
 void ISMColumn::getuChar (rownr_t rownr, uChar* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uChar*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(uChar*)lastValue_p;
+    }
 }
 void ISMColumn::getShort (rownr_t rownr, Short* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Short*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(Short*)lastValue_p;
+    }
 }
 void ISMColumn::getuShort (rownr_t rownr, uShort* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uShort*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(uShort*)lastValue_p;
+    }
 }
 void ISMColumn::getInt (rownr_t rownr, Int* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Int*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(Int*)lastValue_p;
+    }
 }
 void ISMColumn::getuInt (rownr_t rownr, uInt* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(uInt*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(uInt*)lastValue_p;
+    }
 }
 void ISMColumn::getInt64 (rownr_t rownr, Int64* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Int64*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(Int64*)lastValue_p;
+    }
 }
 void ISMColumn::getfloat (rownr_t rownr, float* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(float*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(float*)lastValue_p;
+    }
 }
 void ISMColumn::getdouble (rownr_t rownr, double* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(double*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(double*)lastValue_p;
+    }
 }
 void ISMColumn::getComplex (rownr_t rownr, Complex* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(Complex*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(Complex*)lastValue_p;
+    }
 }
 void ISMColumn::getDComplex (rownr_t rownr, DComplex* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(DComplex*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(DComplex*)lastValue_p;
+    }
 }
 void ISMColumn::getString (rownr_t rownr, String* value)
 {
-    getValue (rownr, lastValue_p, True);
-    *value = *(String*)lastValue_p;
+    if (stmanPtr_p->isConcurrentRead()) {
+	getValuePinned (rownr, value);
+    } else {
+	getValue (rownr, lastValue_p, True);
+	*value = *(String*)lastValue_p;
+    }
 }
 
 void ISMColumn::getScalarColumnV (ArrayBase& dataPtr)
 {
+  std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
   switch (dtype()) {
   case TpBool:
     getScaCol (static_cast<Vector<Bool>&>(dataPtr));
@@ -283,6 +378,7 @@ void ISMColumn::getScalarColumnV (ArrayBase& dataPtr)
 
 void ISMColumn::getScalarColumnCellsV (const RefRows& rows, ArrayBase& dataPtr)
 {
+  std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
   switch (dtype()) {
   case TpBool:
     getScaColCells (rows, static_cast<Vector<Bool>&>(dataPtr));
@@ -325,6 +421,70 @@ void ISMColumn::getScalarColumnCellsV (const RefRows& rows, ArrayBase& dataPtr)
   }
 }
 
+template<typename T>
+void ISMColumn::getScaColCellsSorted (const rownr_t* rownrs, rownr_t nrow,
+                                      T* values)
+{
+    // In concurrent read mode the value cache cannot be used.
+    Bool concurrent = stmanPtr_p->isConcurrentRead();
+    T value;
+    T* valuePtr = &value;
+    rownr_t stint = 1;
+    rownr_t endint = 0;
+    if (!concurrent) {
+        valuePtr = static_cast<T*>(lastValue_p);
+        stint    = startRow_p;
+        endint   = endRow_p;
+    }
+    rownr_t i = 0;
+    while (i < nrow) {
+        // Use the current value for the rows in its interval.
+        while (i < nrow  &&  rownrs[i] >= stint  &&  rownrs[i] <= endint) {
+            values[i++] = *valuePtr;
+        }
+        if (i == nrow) {
+            break;
+        }
+        // Get the bucket containing the next row and handle all rows in it.
+        rownr_t bucketStartRow;
+        rownr_t bucketNrrow;
+        uInt slotNr = 0;
+        const ISMBucket* bucket;
+        if (concurrent) {
+            bucket = stmanPtr_p->getBucketPinned (rownrs[i], bucketStartRow,
+                                                  bucketNrrow, slotNr);
+        } else {
+            bucket = stmanPtr_p->getBucket (rownrs[i], bucketStartRow,
+                                            bucketNrrow);
+        }
+        rownr_t bucketEndRow = bucketStartRow + bucketNrrow;
+        uInt lower = 0;
+        while (i < nrow  &&  rownrs[i] < bucketEndRow) {
+            uInt offset;
+            uInt index = bucket->getInterval (colnr_p,
+                                              rownrs[i] - bucketStartRow,
+                                              bucketNrrow, stint, endint,
+                                              offset, lower);
+            lower = (index > 0  ?  index-1 : 0);
+            readFunc_p (valuePtr, bucket->get (offset), nrcopy_p);
+            stint  += bucketStartRow;
+            endint += bucketStartRow;
+            while (i < nrow  &&  rownrs[i] <= endint) {
+                values[i++] = *valuePtr;
+            }
+        }
+        if (concurrent) {
+            stmanPtr_p->unpinBucket (slotNr);
+        } else {
+            startRow_p = stint;
+            endRow_p   = endint;
+        }
+    }
+    if (!concurrent) {
+        columnCache().set (startRow_p, endRow_p, lastValue_p);
+    }
+}
+
 #define ISMCOLUMN_GET(T) \
 void ISMColumn::getScaCol (Vector<T>& dataPtr) \
 { \
@@ -370,23 +530,27 @@ void ISMColumn::getScaColCells (const RefRows& rownrs, \
         if (nr > 0) { \
             Bool delR; \
             const rownr_t* rows = rowvec.getStorage (delR); \
-            if (isLastValueInvalid (rows[0])) { \
-                aips_name2(get,T) (0, &(value[0])); \
+            if (std::is_sorted (rows, rows+nr)) { \
+                getScaColCellsSorted (rows, nr, value); \
+            } else { \
+                if (isLastValueInvalid (rows[0])) { \
+                    aips_name2(get,T) (rows[0], &(value[0])); \
+                } \
+                const T* cacheValue = (const T*)(lastValue_p); \
+                rownr_t strow = startRow_p; \
+                rownr_t endrow = endRow_p; \
+                for (rownr_t i=0; i<nr; i++) { \
+                    rownr_t rownr = rows[i]; \
+                    if (rownr >= strow  &&  rownr <= endrow) { \
+                        value[i] = *cacheValue; \
+                    } else { \
+                        aips_name2(get,T) (rownr, &(value[i])); \
+                        cacheValue = (const T*)(lastValue_p); \
+                        strow = startRow_p; \
+                        endrow = endRow_p; \
+                    } \
+                } \
             } \
-            const T* cacheValue = (const T*)(lastValue_p); \
-            rownr_t strow = startRow_p; \
-            rownr_t endrow = endRow_p; \
-            for (rownr_t i=0; i<nr; i++) { \
-	        rownr_t rownr = rows[i]; \
-                if (rownr >= strow  &&  rownr <= endrow) { \
-	            value[i] = *cacheValue; \
-	        } else { \
-	            aips_name2(get,T) (rownr, &(value[i])); \
-                    cacheValue = (const T*)(lastValue_p); \
-                    strow = startRow_p; \
-                    endrow = endRow_p; \
-	        } \
-	    } \
             rowvec.freeStorage (rows, delR); \
         } \
     } \
@@ -429,6 +593,25 @@ void ISMColumn::getValue (rownr_t rownr, void* value, Bool setCache)
   }
 }
 
+void ISMColumn::getValuePinned (rownr_t rownr, void* value)
+{
+    // Get the bucket with its row number boundaries.
+    rownr_t bucketStartRow;
+    rownr_t bucketNrrow;
+    uInt slotNr;
+    const ISMBucket* bucket = stmanPtr_p->getBucketPinned (rownr,
+							   bucketStartRow,
+							   bucketNrrow,
+							   slotNr);
+    // Get the interval in the bucket and read the value.
+    rownr -= bucketStartRow;
+    uInt offset;
+    rownr_t stint, endint;
+    bucket->getInterval (colnr_p, rownr, bucketNrrow, stint, endint, offset);
+    readFunc_p (value, bucket->get (offset), nrcopy_p);
+    stmanPtr_p->unpinBucket (slotNr);
+}
+
 void ISMColumn::putBool (rownr_t rownr, const Bool* value)
 {
     putValue (rownr, value);
@@ -610,6 +793,7 @@ void ISMColumn::putScaCol (const Vector<String>& dataPtr)
 
 void ISMColumn::getArrayV (rownr_t rownr, ArrayBase& value)
 {
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
     getValue (rownr, lastValue_p, False);
     if (dtype() == TpString) {
       value.assignBase (Array<String> (shape_p, (String*)lastValue_p, SHARE));
@@ -137,6 +137,13 @@ public:
     // This is the same for all rows.
     virtual IPosition shape (rownr_t rownr);
 
+    // Get the minimum and maximum value in the bucket containing the row.
+    // They are determined from the (run-length encoded) values in the
+    // bucket, so only the distinct values are examined.
+    virtual Bool getZoneMinMax (rownr_t rownr, rownr_t& startRow,
+                                rownr_t& endRow, Double& minVal,
+                                Double& maxVal);
+
     // Let the column object initialize itself for a newly created table.
     // This is meant for a derived class.
     virtual void doCreate (ISMBucket*);
@@ -251,6 +258,17 @@ protected:
     // Set the cache if the flag is set.
     void getValue (rownr_t rownr, void* value, Bool setCache);
 
+    // Get the scalar value for this row from the pinned bucket in
+    // concurrent read mode. The column cache is not used.
+    void getValuePinned (rownr_t rownr, void* value);
+
+    // Get the scalar values for the given rows, which must be in
+    // ascending order. Each bucket is looked up only once and the
+    // intervals in it are searched from the previous interval onwards.
+    template<typename T>
+    void getScaColCellsSorted (const rownr_t* rownrs, rownr_t nrow,
+                               T* values);
+
     // Put the value for this row.
     void putValue (rownr_t rownr, const void* value);
 
@@ -35,6 +35,8 @@
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
 #include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/casa/Arrays/ArrayPosIter.h>
 
 #include <casacore/casa/stdio.h>                     // for snprintf
 
@@ -187,13 +189,22 @@ StIndArray* ISMIndColumn::putShapeSliced (rownr_t rownr)
 }
 
 Bool ISMIndColumn::isShapeDefined (rownr_t rownr)
-    { return (getArrayPtr(rownr) == 0  ?  False : True); }
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    return (getArrayPtr(rownr) == 0  ?  False : True);
+}
 
 uInt ISMIndColumn::ndim (rownr_t rownr)
-    { return getShape(rownr)->shape().nelements(); }
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    return getShape(rownr)->shape().nelements();
+}
 
 IPosition ISMIndColumn::shape (rownr_t rownr)
-    { return getShape(rownr)->shape(); }
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    return getShape(rownr)->shape();
+}
 
 Bool ISMIndColumn::canChangeShape() const
     { return (shapeIsFixed_p  ?  False : True); }
@@ -240,14 +251,45 @@ StIndArray* ISMIndColumn::putArrayPtr (rownr_t rownr, const IPosition& shape,
 
 
 void ISMIndColumn::getArrayV (rownr_t rownr, ArrayBase& arr)
-    { getShape(rownr)->getArrayV (*iosfile_p, arr, dtype()); }
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    getShape(rownr)->getArrayV (*iosfile_p, arr, dtype());
+}
+
+void ISMIndColumn::getArrayColumnCellsV (const RefRows& rownrs,
+                                         ArrayBase& arr)
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    RowNumbers rows = rownrs.convert();
+    std::unique_ptr<ArrayPositionIterator> iter =
+                                     arr.makeIterator (arr.ndim()-1);
+    std::unique_ptr<ArrayBase> value;
+    for (rownr_t i=0; i<rows.size(); ++i) {
+        ArrayBase& cell = iter->getArray();
+        if (value  &&  !isLastValueInvalid (rows[i])) {
+            cell.assignBase (*value, False);
+        } else {
+            getShape(rows[i])->getArrayV (*iosfile_p, cell, dtype());
+            // Keep the array if the next row is in the same interval.
+            value.reset();
+            if (i+1 < rows.size()  &&  !isLastValueInvalid (rows[i+1])) {
+                value = cell.makeArray();
+                value->assignBase (cell, False);
+            }
+        }
+        iter->next();
+    }
+}
 
 void ISMIndColumn::putArrayV (rownr_t rownr, const ArrayBase& arr)
     { putShape(rownr, arr.shape())->putArrayV (*iosfile_p, arr, dtype()); }
 
 void ISMIndColumn::getSliceV (rownr_t rownr, const Slicer& ns,
                               ArrayBase& arr)
-    { getShape(rownr)->getSliceV (*iosfile_p, ns, arr, dtype()); }
+{
+    std::unique_lock<std::recursive_mutex> lock = stmanPtr_p->concurrentLock();
+    getShape(rownr)->getSliceV (*iosfile_p, ns, arr, dtype());
+}
 
 void ISMIndColumn::putSliceV (rownr_t rownr, const Slicer& ns,
                               const ArrayBase& arr)
@@ -143,6 +143,11 @@ public:
     // (which is guaranteed by the ArrayColumn put function).
     virtual void putArrayV (rownr_t rownr, const ArrayBase&);
 
+    // Get the array values in some cells of the column.
+    // Rows in the same interval share the same array, so it is read only
+    // once and copied for the subsequent rows in the interval.
+    virtual void getArrayColumnCellsV (const RefRows& rownrs, ArrayBase&);
+
     // Get a section of the array in the given row.
     // The array has to have the correct length
     // (which is guaranteed by the ArrayColumn getSlice function).
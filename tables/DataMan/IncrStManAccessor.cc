@@ -80,6 +80,16 @@ void ROIncrementalStManAccessor::clearCache()
     dataManPtr_p->clearCache();
 }
 
+void ROIncrementalStManAccessor::setConcurrentRead (Bool concurrentRead)
+{
+    dataManPtr_p->setConcurrentRead (concurrentRead);
+}
+
+Bool ROIncrementalStManAccessor::isConcurrentRead() const
+{
+    return dataManPtr_p->isConcurrentRead();
+}
+
 void ROIncrementalStManAccessor::showIndexStatistics (ostream& os) const
 {
     dataManPtr_p->showIndexStatistics (os);
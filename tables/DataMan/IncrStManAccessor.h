@@ -135,6 +135,15 @@ public:
     // resulting in a possibly large drop in memory used.
     void clearCache();
 
+    // Switch the concurrent read mode on or off.
+    // In that mode the storage manager can be read by multiple threads
+    // at the same time. It can only be used for a table opened readonly
+    // (without read locking).
+    void setConcurrentRead (Bool concurrentRead);
+
+    // Is the concurrent read mode on?
+    Bool isConcurrentRead() const;
+
     // Show the index used by this storage manager.
     void showIndexStatistics (ostream& os) const;
 
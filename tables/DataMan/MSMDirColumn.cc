@@ -102,6 +102,13 @@ void MSMDirColumn::getArrayV (rownr_t rownr, ArrayBase& arr)
     }
     arr.putVStorage (data, deleteIt);
 }
+const void* MSMDirColumn::getArrayColumnPtr (rownr_t startRow, rownr_t nrow)
+{
+    if (nrow != 1) {
+      return 0;
+    }
+    return getArrayPtr (startRow);
+}
 void MSMDirColumn::putArrayV (rownr_t rownr, const ArrayBase& arr)
 {
     DebugAssert (shape_p.isEqual (arr.shape()), AipsError);
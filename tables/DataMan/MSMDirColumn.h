@@ -94,6 +94,11 @@ public:
   // The buffer given by <src>arr</src> has to have the correct length
   // (which is guaranteed by the ArrayColumn get function).
   virtual void getArrayV (rownr_t rownr, ArrayBase& arr);
+
+  // Get a pointer to the array values in the given consecutive rows.
+  // Because each row is allocated separately, it can only be done
+  // for a single row.
+  virtual const void* getArrayColumnPtr (rownr_t startRow, rownr_t nrow);
   
   // Put an array value into the given row.
   // The buffer given by <src>arr</src> has to have the correct length
@@ -38,6 +38,8 @@
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/IO/BucketCache.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/casa/IO/BucketMapped.h>
+#include <casacore/casa/IO/ConcurrentBucketCache.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/IO/MemoryIO.h>
 #include <casacore/casa/IO/CanonicalIO.h>
@@ -45,6 +47,7 @@
 #include <casacore/casa/IO/FilebufIO.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/DOos.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/DataMan/DataManError.h>
 #include <casacore/casa/iostream.h>
@@ -58,6 +61,9 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsConcurrentCache   (0),
+  itsMappedFile        (0),
+  itsMappedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
@@ -72,7 +78,8 @@ SSMBase::SSMBase (Int aBucketSize, uInt aCacheSize)
   itsFirstFreeBucket   (-1),
   itsBucketSize        (0),
   itsBucketRows        (0),
-  isDataChanged        (False)
+  isDataChanged        (False),
+  itsChangeCount       (0)
 { 
   if (aBucketSize < 0) {
     itsBucketRows = -aBucketSize;
@@ -90,6 +97,9 @@ SSMBase::SSMBase (const String& aDataManName,
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsConcurrentCache   (0),
+  itsMappedFile        (0),
+  itsMappedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (std::max(aCacheSize,uInt(2))),
@@ -104,7 +114,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsFirstFreeBucket   (-1),
   itsBucketSize        (0),
   itsBucketRows        (0),
-  isDataChanged        (False)
+  isDataChanged        (False),
+  itsChangeCount       (0)
 { 
   if (aBucketSize < 0) {
     itsBucketRows = -aBucketSize;
@@ -122,6 +133,9 @@ SSMBase::SSMBase (const String& aDataManName,
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsConcurrentCache   (0),
+  itsMappedFile        (0),
+  itsMappedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (2),
@@ -136,7 +150,8 @@ SSMBase::SSMBase (const String& aDataManName,
   itsFirstFreeBucket   (-1),
   itsBucketSize        (0),
   itsBucketRows        (0),
-  isDataChanged        (False)
+  isDataChanged        (False),
+  itsChangeCount       (0)
 { 
   // Get nr of rows per bucket if defined.
   if (spec.isDefined ("BUCKETROWS")) {
@@ -163,6 +178,9 @@ SSMBase::SSMBase (const SSMBase& that)
   itsIosFile           (0),
   itsNrRows            (0),
   itsCache             (0),
+  itsConcurrentCache   (0),
+  itsMappedFile        (0),
+  itsMappedCache       (0),
   itsFile              (0),
   itsStringHandler     (0),
   itsPersCacheSize     (that.itsPersCacheSize),
@@ -177,7 +195,8 @@ SSMBase::SSMBase (const SSMBase& that)
   itsFirstFreeBucket   (-1),
   itsBucketSize        (that.itsBucketSize),
   itsBucketRows        (that.itsBucketRows),
-  isDataChanged        (False)
+  isDataChanged        (False),
+  itsChangeCount       (0)
 {}
 
 SSMBase::~SSMBase()
@@ -188,6 +207,9 @@ SSMBase::~SSMBase()
   for (uInt i=0; i<itsPtrIndex.nelements(); i++) {
     delete itsPtrIndex[i];
   }
+  delete itsConcurrentCache;
+  delete itsMappedCache;
+  delete itsMappedFile;
   delete itsCache;
   delete itsFile;
   delete itsIosFile;
@@ -240,6 +262,9 @@ void SSMBase::clearCache()
     itsStringHandler->flush();
     itsCache->clear();
   }
+  if (itsConcurrentCache != 0) {
+    itsConcurrentCache->clear();
+  }
 }
 
 void SSMBase::showBaseStatistics (ostream& anOs) const
@@ -271,6 +296,68 @@ void SSMBase::showCacheStatistics (ostream& anOs) const
     itsCache->showStatistics (anOs);
     anOs << endl;
   }
+  if (itsConcurrentCache != 0) {
+    anOs << "StandardStMan concurrent cache statistics:" << endl;
+    itsConcurrentCache->showStatistics (anOs);
+    anOs << endl;
+  }
+  if (itsMappedCache != 0) {
+    anOs << "StandardStMan data buckets are memory-mapped" << endl;
+  }
+}
+
+DataManIOStats SSMBase::ioStatistics() const
+{
+  DataManIOStats aStats;
+  if (itsCache != 0) {
+    aStats.nAccess    += itsCache->nAccess();
+    aStats.nRead      += itsCache->nRead();
+    aStats.nBytesRead += uInt64(itsCache->nRead()) * itsCache->bucketSize();
+  }
+  if (itsConcurrentCache != 0) {
+    aStats.nAccess    += itsConcurrentCache->nAccess();
+    aStats.nRead      += itsConcurrentCache->nRead();
+    aStats.nBytesRead += uInt64(itsConcurrentCache->nRead()) *
+                         itsConcurrentCache->bucketSize();
+  }
+  return aStats;
+}
+
+Bool SSMBase::canReadConcurrently() const
+{
+  return isConcurrentRead();
+}
+
+void SSMBase::setConcurrentRead (Bool concurrentRead)
+{
+  if (concurrentRead == isConcurrentRead()) {
+    return;
+  }
+  if (concurrentRead) {
+    if (table().isWritable()) {
+      throw DataManError ("StandardStMan " + itsDataManName +
+                          ": concurrent read mode can only be used for "
+                          "a table opened readonly");
+    }
+    // Make sure the file is opened and the index is read.
+    BucketCache& cache = getCache();
+    // Each thread pins a single bucket at a time, so make sure there are
+    // sufficient slots for all threads.
+    uInt cacheSize = max(itsCacheSize, 2*uInt(OMP::maxThreads()) + 2);
+    itsConcurrentCache = new ConcurrentBucketCache (itsFile, 512,
+                                                    itsBucketSize,
+                                                    cache.nBucket(),
+                                                    cacheSize, this,
+                                                    SSMBase::readCallBack,
+                                                    SSMBase::deleteCallBack);
+  } else {
+    delete itsConcurrentCache;
+    itsConcurrentCache = 0;
+  }
+  // The column caches cannot be used by multiple threads.
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->columnCache().invalidate();
+  }
 }
 
 void SSMBase::showIndexStatistics (ostream & anOs) const
@@ -345,6 +432,10 @@ void SSMBase::setCacheSize (uInt aCacheSize, Bool canExceedNrBuckets)
   if (itsCache != 0) {
     itsCache->resize (itsCacheSize);
   }
+  if (itsConcurrentCache != 0) {
+    itsConcurrentCache->resize (max(itsCacheSize,
+                                    itsConcurrentCache->cacheSize()));
+  }
 }
 
 void SSMBase::makeCache()
@@ -371,6 +462,11 @@ void SSMBase::makeCache()
 				SSMBase::deleteCallBack);
     itsCache->resync (itsNrBuckets, itsFreeBucketsNr, 
 		      itsFirstFreeBucket);
+    // Only a readonly table can be mapped; a MultiFile cannot be mapped.
+    if (tsmOption().option() == TSMOption::MMap
+    &&  !table().isWritable()  &&  !multiFile()) {
+      makeMappedCache();
+    }
 
     if (forceFill) {
       readIndexBuckets();
@@ -378,6 +474,33 @@ void SSMBase::makeCache()
   }
 }
 
+void SSMBase::makeMappedCache()
+{
+  deleteMappedCache();
+  itsMappedFile = new BucketFile (fileName(), False, 0, True);
+  itsMappedFile->open();
+  itsMappedCache = new BucketMapped (itsMappedFile, 512, itsBucketSize,
+                                     itsNrBuckets);
+  // The column caches might refer to the buckets in the bucket cache.
+  for (uInt i=0; i<ncolumn(); i++) {
+    itsPtrColumn[i]->columnCache().invalidate();
+  }
+}
+
+void SSMBase::deleteMappedCache()
+{
+  if (itsMappedCache != 0) {
+    // The column caches might refer to the mapped buckets.
+    for (uInt i=0; i<ncolumn(); i++) {
+      itsPtrColumn[i]->columnCache().invalidate();
+    }
+  }
+  delete itsMappedCache;
+  itsMappedCache = 0;
+  delete itsMappedFile;
+  itsMappedFile = 0;
+}
+
 uInt SSMBase::getRowsPerBucket(uInt aColumn) const
 {
   return itsPtrIndex[itsColIndexMap[aColumn]]->getRowsPerBucket();
@@ -642,6 +765,7 @@ void SSMBase::setBucketDirty()
 {
   itsCache->setDirty();
   isDataChanged = True;
+  itsChangeCount++;
 }
 
 //# The storage manager can add rows.
@@ -684,6 +808,7 @@ void SSMBase::addRow64 (rownr_t aNrRows)
 
   itsNrRows+=aNrRows;
   isDataChanged = True;
+  itsChangeCount++;
 }
 
 void SSMBase::removeRow64 (rownr_t aRowNr)
@@ -720,6 +845,7 @@ void SSMBase::removeRow64 (rownr_t aRowNr)
     //    recreate();
   }
   isDataChanged = True;
+  itsChangeCount++;
 }
 
 void SSMBase::addColumn (DataManagerColumn* aColumn)
@@ -809,6 +935,10 @@ void SSMBase::removeBucket (uInt aBucketNr)
 
 char*  SSMBase::getBucket (uInt aBucketNr)
 {
+  if (itsMappedCache != 0) {
+    // The table is readonly, so the mapped bucket is never changed.
+    return const_cast<char*>(itsMappedCache->getBucket(aBucketNr));
+  }
   return itsCache->getBucket(aBucketNr);
 }
   
@@ -910,10 +1040,37 @@ char* SSMBase::find(rownr_t aRowNr,     uInt aColNr,
   return aPtr + itsColumnOffset[aColNr];
 }
 
+const char* SSMBase::findPinned (rownr_t aRowNr, uInt aColNr,
+                                 rownr_t& aStartRow, rownr_t& anEndRow,
+                                 uInt& aSlotNr, const String& colName)
+{
+  // The index is only read, so it can be used by multiple threads.
+  const SSMIndex* anIndexPtr = itsPtrIndex[itsColIndexMap[aColNr]];
+  uInt aBucketNr;
+  anIndexPtr->find(aRowNr,aBucketNr,aStartRow,anEndRow, colName);
+  // Mapped buckets can be used by multiple threads without pinning.
+  if (itsMappedCache != 0) {
+    aSlotNr = 0;
+    return itsMappedCache->getBucket (aBucketNr) + itsColumnOffset[aColNr];
+  }
+  const char* aPtr = itsConcurrentCache->pinBucket (aBucketNr, aSlotNr);
+  return aPtr + itsColumnOffset[aColNr];
+}
+
+void SSMBase::unpinBucket (uInt aSlotNr)
+{
+  if (itsMappedCache == 0) {
+    itsConcurrentCache->unpinBucket (aSlotNr);
+  }
+}
+
 
 
 void SSMBase::recreate()
 {
+  delete itsConcurrentCache;
+  itsConcurrentCache = 0;
+  deleteMappedCache();
   delete itsCache;
   itsCache = 0;
   delete itsFile;
@@ -981,6 +1138,7 @@ Bool SSMBase::flush (AipsIO& ios, Bool doFsync)
 rownr_t SSMBase::resync64 (rownr_t aNrRows)
 {
   itsNrRows = aNrRows;
+  itsChangeCount++;
   if (itsPtrIndex.nelements() != 0) {
     readHeader();
   }
@@ -988,6 +1146,13 @@ rownr_t SSMBase::resync64 (rownr_t aNrRows)
     itsCache->resync (itsNrBuckets, itsFreeBucketsNr, 
 		      itsFirstFreeBucket);
   }
+  if (itsConcurrentCache != 0) {
+    itsConcurrentCache->resync (itsNrBuckets);
+  }
+  // Another process might have changed the file, so map it again.
+  if (itsMappedCache != 0) {
+    makeMappedCache();
+  }
   if (itsPtrIndex.nelements() != 0) {
     readIndexBuckets();
   }  
@@ -1045,6 +1210,9 @@ StManArrayFile* SSMBase::openArrayFile (ByteIO::OpenOption anOpt)
 
 void SSMBase::reopenRW()
 {
+  // The concurrent cache and the mapping can only be used for reading.
+  setConcurrentRead (False);
+  deleteMappedCache();
   if (itsFile != 0) {
     itsFile->setRW();
   }
@@ -1055,6 +1223,9 @@ void SSMBase::reopenRW()
 
 void SSMBase::deleteManager()
 {
+  delete itsConcurrentCache;
+  itsConcurrentCache = 0;
+  deleteMappedCache();
   delete itsIosFile;
   itsIosFile = 0;
   // Clear cache without flushing.
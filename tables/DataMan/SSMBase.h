@@ -31,6 +31,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/DataMan/DataManager.h>
 #include <casacore/casa/Containers/Block.h>
+#include <mutex>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -38,6 +39,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward declarations
 class BucketCache;
 class BucketFile;
+class BucketMapped;
+class ConcurrentBucketCache;
 class StManArrayFile;
 class SSMIndex;
 class SSMColumn;
@@ -133,6 +136,28 @@ class SSMStringHandler;
 // always an index availanle in case the system crashes.
 // If possible 2 halfs of a single bucket are used alternately, otherwise 
 // separate buckets are used.
+// <p>
+// A table opened readonly can be read by multiple threads at the same time
+// after switching on concurrent read mode with
+// <src>setConcurrentRead</src>. In that mode the data buckets of scalar
+// columns of numeric and Bool types are accessed using a
+// <linkto class=ConcurrentBucketCache>ConcurrentBucketCache</linkto>,
+// so such columns can be read in parallel. Other columns (strings
+// and arrays) can also be read by multiple threads, but their accesses
+// are serialized.
+// <br>Note that the table locking is not thread-safe, so the table should
+// be opened without read locking (e.g. TableLock::UserNoReadLocking).
+// <p>
+// If a table is opened readonly with TSMOption::MMap (see
+// <linkto class=TSMOption>TSMOption</linkto>), the entire SSM file
+// is memory-mapped and the data buckets are accessed directly in the
+// mapping instead of being copied into the bucket cache. Scalar columns
+// of numeric types in local format then refer to the values in the mapping
+// without copying them, and direct arrays can be viewed without copying
+// (see <linkto class=ArrayColumnView>ArrayColumnView</linkto>).
+// The index is still read into memory as usual.
+// The mapping is removed if the table is reopened for read/write.
+// A table in a MultiFile cannot be memory-mapped.
 // </synopsis>
 
 // <motivation>
@@ -218,6 +243,30 @@ public:
   // Show the statistics of all caches used.
   virtual void showCacheStatistics (ostream& anOs) const;
 
+  // Get the IO statistics of all caches used.
+  // Reads of memory-mapped buckets are not counted.
+  virtual DataManIOStats ioStatistics() const;
+
+  // Switch the concurrent read mode on or off (see the synopsis).
+  // It can only be switched on if the table is not writable.
+  // It is switched off automatically when the table is reopened for
+  // read/write.
+  void setConcurrentRead (Bool concurrentRead);
+
+  // Is the concurrent read mode on?
+  Bool isConcurrentRead() const;
+
+  // The columns can be read by multiple threads in concurrent read mode.
+  virtual Bool canReadConcurrently() const;
+
+  // Are the data buckets accessed in a memory-mapped file
+  // (see the synopsis)? The file is opened if not done yet.
+  Bool isMapped();
+
+  // Get a lock to serialize the accesses that cannot be done by multiple
+  // threads. The lock is only acquired in concurrent read mode.
+  std::unique_lock<std::recursive_mutex> concurrentLock();
+
   // Show statistics of all indices used.
   void showIndexStatistics (ostream & anOs) const;
 
@@ -258,6 +307,11 @@ public:
   // changed in it and it needs to be written when removed from the cache).
   // (used by SSMColumn::putValue).
   void setBucketDirty();
+
+  // Get the number of changes made to the data (including resyncs).
+  // It is used by the columns to invalidate their zone statistics.
+  uInt64 changeCount() const
+    { return itsChangeCount; }
   
   // Open (if needed) the file for indirect arrays with the given mode.
   // Return a pointer to the object.
@@ -270,6 +324,18 @@ public:
 	      rownr_t& aStartRow, rownr_t& anEndRow,
               const String& colName);
 
+  // Find the bucket containing the column and row in the concurrent
+  // cache and pin it. Return the pointer to the beginning of the column
+  // data in that bucket and the slot to be used to unpin it.
+  // It also fills in the start and end row for the column data.
+  // It can only be used in concurrent read mode.
+  const char* findPinned (rownr_t aRowNr, uInt aColNr,
+                          rownr_t& aStartRow, rownr_t& anEndRow,
+                          uInt& aSlotNr, const String& colName);
+
+  // Unpin a bucket pinned by <src>findPinned</src>.
+  void unpinBucket (uInt aSlotNr);
+
   // Add a new bucket and get its bucket number.
   uInt getNewBucket();
 
@@ -379,7 +445,15 @@ private:
   BucketCache& getCache();
   
   // Construct the cache object (if not constructed yet).
+  // The data buckets are memory-mapped if the table is readonly and
+  // the TSMOption tells to use memory-mapped IO.
   void makeCache();
+
+  // Map the SSM file into memory (again).
+  void makeMappedCache();
+
+  // Remove the memory-mapping of the SSM file.
+  void deleteMappedCache();
   
   // Read the header.
   void readHeader();
@@ -412,6 +486,16 @@ private:
   
   // The cache with the SSM buckets.
   BucketCache* itsCache;
+
+  // The cache used in concurrent read mode (0 if not in that mode).
+  ConcurrentBucketCache* itsConcurrentCache;
+
+  // The mutex serializing the other accesses in concurrent read mode.
+  std::recursive_mutex itsConcurrentMutex;
+
+  // The memory-mapped file and the buckets in it (0 if not mapped).
+  BucketFile*   itsMappedFile;
+  BucketMapped* itsMappedCache;
   
   // The file containing all data.
   BucketFile*  itsFile;
@@ -459,6 +543,9 @@ private:
   
   // Has the data changed since the last flush?
   Bool isDataChanged;
+
+  // The number of changes made to the data.
+  uInt64 itsChangeCount;
 };
 
 
@@ -472,6 +559,25 @@ inline uInt SSMBase::getCacheSize() const
   return itsCacheSize;
 }
 
+inline Bool SSMBase::isConcurrentRead() const
+{
+  return itsConcurrentCache != 0;
+}
+
+inline Bool SSMBase::isMapped()
+{
+  getCache();
+  return itsMappedCache != 0;
+}
+
+inline std::unique_lock<std::recursive_mutex> SSMBase::concurrentLock()
+{
+  if (itsConcurrentCache != 0) {
+    return std::unique_lock<std::recursive_mutex> (itsConcurrentMutex);
+  }
+  return std::unique_lock<std::recursive_mutex>();
+}
+
 inline rownr_t SSMBase::getNRow() const
 {
   return itsNrRows;
@@ -35,6 +35,10 @@
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/OS/CanonicalConversion.h>
 #include <casacore/casa/OS/LECanonicalConversion.h>
+#include <casacore/casa/OS/HostInfo.h>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -48,7 +52,9 @@ SSMColumn::SSMColumn (SSMBase* aParent, int aDataType, uInt aColNr)
   itsMaxLen      (0),
   itsNrElem      (1),
   itsNrCopy      (0),
-  itsData        (0)
+  itsData        (0),
+  itsMustConvert (True),
+  itsZoneChangeCount (0)
 {
   init();
 }
@@ -81,6 +87,60 @@ IPosition SSMColumn::shape (rownr_t)
     return itsShape;
 }
 
+Bool SSMColumn::getZoneMinMax (rownr_t aRowNr, rownr_t& aStartRow,
+                               rownr_t& anEndRow, Double& aMinVal,
+                               Double& aMaxVal)
+{
+  // Only scalars of a numeric type can be handled.
+  // In concurrent read mode the column cache cannot be used.
+  switch (dataType()) {
+  case TpBool:
+  case TpComplex:
+  case TpDComplex:
+  case TpString:
+    return False;
+  default:
+    break;
+  }
+  if (! isFixedShape()  ||  itsShape.nelements() > 0
+  ||  itsSSMPtr->isConcurrentRead()) {
+    return False;
+  }
+  // Clear the statistics if the data have changed.
+  if (itsZoneChangeCount != itsSSMPtr->changeCount()) {
+    itsZones.clear();
+    itsZoneChangeCount = itsSSMPtr->changeCount();
+  }
+  // Find the bucket containing the row; i.e., the last one starting
+  // at or before the row.
+  std::map<rownr_t,Zone>::const_iterator iter = itsZones.upper_bound (aRowNr);
+  if (iter != itsZones.begin()) {
+    --iter;
+    if (aRowNr <= iter->second.endRow) {
+      aStartRow = iter->first;
+      anEndRow  = iter->second.endRow;
+      aMinVal   = iter->second.minVal;
+      aMaxVal   = iter->second.maxVal;
+      return True;
+    }
+  }
+  // Read the bucket into the column cache and determine its min/max.
+  getValue (aRowNr);
+  aStartRow = columnCache().start();
+  anEndRow  = columnCache().end();
+  aMinVal   = std::numeric_limits<Double>::infinity();
+  aMaxVal   = -aMinVal;
+  if (! updateMinMax (dataType(), columnCache().dataPtr(),
+                      anEndRow - aStartRow + 1, aMinVal, aMaxVal)) {
+    return False;
+  }
+  Zone& zone = itsZones[aStartRow];
+  zone.endRow = anEndRow;
+  zone.minVal = aMinVal;
+  zone.maxVal = aMaxVal;
+  return True;
+}
+
 void SSMColumn::doCreate(rownr_t)
 {
 }
@@ -192,63 +252,119 @@ void SSMColumn::shiftRows(char* aValue, rownr_t aRowNr,
 
 void SSMColumn::getBool (rownr_t aRowNr, Bool* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Bool*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const Bool*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getuChar (rownr_t aRowNr, uChar* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uChar*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const uChar*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getShort (rownr_t aRowNr, Short* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Short*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const Short*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getuShort (rownr_t aRowNr, uShort* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uShort*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const uShort*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getInt (rownr_t aRowNr, Int* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Int*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const Int*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getuInt (rownr_t aRowNr, uInt* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<uInt*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const uInt*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getInt64 (rownr_t aRowNr, Int64* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Int64*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const Int64*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getfloat (rownr_t aRowNr, float* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<float*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const float*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getdouble (rownr_t aRowNr, double* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<double*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const double*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 void SSMColumn::getComplex (rownr_t aRowNr, Complex* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<Complex*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const Complex*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 
 void SSMColumn::getDComplex (rownr_t aRowNr,DComplex* aValue)
 {
-  getValue(aRowNr);
-  *aValue = static_cast<DComplex*>(itsData)[aRowNr-columnCache().start()];
+  if (itsSSMPtr->isConcurrentRead()) {
+    getValuePinned (aRowNr, aValue);
+  } else {
+    getValue(aRowNr);
+    *aValue = static_cast<const DComplex*>(columnCache().dataPtr())
+                                              [aRowNr-columnCache().start()];
+  }
 }
 
 void SSMColumn::getString (rownr_t aRowNr, String* aValue)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   if (itsMaxLen > 0) {
     // Allocate the maximum number of characters needed
     // The +1 is to correct for the incorrect use of the chars() function
@@ -313,9 +429,41 @@ void SSMColumn::getValue(rownr_t aRowNr)
     char*   aValue;
     aValue = itsSSMPtr->find (aRowNr, itsColNr, aStartRow, anEndRow,
                               columnName());
-    itsReadFunc (getDataPtr(), aValue, (anEndRow-aStartRow+1) * itsNrCopy);
-    columnCache().set (aStartRow, anEndRow, getDataPtr());
+    // Values in a mapped bucket can be used directly if in local format.
+    if (itsSSMPtr->isMapped()  &&  isLocalFormat (aValue)) {
+      columnCache().set (aStartRow, anEndRow, aValue);
+    } else {
+      itsReadFunc (getDataPtr(), aValue, (anEndRow-aStartRow+1) * itsNrCopy);
+      columnCache().set (aStartRow, anEndRow, getDataPtr());
+    }
+  }
+}
+
+Bool SSMColumn::isLocalFormat (const char* aValue) const
+{
+  if (itsMustConvert) {
+    return False;
+  }
+  // The data must be aligned properly.
+  uInt align = std::min (uInt(ValType::getTypeSize(DataType(dataType()))),
+                         uInt(sizeof(Double)));
+  return reinterpret_cast<std::uintptr_t>(aValue) % align == 0;
+}
+
+void SSMColumn::getValuePinned (rownr_t aRowNr, void* aValue)
+{
+  rownr_t aStartRow;
+  rownr_t anEndRow;
+  uInt    aSlotNr;
+  const char* aBuf = itsSSMPtr->findPinned (aRowNr, itsColNr, aStartRow,
+                                            anEndRow, aSlotNr, columnName());
+  rownr_t anOff = aRowNr-aStartRow;
+  if (dtype() == TpBool) {
+    Conversion::bitToBool (aValue, aBuf+(anOff/8), anOff%8, 1);
+  } else {
+    itsReadFunc (aValue, aBuf+anOff*itsExternalSizeBytes, itsNrCopy);
   }
+  itsSSMPtr->unpinBucket (aSlotNr);
 }
 
 void SSMColumn::putBool (rownr_t aRowNr, const Bool* aValue)
@@ -491,6 +639,7 @@ void SSMColumn::putValueShortString(rownr_t aRowNr, const void* aValue,
 
 void SSMColumn::getScalarColumnV (ArrayBase& aDataPtr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   if (dtype() == TpString) {
     Vector<String>& vec = static_cast<Vector<String>&>(aDataPtr);
     for (uInt64 i=0; i<aDataPtr.nelements(); i++) {
@@ -582,6 +731,7 @@ void SSMColumn::init()
   itsLocalSize = ValType::getTypeSize(aDT);
   Bool asBigEndian = itsSSMPtr->asBigEndian();
   itsNrCopy = itsNrElem;
+  itsMustConvert = True;
   if (aDT == TpString) {
     // Fixed length strings are written directly.
     if (itsMaxLen > 0) {
@@ -619,6 +769,9 @@ void SSMColumn::init()
     itsExternalSizeBytes *= itsNrElem;
     itsLocalSize         *= itsNrElem;
     itsExternalSizeBits   = 8*itsExternalSizeBytes;
+    itsMustConvert = itsExternalSizeBytes != itsLocalSize  ||
+                     (ValType::getTypeSize(aDT) > 1  &&
+                      asBigEndian != HostInfo::bigEndian());
   }
 }
 
@@ -34,6 +34,7 @@
 #include <casacore/casa/Arrays/IPosition.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/OS/Conversion.h>
+#include <map>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -125,6 +126,13 @@ public:
   
   // Get the shape of the array in the given row.
   virtual IPosition shape (rownr_t aRowNr);
+
+  // Get the minimum and maximum value in the bucket containing the row.
+  // The values are calculated when first needed and kept until the data
+  // in the storage manager change.
+  virtual Bool getZoneMinMax (rownr_t aRowNr, rownr_t& aStartRow,
+                              rownr_t& anEndRow, Double& aMinVal,
+                              Double& aMaxVal);
   
   // Let the object initialize itself for a newly created table.
   // It is meant for a derived class.
@@ -207,6 +215,14 @@ protected:
 
   // Fill the cache with data of the bucket containing the given row.
   void getValue (rownr_t aRowNr);
+
+  // Can the values at the given address in a bucket be used directly,
+  // thus are they in local format and properly aligned?
+  Bool isLocalFormat (const char* aValue) const;
+
+  // Get the scalar value in the given row from the pinned bucket in
+  // concurrent read mode. The column cache is not used.
+  void getValuePinned (rownr_t aRowNr, void* aValue);
   
   // Get the bucketnr, offset, and length of a variable length string.
   // <src>data</src> must have 3 Ints to hold the values.
@@ -257,6 +273,17 @@ protected:
   Conversion::ValueFunction* itsWriteFunc;
   // Pointer to a convert function for reading.
   Conversion::ValueFunction* itsReadFunc;
+  // Do the values need to be converted from the storage format?
+  Bool              itsMustConvert;
+  // The min/max statistics of the buckets used so far (mapped by the
+  // first row of the bucket) and the change count they are valid for.
+  struct Zone {
+    rownr_t endRow;
+    Double  minVal;
+    Double  maxVal;
+  };
+  std::map<rownr_t,Zone> itsZones;
+  uInt64            itsZoneChangeCount;
   
 private:
   // Initialize part of the object.
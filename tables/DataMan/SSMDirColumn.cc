@@ -73,6 +73,7 @@ void SSMDirColumn::deleteRow(rownr_t aRowNr)
 
 void SSMDirColumn::getArrayV (rownr_t aRowNr, ArrayBase& aDataPtr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   Bool deleteIt;
   if (dtype() == TpBool) {
     // Bools need to be converted from bits.
@@ -100,6 +101,24 @@ void SSMDirColumn::getArrayV (rownr_t aRowNr, ArrayBase& aDataPtr)
   }
 }
 
+const void* SSMDirColumn::getArrayColumnPtr (rownr_t aStartRow,
+                                             rownr_t aNrRow)
+{
+  if (!itsSSMPtr->isMapped()  ||  itsMustConvert  ||  aNrRow == 0) {
+    return 0;
+  }
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
+  rownr_t aBucketStartRow;
+  rownr_t aBucketEndRow;
+  const char* aValue = itsSSMPtr->find (aStartRow, itsColNr, aBucketStartRow,
+                                        aBucketEndRow, columnName());
+  if (aStartRow + aNrRow - 1 > aBucketEndRow) {
+    return 0;
+  }
+  aValue += (aStartRow-aBucketStartRow) * itsExternalSizeBytes;
+  return isLocalFormat(aValue)  ?  aValue : 0;
+}
+
 void SSMDirColumn::getValue(rownr_t aRowNr, void* data)
 {
   rownr_t aStartRow;
@@ -96,6 +96,11 @@ public:
 
   // Get an array value in the given row.
   virtual void getArrayV (rownr_t rownr, ArrayBase& dataPtr);
+
+  // Get a pointer to the array values in the given consecutive rows.
+  // It can only be done if the SSM file is memory-mapped, the values
+  // are in local format, and all rows are in the same bucket.
+  virtual const void* getArrayColumnPtr (rownr_t startRow, rownr_t nrow);
   
   // Put an array value in the given row.
   virtual void putArrayV (rownr_t rownr, const ArrayBase& dataPtr);
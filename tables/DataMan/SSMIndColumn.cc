@@ -159,13 +159,22 @@ StIndArray* SSMIndColumn::getShape (rownr_t aRowNr)
 }
 
 Bool SSMIndColumn::isShapeDefined (rownr_t aRowNr)
-    { return (getArrayPtr(aRowNr) == 0  ?  False : True); }
+{
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
+  return (getArrayPtr(aRowNr) == 0  ?  False : True);
+}
 
 uInt SSMIndColumn::ndim (rownr_t aRowNr)
-    { return getShape(aRowNr)->shape().nelements(); }
+{
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
+  return getShape(aRowNr)->shape().nelements();
+}
 
 IPosition SSMIndColumn::shape (rownr_t aRowNr)
-    { return getShape(aRowNr)->shape(); }
+{
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
+  return getShape(aRowNr)->shape();
+}
 
 Bool SSMIndColumn::canChangeShape() const
     { return (isShapeFixed  ?  False : True); }
@@ -187,6 +196,7 @@ void SSMIndColumn::deleteRow(rownr_t aRowNr)
 
 void SSMIndColumn::getArrayV (rownr_t aRowNr, ArrayBase& arr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   getShape(aRowNr)->getArrayV (*itsIosFile, arr, dtype());
 }
 
@@ -198,6 +208,7 @@ void SSMIndColumn::putArrayV (rownr_t aRowNr, const ArrayBase& arr)
 void SSMIndColumn::getSliceV (rownr_t aRowNr, const Slicer& ns,
                               ArrayBase& arr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   getShape(aRowNr)->getSliceV (*itsIosFile, ns, arr, dtype());
 }
 
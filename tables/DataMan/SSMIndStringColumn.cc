@@ -58,6 +58,7 @@ void SSMIndStringColumn::setShape (rownr_t aRowNr, const IPosition& aShape)
 
 IPosition SSMIndStringColumn::shape (rownr_t aRowNr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   if (itsShape.nelements() != 0) {
     return itsShape;
   }
@@ -85,6 +86,7 @@ Bool SSMIndStringColumn::canChangeShape() const
 
 Bool SSMIndStringColumn::isShapeDefined (rownr_t aRowNr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   if (itsShape.nelements() != 0) {
     return True;
   } else {
@@ -103,6 +105,7 @@ uInt SSMIndStringColumn::ndim (rownr_t aRowNr)
 void SSMIndStringColumn::getArrayV (rownr_t aRowNr,
                                     ArrayBase& aDataPtr)
 {
+  std::unique_lock<std::recursive_mutex> aLock = itsSSMPtr->concurrentLock();
   if (itsShape.nelements() != 0) {
     SSMDirColumn::getArrayV (aRowNr,aDataPtr);
   } else {
@@ -81,6 +81,21 @@ void ROStandardStManAccessor::clearCache()
     itsSSMPtr->clearCache();
 }
 
+void ROStandardStManAccessor::setConcurrentRead (Bool concurrentRead)
+{
+    itsSSMPtr->setConcurrentRead (concurrentRead);
+}
+
+Bool ROStandardStManAccessor::isConcurrentRead() const
+{
+    return itsSSMPtr->isConcurrentRead();
+}
+
+Bool ROStandardStManAccessor::isMapped() const
+{
+    return itsSSMPtr->isMapped();
+}
+
 void ROStandardStManAccessor::showBaseStatistics (ostream& anOs) const
 {
     itsSSMPtr->showBaseStatistics (anOs);
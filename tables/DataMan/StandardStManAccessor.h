@@ -138,6 +138,19 @@ public:
     // resulting in a drop in memory used.
     void clearCache();
 
+    // Switch the concurrent read mode on or off.
+    // In that mode the storage manager can be read by multiple threads
+    // at the same time. It can only be used for a table opened readonly
+    // (without read locking).
+    void setConcurrentRead (Bool concurrentRead);
+
+    // Is the concurrent read mode on?
+    Bool isConcurrentRead() const;
+
+    // Is the storage manager file memory-mapped?
+    // This is done if the table is opened readonly with TSMOption::MMap.
+    Bool isMapped() const;
+
     // Show the statistics for the base class.
     void showBaseStatistics (ostream& anOs) const;
 
@@ -0,0 +1,203 @@
+//# TSMCodecFile.cc: File holding the compressed tiles of a Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/DataMan/TSMCodecFile.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/IO/AipsIO.h>
+#include <casacore/casa/string.h>                           // for memset
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TSMCodecFile::TSMCodecFile (const String& fileName, const TSMTileCodec& codec,
+                            const std::shared_ptr<MultiFileBase>& mfile)
+: BucketFile     (fileName, 0, False, mfile),
+  codec_p        (codec),
+  offset_p       (0),
+  storedSize_p   (0),
+  virtualSize_p  (0)
+{}
+
+TSMCodecFile::TSMCodecFile (const String& fileName, Bool writable,
+                            const TSMTileCodec& codec,
+                            const std::shared_ptr<MultiFileBase>& mfile)
+: BucketFile     (fileName, writable, 0, False, mfile),
+  codec_p        (codec),
+  offset_p       (0),
+  storedSize_p   (0),
+  virtualSize_p  (0)
+{}
+
+TSMCodecFile::~TSMCodecFile()
+{}
+
+uInt TSMCodecFile::read (void* buffer, uInt length)
+{
+    uInt n = pread (buffer, length, offset_p);
+    offset_p += length;
+    return n;
+}
+
+uInt TSMCodecFile::write (const void* buffer, uInt length)
+{
+    uInt n = pwrite (buffer, length, offset_p);
+    offset_p += length;
+    return n;
+}
+
+void TSMCodecFile::seek (Int64 offset)
+{
+    offset_p = offset;
+}
+
+Int64 TSMCodecFile::fileSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_p);
+    return virtualSize_p;
+}
+
+Int64 TSMCodecFile::storedSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_p);
+    return storedSize_p;
+}
+
+uInt TSMCodecFile::pread (void* buffer, uInt length, Int64 offset)
+{
+    TileEntry entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_p);
+        auto iter = index_p.find (offset);
+        if (iter == index_p.end()) {
+            // The tile has never been written.
+            memset (buffer, 0, length);
+            return length;
+        }
+        entry = iter->second;
+    }
+    if (entry.tileLength != length) {
+        throw DataManError ("TSMCodecFile: tile at offset " +
+                            String::toString(offset) + " in " + name() +
+                            " has length " + String::toString(entry.tileLength) +
+                            " instead of " + String::toString(length));
+    }
+    std::vector<char> data(entry.length);
+    BucketFile::pread (data.data(), entry.length, entry.offset);
+    codec_p.decode (data.data(), entry.length, entry.deflated,
+                    static_cast<char*>(buffer), length);
+    return length;
+}
+
+uInt TSMCodecFile::pwrite (const void* buffer, uInt length, Int64 offset)
+{
+    std::vector<char> data;
+    Bool deflated = codec_p.encode (static_cast<const char*>(buffer),
+                                    length, data);
+    TileEntry entry;
+    {
+        // Find the place to store the encoded data.
+        std::lock_guard<std::mutex> lock(mutex_p);
+        TileEntry& ent = index_p[offset];
+        if (ent.tileLength == 0  ||  ent.capacity < data.size()) {
+            ent.offset   = storedSize_p;
+            ent.capacity = data.size();
+            storedSize_p += data.size();
+        }
+        ent.length     = data.size();
+        ent.tileLength = length;
+        ent.deflated   = deflated;
+        entry = ent;
+        virtualSize_p = std::max (virtualSize_p, offset + length);
+    }
+    BucketFile::pwrite (data.data(), entry.length, entry.offset);
+    return length;
+}
+
+void TSMCodecFile::putIndex (AipsIO& ios) const
+{
+    std::lock_guard<std::mutex> lock(mutex_p);
+    uInt nr = index_p.size();
+    std::vector<Int64> virtOffsets, offsets;
+    std::vector<uInt> lengths, capacities, tileLengths;
+    std::vector<uChar> deflated;
+    virtOffsets.reserve (nr);
+    offsets.reserve (nr);
+    lengths.reserve (nr);
+    capacities.reserve (nr);
+    tileLengths.reserve (nr);
+    deflated.reserve (nr);
+    for (const auto& ent : index_p) {
+        virtOffsets.push_back (ent.first);
+        offsets.push_back (ent.second.offset);
+        lengths.push_back (ent.second.length);
+        capacities.push_back (ent.second.capacity);
+        tileLengths.push_back (ent.second.tileLength);
+        deflated.push_back (ent.second.deflated);
+    }
+    ios.putstart ("TSMCodecFile", 1);
+    ios << storedSize_p << virtualSize_p;
+    ios.put (nr, virtOffsets.data());
+    ios.put (nr, offsets.data());
+    ios.put (nr, lengths.data());
+    ios.put (nr, capacities.data());
+    ios.put (nr, tileLengths.data());
+    ios.put (nr, deflated.data());
+    ios.putend();
+}
+
+void TSMCodecFile::getIndex (AipsIO& ios)
+{
+    std::lock_guard<std::mutex> lock(mutex_p);
+    ios.getstart ("TSMCodecFile");
+    ios >> storedSize_p >> virtualSize_p;
+    uInt nr;
+    ios >> nr;
+    std::vector<Int64> virtOffsets(nr), offsets(nr);
+    std::vector<uInt> lengths(nr), capacities(nr), tileLengths(nr);
+    std::vector<uChar> deflated(nr);
+    ios.get (nr, virtOffsets.data());
+    ios >> nr;
+    ios.get (nr, offsets.data());
+    ios >> nr;
+    ios.get (nr, lengths.data());
+    ios >> nr;
+    ios.get (nr, capacities.data());
+    ios >> nr;
+    ios.get (nr, tileLengths.data());
+    ios >> nr;
+    ios.get (nr, deflated.data());
+    ios.getend();
+    index_p.clear();
+    for (uInt i=0; i<nr; ++i) {
+        TileEntry& ent = index_p[virtOffsets[i]];
+        ent.offset     = offsets[i];
+        ent.length     = lengths[i];
+        ent.capacity   = capacities[i];
+        ent.tileLength = tileLengths[i];
+        ent.deflated   = deflated[i];
+    }
+}
+
+} //# NAMESPACE CASACORE - END
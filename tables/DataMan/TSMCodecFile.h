@@ -0,0 +1,153 @@
+//# TSMCodecFile.h: File holding the compressed tiles of a Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TSMCODECFILE_H
+#define TABLES_TSMCODECFILE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/IO/BucketFile.h>
+#include <casacore/tables/DataMan/TSMTileCodec.h>
+#include <map>
+#include <mutex>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class AipsIO;
+
+// <summary>
+// File holding the compressed tiles of a Tiled Storage Manager.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="UNKNOWN" date="" tests="tTiledCompress">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TSMFile>TSMFile</linkto>
+//   <li> <linkto class=TSMTileCodec>TSMTileCodec</linkto>
+//   <li> <linkto class=BucketCache>BucketCache</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TSMCodecFile is a BucketFile presenting the same (virtual) file layout
+// as an ordinary TSM file, thus a hypercube is a consecutive region of
+// fixed size tiles. However, each tile is encoded with a
+// <linkto class=TSMTileCodec>TSMTileCodec</linkto> when it is written and
+// stored at the next free place in the physical file.
+// A tile offset index maps the virtual offset of a tile to the offset
+// and length of its encoded data in the physical file.
+// When a tile is rewritten, it is written in place if its encoded data fit,
+// otherwise it is appended to the file (leaving a hole).
+// A tile that has not been written yet reads as zeroes.
+// <br>
+// The file can only be accessed per entire tile, which is always the
+// case when used by a <linkto class=BucketCache>BucketCache</linkto>.
+// Memory-mapped and buffered IO cannot be used, but the asynchronous IO
+// of the BucketCache can, because the positional read and write functions
+// are thread-safe.
+// <p>
+// The index is not stored in the file itself, but is written by
+// <linkto class=TSMFile>TSMFile</linkto> in the TSM header file.
+// </synopsis>
+
+// <motivation>
+// Keeping the virtual layout makes it possible to use the normal TSMCube
+// and BucketCache classes for compressed tiles.
+// </motivation>
+
+class TSMCodecFile : public BucketFile
+{
+public:
+    // Create a new file with the given codec.
+    TSMCodecFile (const String& fileName, const TSMTileCodec& codec,
+                  const std::shared_ptr<MultiFileBase>& mfile);
+
+    // Use an existing file with the given codec.
+    // The index has to be read using <src>getIndex</src>.
+    TSMCodecFile (const String& fileName, Bool writable,
+                  const TSMTileCodec& codec,
+                  const std::shared_ptr<MultiFileBase>& mfile);
+
+    virtual ~TSMCodecFile();
+
+    // Get the codec.
+    const TSMTileCodec& codec() const
+      { return codec_p; }
+
+    // Read or write an entire tile at the current virtual offset.
+    // <group>
+    virtual uInt read (void* buffer, uInt length);
+    virtual uInt write (const void* buffer, uInt length);
+    // </group>
+
+    // Read or write an entire tile at the given virtual offset.
+    // <group>
+    virtual uInt pread (void* buffer, uInt length, Int64 offset);
+    virtual uInt pwrite (const void* buffer, uInt length, Int64 offset);
+    // </group>
+
+    // Set the virtual offset.
+    virtual void seek (Int64 offset);
+
+    // Get the virtual (uncompressed) file size, i.e. the end of the
+    // last tile written.
+    virtual Int64 fileSize() const;
+
+    // Get the physical size of the file.
+    Int64 storedSize() const;
+
+    // Write or read the tile offset index.
+    // <group>
+    void putIndex (AipsIO& ios) const;
+    void getIndex (AipsIO& ios);
+    // </group>
+
+private:
+    // Location of the encoded data of a tile.
+    struct TileEntry {
+        Int64 offset     = 0;
+        uInt  length     = 0;
+        uInt  capacity   = 0;
+        uInt  tileLength = 0;
+        Bool  deflated   = False;
+    };
+
+    //# Data members
+    TSMTileCodec codec_p;
+    std::map<Int64,TileEntry> index_p;
+    Int64 offset_p;
+    Int64 storedSize_p;
+    Int64 virtualSize_p;
+    mutable std::mutex mutex_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
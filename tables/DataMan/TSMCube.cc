@@ -41,6 +41,7 @@
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/OS/Conversion.h>
 #include <casacore/casa/OS/HostInfo.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/string.h>                           // for memcpy
 #include <casacore/casa/iostream.h>
 
@@ -92,7 +93,11 @@ TSMCube::TSMCube (TiledStMan* stman, TSMFile* file,
   fileOffset_p   (0),
   cache_p        (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  adaptAxis_p    (-1),
+  adaptStep_p    (0),
+  adaptSize_p    (0),
+  adaptNrResize_p(0)
 {
     if (fileOffset < 0) {
         // TiledCellStMan uses an empty shape; setShape is called later. 
@@ -119,7 +124,11 @@ TSMCube::TSMCube (TiledStMan* stman, AipsIO& ios,
   filePtr_p      (0),
   cache_p        (0),
   userSetCache_p (False),
-  lastColAccess_p(NoAccess)
+  lastColAccess_p(NoAccess),
+  adaptAxis_p    (-1),
+  adaptStep_p    (0),
+  adaptSize_p    (0),
+  adaptNrResize_p(0)
 {
     Int fileSeqnr = getObject (ios);
     if (fileSeqnr >= 0) {
@@ -152,6 +161,17 @@ void TSMCube::emptyCache()
     }
     userSetCache_p = False;
     lastColAccess_p = NoAccess;
+    adaptStart_p.resize (0);
+    adaptAxis_p = -1;
+}
+
+void TSMCube::addIOStatistics (DataManIOStats& stats) const
+{
+    if (cache_p != 0) {
+        stats.nAccess    += cache_p->nAccess();
+        stats.nRead      += cache_p->nRead();
+        stats.nBytesRead += uInt64(cache_p->nRead()) * cache_p->bucketSize();
+    }
 }
 
 void TSMCube::showCacheStatistics (ostream& os) const
@@ -161,6 +181,16 @@ void TSMCube::showCacheStatistics (ostream& os) const
         os << "cubeShape: " << cubeShape_p << endl;
         os << "tileShape: " << tileShape_p << endl;
         os << "maxCacheSz:" << stmanPtr_p->maximumCacheSize() << " MiB" << endl;
+        if (stmanPtr_p->adaptiveCache()) {
+            os << "adaptive:  ";
+            if (adaptSize_p == 0) {
+                os << "no access pattern detected" << endl;
+            } else {
+                os << "axis " << adaptAxis_p << " step " << adaptStep_p
+                   << " needs " << adaptSize_p << " tiles ("
+                   << adaptNrResize_p << " resizes)" << endl;
+            }
+        }
         cache_p->showStatistics (os);
         os << "<<<" << endl;
     }
@@ -377,6 +407,12 @@ void TSMCube::makeCache()
                                    bucketSize_p, nrTiles_p, 1, this,
                                    readCallBack, writeCallBack,
                                    initCallBack, deleteCallBack);
+        // Tiles are read in batches, so no sequential read-ahead is done.
+        const TSMOption& tsmOpt = stmanPtr_p->tsmOption();
+        if (tsmOpt.option() == TSMOption::AsyncIO) {
+            cache_p->setAsyncIO (tsmOpt.nrIOThreads(), 0,
+                                 tsmOpt.ioQueueSize());
+        }
     }
 }
 
@@ -767,6 +803,76 @@ void TSMCube::setCacheSize (const IPosition& sliceShape,
     setCacheSize (cacheSize, forceSmaller, userSet);
 }
 
+void TSMCube::adaptCacheSize (const IPosition& start, const IPosition& end)
+{
+    if (userSetCache_p  ||  !stmanPtr_p->adaptiveCache()) {
+        return;
+    }
+    // Find the axis along which the section moved since the last access.
+    // The section shape must be the same and it must have moved along
+    // a single axis only.
+    Int axis = -1;
+    if (adaptStart_p.nelements() == nrdim_p) {
+        for (uInt i=0; i<nrdim_p; i++) {
+            if (end(i) - start(i) != adaptEnd_p(i) - adaptStart_p(i)) {
+                axis = -2;
+                break;
+            }
+            if (start(i) != adaptStart_p(i)) {
+                axis = (axis == -1  ?  Int(i) : -2);
+            }
+        }
+    }
+    if (axis >= 0) {
+        Int64 step = start(axis) - adaptStart_p(axis);
+        // Only resize if the same pattern is seen twice in a row.
+        if (axis == adaptAxis_p  &&  step == adaptStep_p) {
+            // The cache has to hold the tiles of a section (which move
+            // along the traversal axis). In the other axes it spans a fixed
+            // number of tiles, but in the traversal axis the worst case
+            // number of tiles has to be used to get a stable cache size.
+            uInt nrTiles = 1;
+            for (uInt i=0; i<nrdim_p; i++) {
+                uInt ntile;
+                if (Int(i) == axis) {
+                    Int64 len = 1 + end(i) - start(i);
+                    Int64 nt  = (len + tileShape_p(i) - 2) / tileShape_p(i) + 1;
+                    ntile = std::min (Int64(tilesPerDim_p(i)), nt);
+                } else {
+                    ntile = 1 + end(i) / tileShape_p(i) -
+                            start(i) / tileShape_p(i);
+                }
+                nrTiles *= ntile;
+            }
+            // Use the maximum cache size as the memory budget.
+            // If not set, do not use more than 25% of the memory.
+            nrTiles = validateCacheSize (nrTiles);
+            uInt maxSize = uInt(HostInfo::memoryTotal(True) * 1024.*0.25 /
+                                bucketSize_p);
+            nrTiles = std::max (1u, std::min (nrTiles, maxSize));
+            BucketCache* cachePtr = getCache();
+            if (nrTiles != cachePtr->cacheSize()) {
+                cachePtr->resize (nrTiles);
+                adaptNrResize_p++;
+            }
+            adaptSize_p = nrTiles;
+        }
+        adaptAxis_p = axis;
+        adaptStep_p = step;
+    } else if (axis == -2) {
+        adaptAxis_p = -1;
+    }
+    adaptStart_p.resize (nrdim_p);
+    adaptEnd_p.resize (nrdim_p);
+    adaptStart_p = start;
+    adaptEnd_p   = end;
+}
+
+const char* TSMCube::getDataPtr (Int64, Int64, uInt, uInt)
+{
+    return 0;
+}
+
 // Calculate the cache size for the given slice and access path.
 uInt TSMCube::calcCacheSize (const IPosition& sliceShape,
                              const IPosition& windowStart,
@@ -910,8 +1016,10 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     if (writeFlag) {
 	stmanPtr_p->setDataChanged();
     }
+    // Let the cache size follow the access pattern if wanted.
+    adaptCacheSize (start, end);
     // Prepare for the iteration through the necessary tiles.
-    uInt i, j;
+    uInt i;
 
     // Initialize the various variables and determine the number of
     // tiles needed (which will determine the cache size).
@@ -976,6 +1084,9 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
         return;
     }
 
+    // Read all tiles needed in one batch if asynchronous IO is used.
+    prefetchTiles (cachePtr, start, end, IPosition(nrdim_p, 1));
+
     // If the section is a line, call a specialized function.
     // Note that a single pixel is also handled as a line.
     if (nOneLong >= nrdim_p - 1) {
@@ -991,6 +1102,8 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     // startPixel and endPixel will contain the first and last pixels
     // needed in the current tile.
     // tilePos contains the position of the current tile.
+    // The tiles are gathered in chunks, so the data of the tiles in a
+    // chunk can be copied in parallel.
     IPosition startSection (start);            // start of section in cube
     IPosition sectionShape (end - start + 1);  // section shape
     TSMShape expandedSectionShape (sectionShape);
@@ -999,78 +1112,18 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
     IPosition tilePos    (startTile_p);
     IPosition tileIncr = 
       expandedTilesPerDim_p.offsetIncrement (nrTileSection_p);
-    IPosition dataLength(nrdim_p);
-    IPosition dataPos   (nrdim_p);
-    IPosition sectionPos(nrdim_p);
-    uInt dataOffset;
-    size_t sectionOffset;
     uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+    uInt chunkSize = tileChunkSize (cachePtr, writeFlag);
+    std::vector<TileAccess> tiles;
+    tiles.reserve (chunkSize);
 
     while (True) {
 //      cout << "tilePos=" << tilePos << endl;
 //      cout << "tileNr=" << tileNr << endl;
 //      cout << "start=" << startPixel << endl;
 //      cout << "end=" << endPixel << endl;
-        // Get the tile from the cache.
-        // Set it to dirty if we are writing.
-        char* dataArray = cachePtr->getBucket (tileNr);
-        if (writeFlag) {
-            cachePtr->setDirty();
-        }
-
-        // At this point we start looping through all pixels in the tile.
-        // We do a vector at a time.
-        // Calculate the start and end pixel in the tile.
-        // Initialize the pixel position in the data and section.
-        for (i=0; i<nrdim_p; i++) {
-            dataLength(i) = 1 + endPixel(i) - startPixel(i);
-            dataPos(i)    = startPixel(i);
-            sectionPos(i) = tilePos(i) * tileShape_p(i)
-                            + startPixel(i) - startSection(i);
-        }
-        dataOffset = pixelOffset + localPixelSize *
-                            expandedTileShape_p.offset (startPixel);
-        sectionOffset = localPixelSize *
-                            expandedSectionShape.offset (sectionPos);
-        IPosition dataIncr    = localPixelSize *
-                            expandedTileShape_p.offsetIncrement (dataLength);
-        IPosition sectionIncr = localPixelSize *
-                            expandedSectionShape.offsetIncrement (dataLength);
-
-        while (True) {
-            uInt localSize = dataLength(0) * localPixelSize;
-            /* merge zero increments into one copy */
-            for (j = 1; j < nrdim_p; j++) {
-                if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
-                    localSize *= dataLength(j);
-                    dataPos(j) = endPixel(j);
-                }
-                else {
-                    break;
-                }
-            }
-
-            if (writeFlag) {
-                TSMCube_MoveData(dataArray + dataOffset,
-                                 section + sectionOffset, localSize);
-            } else {
-                TSMCube_MoveData(section + sectionOffset,
-                                 dataArray + dataOffset, localSize);
-            }
-            dataOffset += localSize;
-            sectionOffset += localSize;
-            for (j = 1; j < nrdim_p; j++) {
-                dataOffset += dataIncr(j);
-                sectionOffset += sectionIncr(j);
-                if (++dataPos(j) <= endPixel(j)) {
-                    break;
-                }
-                dataPos(j) = startPixel(j);
-            }
-            if (j == nrdim_p) {
-                break;
-            }
-        }
+        tiles.push_back (TileAccess{tileNr, 0, tilePos,
+                                    startPixel, endPixel, IPosition()});
 
         // Determine the next tile to access and the starting and
         // ending pixels in it.
@@ -1091,10 +1144,175 @@ void TSMCube::accessSection (const IPosition& start, const IPosition& end,
             startPixel(i) = startPixelInFirstTile_p(i);
             endPixel(i)   = endPixelInFirstTile_p(i);
         }
+        Bool ready = (i == nrdim_p);
+
+        // Get the tiles from the cache and copy their data.
+        if (ready  ||  tiles.size() == chunkSize) {
+            getTiles (tiles, cachePtr, writeFlag);
+            Int ntile = tiles.size();
+#pragma omp parallel for if (ntile > 1) schedule(dynamic)
+            for (Int k=0; k<ntile; ++k) {
+                copySectionTile (tiles[k], section, pixelOffset,
+                                 localPixelSize, startSection,
+                                 expandedSectionShape, writeFlag);
+            }
+            cachePtr->setKeepBuckets (False);
+            tiles.clear();
+        }
+        if (ready) {
+            break;
+        }
+    }
+}
+
+uInt TSMCube::tileChunkSize (const BucketCache* cachePtr,
+                             Bool writeFlag) const
+{
+    // Writing is done serially, because initializing new tiles at the
+    // end of the file can remove multiple tiles from the cache.
+    uInt nthr = OMP::maxThreads();
+    if (writeFlag  ||  nthr <= 1) {
+        return 1;
+    }
+    // All tiles in a chunk must fit in the cache at the same time.
+    return std::max (1u, std::min (cachePtr->cacheSize(), 4*nthr));
+}
+
+void TSMCube::getTiles (std::vector<TileAccess>& tiles,
+                        BucketCache* cachePtr, Bool writeFlag)
+{
+    // The tiles in a chunk are different, so the ones already gotten
+    // are the most recently used and are not removed from the cache.
+    // The cache must not release slots for the memory budget meanwhile
+    // nor reuse a slot instead of using a new one.
+    cachePtr->setKeepBuckets (True);
+    try {
+        for (TileAccess& tile : tiles) {
+            // Set the cache slot to dirty if we are writing.
+            tile.data = cachePtr->getBucket (tile.tileNr);
+            if (writeFlag) {
+                cachePtr->setDirty();
+            }
+        }
+    } catch (...) {
+        cachePtr->setKeepBuckets (False);
+        throw;
+    }
+}
+
+void TSMCube::copySectionTile (const TileAccess& tile, char* section,
+                               uInt pixelOffset, uInt localPixelSize,
+                               const IPosition& startSection,
+                               const TSMShape& expandedSectionShape,
+                               Bool writeFlag) const
+{
+    char* dataArray = tile.data;
+    const IPosition& startPixel = tile.startPixel;
+    const IPosition& endPixel   = tile.endPixel;
+    IPosition dataLength(nrdim_p);
+    IPosition dataPos   (nrdim_p);
+    IPosition sectionPos(nrdim_p);
+    // At this point we start looping through all pixels in the tile.
+    // We do a vector at a time.
+    // Calculate the start and end pixel in the tile.
+    // Initialize the pixel position in the data and section.
+    uInt i, j;
+    for (i=0; i<nrdim_p; i++) {
+        dataLength(i) = 1 + endPixel(i) - startPixel(i);
+        dataPos(i)    = startPixel(i);
+        sectionPos(i) = tile.position(i) * tileShape_p(i)
+                        + startPixel(i) - startSection(i);
+    }
+    uInt dataOffset = pixelOffset + localPixelSize *
+                        expandedTileShape_p.offset (startPixel);
+    size_t sectionOffset = localPixelSize *
+                        expandedSectionShape.offset (sectionPos);
+    IPosition dataIncr    = localPixelSize *
+                        expandedTileShape_p.offsetIncrement (dataLength);
+    IPosition sectionIncr = localPixelSize *
+                        expandedSectionShape.offsetIncrement (dataLength);
+
+    while (True) {
+        uInt localSize = dataLength(0) * localPixelSize;
+        /* merge zero increments into one copy */
+        for (j = 1; j < nrdim_p; j++) {
+            if (dataIncr(j) == 0 && sectionIncr(j) == 0) {
+                localSize *= dataLength(j);
+                dataPos(j) = endPixel(j);
+            }
+            else {
+                break;
+            }
+        }
+
+        if (writeFlag) {
+            TSMCube_MoveData(dataArray + dataOffset,
+                             section + sectionOffset, localSize);
+        } else {
+            TSMCube_MoveData(section + sectionOffset,
+                             dataArray + dataOffset, localSize);
+        }
+        dataOffset += localSize;
+        sectionOffset += localSize;
+        for (j = 1; j < nrdim_p; j++) {
+            dataOffset += dataIncr(j);
+            sectionOffset += sectionIncr(j);
+            if (++dataPos(j) <= endPixel(j)) {
+                break;
+            }
+            dataPos(j) = startPixel(j);
+        }
+        if (j == nrdim_p) {
+            break;
+        }
+    }
+}
+
+void TSMCube::prefetchTiles (BucketCache* cachePtr,
+                             const IPosition& start, const IPosition& end,
+                             const IPosition& stride)
+{
+    if (! cachePtr->isAsyncIO()) {
+        return;
+    }
+    // Determine per dimension which tiles contain a pixel of the section.
+    std::vector<std::vector<uInt>> tiles(nrdim_p);
+    size_t ntile = 1;
+    for (uInt i=0; i<nrdim_p; i++) {
+        for (Int64 pix=start(i); pix<=end(i); pix+=stride(i)) {
+            uInt tile = pix / tileShape_p(i);
+            if (tiles[i].empty()  ||  tiles[i].back() != tile) {
+                tiles[i].push_back (tile);
+            }
+        }
+        ntile *= tiles[i].size();
+    }
+    if (ntile <= 1) {
+        return;
+    }
+    // Make the list of tile numbers in the order they are accessed
+    // (thus with the first dimension varying fastest).
+    std::vector<uInt> tileNrs;
+    tileNrs.reserve (ntile);
+    std::vector<size_t> inx(nrdim_p, 0);
+    IPosition tilePos(nrdim_p);
+    while (True) {
+        for (uInt i=0; i<nrdim_p; i++) {
+            tilePos(i) = tiles[i][inx[i]];
+        }
+        tileNrs.push_back (expandedTilesPerDim_p.offset (tilePos));
+        uInt i;
+        for (i=0; i<nrdim_p; i++) {
+            if (++inx[i] < tiles[i].size()) {
+                break;
+            }
+            inx[i] = 0;
+        }
         if (i == nrdim_p) {
-            break;                                     // ready
+            break;
         }
     }
+    cachePtr->prefetch (tileNrs);
 }
 
 void TSMCube::accessLine (char* section, uInt pixelOffset,
@@ -1311,9 +1529,13 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
     if (writeFlag) {
 	stmanPtr_p->setDataChanged();
     }
-    uInt i, j;
+    // Let the cache size follow the access pattern if wanted.
+    adaptCacheSize (start, end);
+    uInt i;
     // Get the cache (if needed).
     BucketCache* cachePtr = getCache();
+    // Read all tiles needed in one batch if asynchronous IO is used.
+    prefetchTiles (cachePtr, start, end, stride);
 
     // A tile can contain more than one data array.
     // Each array is contiguous, so the first pixel of an array
@@ -1332,17 +1554,17 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
     IPosition sectionShape (end - start + stride);  // section shape
     sectionShape /= stride;
     TSMShape expandedSectionShape (sectionShape);
-    IPosition dataLength(nrdim_p);
-    IPosition dataPos   (nrdim_p);
-    uInt dataOffset;
-    size_t sectionOffset;
+    // The tiles are gathered in chunks, so the data of the tiles in a
+    // chunk can be copied in parallel.
+    uInt chunkSize = tileChunkSize (cachePtr, writeFlag);
+    std::vector<TileAccess> tiles;
+    tiles.reserve (chunkSize);
 
-    // Determine if the first dimension is strided.
-    Bool strided = (stride(0) != 1);
     // The first time all dimensions are evaluated to set pixelStart/End
     // correctly.
     Bool firstTime = True;
-    while (True) {
+    Bool ready = False;
+    while (!ready) {
         // Determine the tile position from the pixel position.
         for (i=0; i<nrdim_p; i++) {
             sectionPos(i) += nrPixel(i);
@@ -1368,88 +1590,111 @@ void TSMCube::accessStrided (const IPosition& start, const IPosition& end,
             }
         }
         // Stop if not first time and if all dimensions are done.
-        if (i == nrdim_p) {
-            if (!firstTime) {
-                break;
-            }
+        if (i == nrdim_p  &&  !firstTime) {
+            ready = True;
+        } else {
             firstTime = False;
-        }
-        uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
-//      cout << "tilePos=" << tilePos << endl;
-//      cout << "tileNr=" << tileNr << endl;
-//      cout << "start=" << startPixel << endl;
-        // Get the tile from the cache.
-        // Set it to dirty if we are writing.
-        char* dataArray = cachePtr->getBucket (tileNr);
-        if (writeFlag) {
-            cachePtr->setDirty();
+            uInt tileNr = expandedTilesPerDim_p.offset (tilePos);
+//          cout << "tilePos=" << tilePos << endl;
+//          cout << "tileNr=" << tileNr << endl;
+//          cout << "start=" << startPixel << endl;
+            tiles.push_back (TileAccess{tileNr, 0, sectionPos,
+                                        startPixel, endPixel, nrPixel});
         }
 
-        // At this point we start looping through all pixels in the tile.
-        // We do a vector at a time.
-        // Calculate the start and end pixel in the tile.
-        // Initialize the pixel position in the data and section.
-        dataPos = startPixel;
-        IPosition dataIncr    = localPixelSize *
-                         expandedTileShape_p.offsetIncrement (nrPixel, stride);
-        IPosition sectionIncr = localPixelSize *
-                         expandedSectionShape.offsetIncrement (nrPixel);
-        dataOffset = pixelOffset + localPixelSize *
-                         expandedTileShape_p.offset (startPixel);
-        sectionOffset = localPixelSize *
-                         expandedSectionShape.offset (sectionPos);
-        uInt strideSize = 0;
-        uInt localSize  = nrPixel(0) * localPixelSize;
-        if (strided) {
-            strideSize = stride(0) * localPixelSize;
+        // Get the tiles from the cache and copy their data.
+        if (!tiles.empty()  &&  (ready  ||  tiles.size() == chunkSize)) {
+            getTiles (tiles, cachePtr, writeFlag);
+            Int ntile = tiles.size();
+#pragma omp parallel for if (ntile > 1) schedule(dynamic)
+            for (Int k=0; k<ntile; ++k) {
+                copyStridedTile (tiles[k], section, pixelOffset,
+                                 localPixelSize, stride,
+                                 expandedSectionShape, writeFlag);
+            }
+            cachePtr->setKeepBuckets (False);
+            tiles.clear();
         }
+    }
+}
 
-        while (True) {
-            if (strided) {
-                uInt nrp = nrPixel(0);
-                for (j=0; j<nrp; j++) {
-                    if (writeFlag) {
-                        TSMCube_MoveData((Char*)(dataArray+dataOffset),
-                                         (Char*)(section+sectionOffset),
-                                         localPixelSize);
-                    }
-                    else {
-                        TSMCube_MoveData((Char*)(section+sectionOffset),
-                                         (Char*)(dataArray+dataOffset),
-                                         localPixelSize);
-                    }
-                    dataOffset    += strideSize;
-                    sectionOffset += localPixelSize;
-                }
-            }
-            else {
+void TSMCube::copyStridedTile (const TileAccess& tile, char* section,
+                               uInt pixelOffset, uInt localPixelSize,
+                               const IPosition& stride,
+                               const TSMShape& expandedSectionShape,
+                               Bool writeFlag) const
+{
+    char* dataArray = tile.data;
+    const IPosition& startPixel = tile.startPixel;
+    const IPosition& endPixel   = tile.endPixel;
+    const IPosition& nrPixel    = tile.nrPixel;
+    // Determine if the first dimension is strided.
+    Bool strided = (stride(0) != 1);
+    uInt j;
+    // At this point we start looping through all pixels in the tile.
+    // We do a vector at a time.
+    // Calculate the start and end pixel in the tile.
+    // Initialize the pixel position in the data and section.
+    IPosition dataPos (startPixel);
+    IPosition dataIncr    = localPixelSize *
+                     expandedTileShape_p.offsetIncrement (nrPixel, stride);
+    IPosition sectionIncr = localPixelSize *
+                     expandedSectionShape.offsetIncrement (nrPixel);
+    uInt dataOffset = pixelOffset + localPixelSize *
+                     expandedTileShape_p.offset (startPixel);
+    size_t sectionOffset = localPixelSize *
+                     expandedSectionShape.offset (tile.position);
+    uInt strideSize = 0;
+    uInt localSize  = nrPixel(0) * localPixelSize;
+    if (strided) {
+        strideSize = stride(0) * localPixelSize;
+    }
+
+    while (True) {
+        if (strided) {
+            uInt nrp = nrPixel(0);
+            for (j=0; j<nrp; j++) {
                 if (writeFlag) {
-                    TSMCube_MoveData(dataArray+dataOffset,
-                                     section+sectionOffset,localSize);
+                    TSMCube_MoveData((Char*)(dataArray+dataOffset),
+                                     (Char*)(section+sectionOffset),
+                                     localPixelSize);
                 }
                 else {
-                    TSMCube_MoveData(section+sectionOffset,
-                                     dataArray+dataOffset,localSize);
+                    TSMCube_MoveData((Char*)(section+sectionOffset),
+                                     (Char*)(dataArray+dataOffset),
+                                     localPixelSize);
                 }
-                dataOffset    += localSize;
-                sectionOffset += localSize;
+                dataOffset    += strideSize;
+                sectionOffset += localPixelSize;
             }
-            for (j=1; j<nrdim_p; j++) {
-                // Catch attempt to increment dataOffset below 0
-                DebugAssert(dataIncr(j) >= 0 ||
-                            dataOffset >= static_cast<uInt>(-dataIncr(j)),
-                            DataManError);
-                dataOffset    += dataIncr(j);
-                sectionOffset += sectionIncr(j);
-                dataPos(j) += stride(j);
-                if (dataPos(j) <= endPixel(j)) {
-                    break;
-                }
-                dataPos(j) = startPixel(j);
+        }
+        else {
+            if (writeFlag) {
+                TSMCube_MoveData(dataArray+dataOffset,
+                                 section+sectionOffset,localSize);
+            }
+            else {
+                TSMCube_MoveData(section+sectionOffset,
+                                 dataArray+dataOffset,localSize);
             }
-            if (j == nrdim_p) {
+            dataOffset    += localSize;
+            sectionOffset += localSize;
+        }
+        for (j=1; j<nrdim_p; j++) {
+            // Catch attempt to increment dataOffset below 0
+            DebugAssert(dataIncr(j) >= 0 ||
+                        dataOffset >= static_cast<uInt>(-dataIncr(j)),
+                        DataManError);
+            dataOffset    += dataIncr(j);
+            sectionOffset += sectionIncr(j);
+            dataPos(j) += stride(j);
+            if (dataPos(j) <= endPixel(j)) {
                 break;
             }
+            dataPos(j) = startPixel(j);
+        }
+        if (j == nrdim_p) {
+            break;
         }
     }
 }
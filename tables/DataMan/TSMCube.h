@@ -43,6 +43,7 @@ class TiledStMan;
 class TSMFile;
 class TSMColumn;
 class BucketCache;
+struct DataManIOStats;
 
 // <summary>
 // Tiled hypercube in a table
@@ -154,6 +155,9 @@ public:
     // Show the cache statistics.
     virtual void showCacheStatistics (ostream& os) const;
 
+    // Add the cache statistics to the IO statistics.
+    void addIOStatistics (DataManIOStats& stats) const;
+
     // Put the data of the object into the AipsIO stream.
     void putObject (AipsIO& ios);
 
@@ -232,6 +236,15 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Get a pointer to the data of the given column in <src>nrow</src>
+    // consecutive positions along the last axis starting at
+    // <src>start</src>. It can only be done if the data are held in memory
+    // contiguously (thus for a memory-mapped cube where the tiles span
+    // the other axes entirely and contain no other columns).
+    // The default implementation returns a null pointer.
+    virtual const char* getDataPtr (Int64 start, Int64 nrow, uInt colnr,
+                                    uInt externalPixelSize);
+
     // Get the current cache size (in buckets).
     uInt cacheSize() const;
 
@@ -322,6 +335,58 @@ private:
     // Delete the cache object.
     virtual void deleteCache();
 
+    // Information about a tile to access for a (strided) section.
+    // For a strided section, <src>position</src> is the position of the
+    // first pixel of the tile in the section; otherwise it is the tile
+    // position in the cube.
+    struct TileAccess {
+      uInt      tileNr;
+      char*     data;
+      IPosition position;
+      IPosition startPixel;
+      IPosition endPixel;
+      IPosition nrPixel;
+    };
+
+    // Get the number of tiles to be gathered before copying their data
+    // in parallel. It is 1 if the data cannot be copied in parallel.
+    uInt tileChunkSize (const BucketCache* cachePtr, Bool writeFlag) const;
+
+    // Get the data of the tiles from the cache (in the given order).
+    // The number of tiles must not exceed the cache size. The cache keeps
+    // all of them until the caller has copied the data and has called
+    // <src>cachePtr->setKeepBuckets(False)</src>.
+    void getTiles (std::vector<TileAccess>& tiles, BucketCache* cachePtr,
+                   Bool writeFlag);
+
+    // Copy the data of a tile from or to a section (or strided section).
+    // Different tiles can be copied in parallel.
+    // <group>
+    void copySectionTile (const TileAccess& tile, char* section,
+                          uInt pixelOffset, uInt localPixelSize,
+                          const IPosition& startSection,
+                          const TSMShape& expandedSectionShape,
+                          Bool writeFlag) const;
+    void copyStridedTile (const TileAccess& tile, char* section,
+                          uInt pixelOffset, uInt localPixelSize,
+                          const IPosition& stride,
+                          const TSMShape& expandedSectionShape,
+                          Bool writeFlag) const;
+    // </group>
+
+    // Resize the cache if adaptive cache sizing is used and if the
+    // given section and the previous one show a regular traversal
+    // along an axis. The cache is sized such that it can hold the
+    // tiles of a section, so a tile is read only once while traversing.
+    void adaptCacheSize (const IPosition& start, const IPosition& end);
+
+    // Schedule the asynchronous reads of the tiles needed for the
+    // (strided) section as a single batch.
+    // Nothing is done if the cache does not use asynchronous IO.
+    void prefetchTiles (BucketCache* cachePtr,
+                        const IPosition& start, const IPosition& end,
+                        const IPosition& stride);
+
     // Access a line in a more optimized way.
     void accessLine (char* section, uInt pixelOffset,
 		     uInt localPixelSize,
@@ -398,6 +463,17 @@ protected:
     AccessType      lastColAccess_p;
     // The slice shape of the last column access to a slice.
     IPosition       lastColSlice_p;
+    // The start and end of the last section accessed (for adaptive
+    // cache sizing).
+    IPosition       adaptStart_p;
+    IPosition       adaptEnd_p;
+    // The traversal axis and step found by adaptive cache sizing.
+    Int             adaptAxis_p;
+    Int64           adaptStep_p;
+    // The cache size determined by adaptive cache sizing and the
+    // number of times the cache has been resized.
+    uInt            adaptSize_p;
+    uInt            adaptNrResize_p;
 
     // IPosition variables used in accessSection(); declared here
     // as member variables to avoid significant construction and
@@ -144,6 +144,33 @@ void TSMCubeMMap::extend (uInt64 nr, const Record& coordValues,
     }
 }
 
+const char* TSMCubeMMap::getDataPtr (Int64 start, Int64 nrow, uInt colnr,
+                                     uInt externalPixelSize)
+{
+    // The data are contiguous if a tile contains the data of this column
+    // only and if tiles span all axes but the last one entirely.
+    // In that case the tiles follow each other in the file.
+    uInt lastDim = nrdim_p - 1;
+    if (nrow <= 0  ||  start + nrow > cubeShape_p(lastDim)
+    ||  externalPixelSize == 0  ||  externalOffset_p[colnr] != 0
+    ||  bucketSize_p != tileSize_p * externalPixelSize) {
+        return 0;
+    }
+    for (uInt i=0; i<lastDim; i++) {
+        if (tileShape_p(i) != cubeShape_p(i)) {
+            return 0;
+        }
+    }
+    Int64 cellSize = tileSize_p / tileShape_p(lastDim) * externalPixelSize;
+    Int64 lastTile  = (start + nrow - 1) / tileShape_p(lastDim);
+    Int64 firstTile = start / tileShape_p(lastDim);
+    // Get the last tile first, because it might extend the mapping.
+    BucketMapped* cachePtr = getCache();
+    cachePtr->getBucket (lastTile);
+    return cachePtr->getBucket (firstTile) +
+           (start - firstTile * tileShape_p(lastDim)) * cellSize;
+}
+
 void TSMCubeMMap::setCacheSize (uInt, Bool, Bool)
 {}
 
@@ -150,6 +150,12 @@ public:
                                 uInt localPixelSize, uInt externalPixelSize,
                                 Bool writeFlag);
 
+    // Get a pointer to the data of the given column in <src>nrow</src>
+    // consecutive positions along the last axis. It returns a null pointer
+    // if the data are not contiguous in the mapped file.
+    virtual const char* getDataPtr (Int64 start, Int64 nrow, uInt colnr,
+                                    uInt externalPixelSize);
+
     // Set the cache size for the given slice and access path.
     virtual void setCacheSize (const IPosition& sliceShape,
                                const IPosition& windowStart,
@@ -37,6 +37,8 @@
 #include <casacore/casa/BasicSL/String.h>
 #include <casacore/casa/string.h>
 #include <casacore/casa/iostream.h>
+#include <algorithm>
+#include <cstdint>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -617,6 +619,37 @@ void TSMDataColumn::getArrayColumnCellsV (const RefRows& rownrs,
     }
 }
 
+const void* TSMDataColumn::getArrayColumnPtr (rownr_t startRow, rownr_t nrow)
+{
+    // The data can only be used as such if no conversion is needed.
+    if (mustConvert_p  ||  nrow == 0  ||  tilePixelSize_p != localPixelSize_p) {
+        return 0;
+    }
+    // The rows must be mapped to the last axis of the same hypercube.
+    IPosition position;
+    TSMCube* hypercube = stmanPtr_p->getHypercube (startRow, position);
+    uInt lastAxis = position.nelements() - 1;
+    if (shape(startRow).nelements() != lastAxis) {
+        return 0;
+    }
+    Int64 start = position(lastAxis);
+    IPosition rowpos;
+    for (rownr_t i=1; i<nrow; i++) {
+        if (stmanPtr_p->getHypercube (startRow+i, rowpos) != hypercube
+        ||  rowpos(lastAxis) != start + Int64(i)) {
+            return 0;
+        }
+    }
+    const char* ptr = hypercube->getDataPtr (start, nrow, colnr_p,
+                                             tilePixelSize_p);
+    // The data must be aligned properly.
+    uInt align = std::min (localPixelSize_p, uInt(sizeof(Double)));
+    if (ptr != 0  &&  reinterpret_cast<std::uintptr_t>(ptr) % align != 0) {
+        return 0;
+    }
+    return ptr;
+}
+
 void TSMDataColumn::putArrayColumnCellsV (const RefRows& rownrs,
                                           const ArrayBase& dataPtr)
 {
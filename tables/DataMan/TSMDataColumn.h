@@ -217,6 +217,12 @@ public:
     virtual void getArrayColumnCellsV (const RefRows& rownrs,
                                        ArrayBase& data);
 
+    // Get a pointer to the array values in the given consecutive rows.
+    // It is only possible for a memory-mapped hypercube (TSMOption::MMap)
+    // holding the data in local format, where the rows are consecutive
+    // along the last axis and the tiles span the entire cell.
+    virtual const void* getArrayColumnPtr (rownr_t startRow, rownr_t nrow);
+
     // Put the array values into some cells of the column.
     // The array given in <src>data</src> has to have the correct shape
     // (which is guaranteed by the ArrayColumn getColumn function).
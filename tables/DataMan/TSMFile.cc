@@ -26,6 +26,7 @@
 
 //# Includes
 #include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/tables/DataMan/TSMCodecFile.h>
 #include <casacore/tables/DataMan/TSMOption.h>
 #include <casacore/tables/DataMan/TiledStMan.h>
 #include <casacore/tables/Tables/Table.h>
@@ -37,15 +38,23 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 TSMFile::TSMFile (const TiledStMan* stman, uInt fileSequenceNr,
                   const TSMOption& tsmOpt,
-                  const std::shared_ptr<MultiFileBase>& mfile)
+                  const std::shared_ptr<MultiFileBase>& mfile,
+                  const TSMTileCodec& codec)
 : fileSeqnr_p (fileSequenceNr),
   file_p      (0),
+  codecFile_p (0),
+  codec_p     (codec),
   length_p    (0)
 {
     // Create the file.
     char strc[8];
     snprintf (strc, sizeof(strc), "_TSM%i", fileSeqnr_p);
     String fileName = stman->fileName() + strc;
+    if (codec_p.isCompressed()) {
+      codecFile_p = new TSMCodecFile (fileName, codec_p, mfile);
+      file_p = codecFile_p;
+      return;
+    }
     Bool mapOpt = tsmOpt.option() == TSMOption::MMap;
     uInt bufSize = 0;
     if (tsmOpt.option() == TSMOption::Buffer) {
@@ -59,6 +68,7 @@ TSMFile::TSMFile (const String& fileName, Bool writable,
                   const std::shared_ptr<MultiFileBase>& mfile)
 : fileSeqnr_p (0),
   file_p      (0),
+  codecFile_p (0),
   length_p    (0)
 {
     // Create the file.
@@ -73,9 +83,10 @@ TSMFile::TSMFile (const String& fileName, Bool writable,
 TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
                   const TSMOption& tsmOpt,
                   const std::shared_ptr<MultiFileBase>& mfile)
-: file_p (0)
+: file_p      (0),
+  codecFile_p (0)
 {
-    getObject (ios);
+    getHeader (ios);
     if (seqnr != fileSeqnr_p) {
       throw DataManInternalError ("TSMFile::TSMFile " + 
                                   stman->dataManagerName());
@@ -83,6 +94,13 @@ TSMFile::TSMFile (const TiledStMan* stman, AipsIO& ios, uInt seqnr,
     char strc[8];
     snprintf (strc, sizeof(strc), "_TSM%i", fileSeqnr_p);
     String fileName = stman->fileName() + strc;
+    if (codec_p.isCompressed()) {
+      codecFile_p = new TSMCodecFile (fileName, stman->table().isWritable(),
+                                      codec_p, mfile);
+      file_p = codecFile_p;
+      codecFile_p->getIndex (ios);
+      return;
+    }
     Bool mapOpt = tsmOpt.option() == TSMOption::MMap;
     uInt bufSize = 0;
     if (tsmOpt.option() == TSMOption::Buffer) {
@@ -97,10 +115,22 @@ TSMFile::~TSMFile()
     delete file_p;
 }
 
+Int64 TSMFile::storedSize() const
+{
+    if (codecFile_p != 0) {
+        return codecFile_p->storedSize();
+    }
+    return length_p;
+}
+
 void TSMFile::putObject (AipsIO& ios) const
 {
     // Take care of forward compatibility (for small enough files).
+    // Version 3 is only used for compressed tiles.
     uInt version = (length_p < 2u*1024u*1024u*1024u  ?  1 : 2);
+    if (codecFile_p != 0) {
+        version = 3;
+    }
     ios << version;
     ios << fileSeqnr_p;
     if (version == 1) {
@@ -109,9 +139,22 @@ void TSMFile::putObject (AipsIO& ios) const
     } else {
         ios << length_p;
     }
+    if (version >= 3) {
+        ios << uInt(codec_p.type()) << codec_p.level()
+            << codec_p.elementSize();
+        codecFile_p->putIndex (ios);
+    }
 }
 
 void TSMFile::getObject (AipsIO& ios)
+{
+    getHeader (ios);
+    if (codecFile_p != 0) {
+        codecFile_p->getIndex (ios);
+    }
+}
+
+void TSMFile::getHeader (AipsIO& ios)
 {
     uInt version;
     ios >> version;
@@ -123,6 +166,12 @@ void TSMFile::getObject (AipsIO& ios)
     } else {
         ios >> length_p;
     }
+    if (version >= 3) {
+        uInt type, elemSize;
+        Int level;
+        ios >> type >> level >> elemSize;
+        codec_p = TSMTileCodec (TSMTileCodec::Type(type), level, elemSize);
+    }
 }
 
 } //# NAMESPACE CASACORE - END
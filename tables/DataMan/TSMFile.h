@@ -29,6 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/casa/IO/BucketFile.h>
+#include <casacore/tables/DataMan/TSMTileCodec.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -37,6 +38,7 @@ class TSMOption;
 class TiledStMan;
 class MultiFileBase;
 class AipsIO;
+class TSMCodecFile;
 
 // <summary>
 // File object for Tiled Storage Manager.
@@ -66,6 +68,11 @@ class AipsIO;
 // <p>
 // Underneath it uses a BucketFile to access the file.
 // In this way the IO details are well encapsulated.
+// <br>
+// If a <linkto class=TSMTileCodec>TSMTileCodec</linkto> is used, the file
+// is a <linkto class=TSMCodecFile>TSMCodecFile</linkto> storing the tiles
+// in compressed form. The codec and the tile offset index are stored
+// in the TSM header file by putObject.
 // </synopsis> 
 
 // <motivation>
@@ -81,9 +88,12 @@ class TSMFile
 public:
     // Create a TSMFile object (with corresponding file).
     // The sequence number gets part of the file name.
+    // If a compressing codec is given, the tiles are stored compressed
+    // (in which case memory-mapped or buffered IO cannot be used).
     TSMFile (const TiledStMan* stMan, uInt fileSequenceNr,
              const TSMOption&,
-             const std::shared_ptr<MultiFileBase>& = std::shared_ptr<MultiFileBase>());
+             const std::shared_ptr<MultiFileBase>& = std::shared_ptr<MultiFileBase>(),
+             const TSMTileCodec& = TSMTileCodec());
 
     // Create a TSMFile object for the given existing file.
     TSMFile (const String& fileName, Bool writable, const TSMOption&,
@@ -118,6 +128,13 @@ public:
     // Return the BucketFile object (to be used in the BucketCache).
     BucketFile* bucketFile();
 
+    // Return the codec used for the tiles in the file.
+    const TSMTileCodec& codec() const;
+
+    // Return the physical file size. It is the same as the logical
+    // file length unless the tiles are compressed.
+    Int64 storedSize() const;
+
     // Return the logical file length.
     Int64 length() const;
 
@@ -129,10 +146,17 @@ public:
 
 
 private:
+    // Read the object back without the tile offset index.
+    void getHeader (AipsIO& ios);
+
     // The file sequence number.
     uInt fileSeqnr_p;
     // The file object.
     BucketFile* file_p;
+    // The file object if the tiles are compressed (same object as file_p).
+    TSMCodecFile* codecFile_p;
+    // The codec used for the tiles.
+    TSMTileCodec codec_p;
     // The (logical) length of the file.
     Int64 length_p;
 };
@@ -150,6 +174,9 @@ inline void TSMFile::extend (Int64 increment)
 inline BucketFile* TSMFile::bucketFile()
     { return file_p; }
 
+inline const TSMTileCodec& TSMFile::codec() const
+    { return codec_p; }
+
 inline void TSMFile::open()
     { file_p->open(); }
 
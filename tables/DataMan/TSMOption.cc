@@ -32,7 +32,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                         Int maxCacheSizeMB)
     : itsOption       (option),
       itsBufferSize   (bufferSize),
-      itsMaxCacheSize (maxCacheSizeMB)
+      itsMaxCacheSize (maxCacheSizeMB),
+      itsNrIOThreads  (8),
+      itsIOQueueSize  (64)
   {}
 
   void TSMOption::fillOption (Bool newTable)
@@ -46,6 +48,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         itsOption = TSMOption::MMap;
       } else if (opt == "cache") {
         itsOption = TSMOption::Cache;
+      } else if (opt == "async") {
+        itsOption = TSMOption::AsyncIO;
         ///      } else if (opt == "buffer") {
         ///        itsOption = TSMOption::Buffer;
       } else if (opt == "default32") {
@@ -65,6 +69,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (itsMaxCacheSize <= -2) {
       AipsrcValue<Int>::find (itsMaxCacheSize, "table.tsm.maxcachesizemb", -1);
     }
+    // Get the asynchronous IO parameters.
+    if (itsOption == TSMOption::AsyncIO) {
+      AipsrcValue<uInt>::find (itsNrIOThreads, "table.tsm.asyncthreads", 8);
+      AipsrcValue<uInt>::find (itsIOQueueSize, "table.tsm.asyncqueue", 64);
+    }
     // Default is to use the old caching behaviour
     // Abandoned default to use mmap for existing files on 64 bit systems.
     if (itsOption == TSMOption::Default) {
@@ -48,7 +48,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 // <synopsis>
 // This class can be used to define how the Tiled Storage Manager accesses
-// its data. There are three ways:
+// its data. There are four ways:
 // <ol>
 //  <li> Using a cache of its own. The cache size is derived using the hinted
 //       access pattern. The cache can be (too) large when using large tables
@@ -64,6 +64,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> Use buffered IO; the kernel's file cache should avoid unnecessary IO.
 //       Its performance is less than mmap, but it works well on 32-bit systems.
 //       The buffer size to be used can be defined.
+//  <li> Use a cache of its own like the first way, but read the tiles
+//       asynchronously. All tiles needed for a slice that are not in the
+//       cache yet are read by a pool of IO threads as a single batch.
+//       Keeping many requests outstanding makes good use of devices with
+//       deep request queues (like NVMe drives) and of network file systems.
 // </ol>
 //
 // The constructor of the class can be used to define the options or
@@ -83,6 +88,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //       otherwise Buffer.
 //  <li> <src>TSMOption::Aipsrc</src>
 //       Use the option as defined in the aipsrc file.
+//  <li> <src>TSMOption::AsyncIO</src>
+//       Use unbuffered file IO with internal TSM caching and batched
+//       asynchronous reading of the tiles. The number of IO threads and
+//       the maximum number of outstanding tile reads are given by aipsrc
+//       variables.
 // </ul>
 // The aipsrc variables are:
 // <ul>
@@ -95,6 +105,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //         tables and TSMDefault for new tables.
 //    <li> <src>buffer</src> means TSMBuffer.
 //    <li> <src>default</src> means TSMDefault.
+//    <li> <src>async</src> means TSMAsyncIO.
 //   </ul>
 //       It defaults to value <src>default</src>.
 //       Note that <src>mmapold</src> is almost the same as <src>default</src>.
@@ -107,6 +118,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //  <li> <src>table.tsm.buffersize</src> gives the buffer size for option
 //       <src>TSMOption::Buffer</src>. A value <=0 means use the default 4096.
 //       It defaults to 0.
+//  <li> <src>table.tsm.asyncthreads</src> gives the number of IO threads
+//       for option <src>TSMOption::AsyncIO</src>. It defaults to 8.
+//  <li> <src>table.tsm.asyncqueue</src> gives the maximum number of tiles
+//       being read (or read, but not used yet) for option
+//       <src>TSMOption::AsyncIO</src>. It defaults to 64.
 // </ul>
 // </synopsis>
 
@@ -125,7 +141,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // Use default.
       Default,
       // Use as defined in the aipsrc file.
-      Aipsrc
+      Aipsrc,
+      // Use unbuffered file IO with internal TSM caching and asynchronous
+      // batched reading of tiles.
+      AsyncIO
     };
 
     // Create an option object.
@@ -152,10 +171,20 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int maxCacheSizeMB() const
       { return itsMaxCacheSize; }
 
+    // Get the number of IO threads for option AsyncIO.
+    uInt nrIOThreads() const
+      { return itsNrIOThreads; }
+
+    // Get the maximum number of outstanding tile reads for option AsyncIO.
+    uInt ioQueueSize() const
+      { return itsIOQueueSize; }
+
   private:
     Option itsOption;
     Int    itsBufferSize;
     Int    itsMaxCacheSize;
+    uInt   itsNrIOThreads;
+    uInt   itsIOQueueSize;
   };
 
 } //# NAMESPACE CASACORE - END
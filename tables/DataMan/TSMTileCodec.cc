@@ -0,0 +1,194 @@
+//# TSMTileCodec.cc: Codec to compress the tiles of the Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/DataMan/TSMTileCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/string.h>                           // for memcpy
+#ifdef HAVE_SISCO
+#include <casacore/tables/AlternateMans/Deflate.h>
+#endif
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TSMTileCodec::TSMTileCodec (Type type, Int level, uInt elementSize)
+: type_p        (type),
+  level_p       (level),
+  elementSize_p (elementSize == 0 ? 1 : elementSize)
+{
+    if (useDeflate()) {
+        if (! hasDeflate()) {
+            throw DataManError ("TSM compression codec " + name() +
+                                " is not available (casacore is built"
+                                " without libdeflate)");
+        }
+        if (level < 0  ||  level > 12) {
+            throw DataManError ("TSM compression level " +
+                                String::toString(level) +
+                                " is outside range 0-12");
+        }
+    }
+}
+
+TSMTileCodec::Type TSMTileCodec::fromString (const String& name)
+{
+    String str(name);
+    str.downcase();
+    if (str.empty()  ||  str == "none") {
+        return None;
+    } else if (str == "shuffle") {
+        return Shuffle;
+    } else if (str == "deflate") {
+        return Deflate;
+    } else if (str == "shuffle-deflate"  ||  str == "shuffle+deflate") {
+        return ShuffleDeflate;
+    }
+    throw DataManError ("Unknown TSM compression codec " + name);
+}
+
+String TSMTileCodec::toString (Type type)
+{
+    switch (type) {
+    case Shuffle:
+        return "shuffle";
+    case Deflate:
+        return "deflate";
+    case ShuffleDeflate:
+        return "shuffle-deflate";
+    default:
+        break;
+    }
+    return "none";
+}
+
+Bool TSMTileCodec::hasDeflate()
+{
+#ifdef HAVE_SISCO
+    return True;
+#else
+    return False;
+#endif
+}
+
+void TSMTileCodec::shuffle (char* to, const char* from, uInt length,
+                            uInt elementSize)
+{
+    uInt nelem = length / elementSize;
+    for (uInt j=0; j<elementSize; ++j) {
+        const char* fromPtr = from + j;
+        for (uInt i=0; i<nelem; ++i) {
+            *to++ = *fromPtr;
+            fromPtr += elementSize;
+        }
+    }
+    // Copy the remaining bytes.
+    uInt ndone = nelem * elementSize;
+    memcpy (to, from + ndone, length - ndone);
+}
+
+void TSMTileCodec::unshuffle (char* to, const char* from, uInt length,
+                              uInt elementSize)
+{
+    uInt nelem = length / elementSize;
+    for (uInt j=0; j<elementSize; ++j) {
+        char* toPtr = to + j;
+        for (uInt i=0; i<nelem; ++i) {
+            *toPtr = *from++;
+            toPtr += elementSize;
+        }
+    }
+    uInt ndone = nelem * elementSize;
+    memcpy (to + ndone, from, length - ndone);
+}
+
+Bool TSMTileCodec::encode (const char* tile, uInt length,
+                           std::vector<char>& out) const
+{
+    std::vector<char> shuffled;
+    if (useShuffle()) {
+        shuffled.resize (length);
+        shuffle (shuffled.data(), tile, length, elementSize_p);
+        tile = shuffled.data();
+    }
+#ifdef HAVE_SISCO
+    if (useDeflate()) {
+        deflate::Compressor compressor(level_p);
+        out.resize (compressor.CompressBound (length));
+        size_t nout = compressor.Compress
+          (std::span<const std::byte> ((const std::byte*)tile, length),
+           std::span<std::byte> ((std::byte*)out.data(), out.size()));
+        // Only use the compressed data if smaller.
+        if (nout > 0  &&  nout < length) {
+          out.resize (nout);
+          return True;
+        }
+    }
+#endif
+    if (shuffled.empty()) {
+        out.assign (tile, tile + length);
+    } else {
+        out.swap (shuffled);
+    }
+    return False;
+}
+
+void TSMTileCodec::decode (const char* data, uInt length, Bool deflated,
+                           char* tile, uInt tileLength) const
+{
+    std::vector<char> inflated;
+    if (deflated) {
+#ifdef HAVE_SISCO
+        inflated.resize (tileLength);
+        size_t nout;
+        try {
+            deflate::Decompressor decompressor;
+            nout = decompressor.Decompress
+              (std::span<const std::byte> ((const std::byte*)data, length),
+               std::span<std::byte> ((std::byte*)inflated.data(),
+                                     inflated.size()));
+        } catch (const std::exception& x) {
+            throw DataManError ("TSMTileCodec: " + String(x.what()));
+        }
+        if (nout != tileLength) {
+            throw DataManError ("TSMTileCodec: decompressed tile has "
+                                "incorrect length");
+        }
+        data   = inflated.data();
+        length = tileLength;
+#else
+        throw DataManError ("TSM tile is deflated, but casacore is built "
+                            "without libdeflate");
+#endif
+    }
+    if (length != tileLength) {
+        throw DataManError ("TSMTileCodec: tile has incorrect length");
+    }
+    if (useShuffle()) {
+        unshuffle (tile, data, tileLength, elementSize_p);
+    } else {
+        memcpy (tile, data, tileLength);
+    }
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,162 @@
+//# TSMTileCodec.h: Codec to compress the tiles of the Tiled Storage Manager
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TSMTILECODEC_H
+#define TABLES_TSMTILECODEC_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// <summary>
+// Codec to compress the tiles of the Tiled Storage Manager.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="UNKNOWN" date="" tests="tTiledCompress">
+// </reviewed>
+
+// <prerequisite>
+//# Classes you should understand before using this one.
+//   <li> <linkto class=TSMCodecFile>TSMCodecFile</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TSMTileCodec encodes and decodes the tiles of a Tiled Storage Manager
+// (in external format) when they are written to or read from a
+// <linkto class=TSMCodecFile>TSMCodecFile</linkto>.
+// The following codecs are supported:
+// <ul>
+//  <li> <src>none</src> stores the tiles as is.
+//  <li> <src>shuffle</src> reorders the bytes of a tile such that the
+//       first bytes of all elements are followed by the second bytes, etc.
+//       It does not make the tile smaller, but it is a cheap transformation
+//       that makes (floating point) data much better compressible.
+//  <li> <src>deflate</src> compresses the tiles with the deflate algorithm
+//       using libdeflate (see <src>AlternateMans/Deflate.h</src>).
+//  <li> <src>shuffle-deflate</src> shuffles the bytes before deflating them.
+//       It is the preferred codec for float and complex data.
+// </ul>
+// The deflate codecs are only available if casacore is built with
+// libdeflate (i.e. using BUILD_SISCO). A DataManError is thrown
+// if they are used otherwise.
+// <br>
+// The element size used for the shuffle is the size of the basic data
+// type (thus 4 for Complex). Bytes at the end of a tile not forming
+// an entire element are kept as is.
+// <br>
+// A deflated tile is kept uncompressed if compression does not make it
+// smaller; the <src>deflated</src> flag tells if that is the case.
+// </synopsis>
+
+// <motivation>
+// Tiles of visibility data and flags are usually very well compressible,
+// so compressing them saves disk space and IO bandwidth.
+// </motivation>
+
+class TSMTileCodec
+{
+public:
+    // Define the possible codecs.
+    enum Type {
+        None,
+        Shuffle,
+        Deflate,
+        ShuffleDeflate
+    };
+
+    // Create the codec using the given compression level and the
+    // element size for the byte shuffle.
+    // The level is only used by the deflate codecs and has to be
+    // in the range 0-12 (the libdeflate levels).
+    // An exception is thrown if the codec is not available.
+    explicit TSMTileCodec (Type type = None, Int level = 6,
+                           uInt elementSize = 1);
+
+    // Convert the (case-insensitive) codec name to its type.
+    // An exception is thrown if the name is unknown.
+    static Type fromString (const String& name);
+
+    // Get the name of the codec type.
+    static String toString (Type type);
+
+    // Is the deflate codec available (i.e. built with libdeflate)?
+    static Bool hasDeflate();
+
+    // Get the codec type and its parameters.
+    // <group>
+    Type type() const
+      { return type_p; }
+    String name() const
+      { return toString (type_p); }
+    Int level() const
+      { return level_p; }
+    uInt elementSize() const
+      { return elementSize_p; }
+    // </group>
+
+    // Is a real codec used?
+    Bool isCompressed() const
+      { return type_p != None; }
+
+    // Encode a tile. The encoded data are stored in <src>out</src>.
+    // The returned flag tells if the data are deflated.
+    Bool encode (const char* tile, uInt length, std::vector<char>& out) const;
+
+    // Decode the data into the tile buffer which must have the length
+    // of the original tile.
+    // An exception is thrown if the data do not decode to that length.
+    void decode (const char* data, uInt length, Bool deflated,
+                 char* tile, uInt tileLength) const;
+
+    // Shuffle or unshuffle the bytes of the elements in a buffer.
+    // <group>
+    static void shuffle (char* to, const char* from, uInt length,
+                         uInt elementSize);
+    static void unshuffle (char* to, const char* from, uInt length,
+                           uInt elementSize);
+    // </group>
+
+private:
+    Bool useShuffle() const
+      { return (type_p == Shuffle  ||  type_p == ShuffleDeflate)  &&
+               elementSize_p > 1; }
+    Bool useDeflate() const
+      { return type_p == Deflate  ||  type_p == ShuffleDeflate; }
+
+    //# Data members
+    Type type_p;
+    Int  level_p;
+    uInt elementSize_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
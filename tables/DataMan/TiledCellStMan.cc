@@ -62,6 +62,7 @@ TiledCellStMan::TiledCellStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt64 ("MAXIMUMCACHESIZE"));
     }
+    setCompressionSpec (spec);
 }
 
 TiledCellStMan::~TiledCellStMan()
@@ -72,6 +73,7 @@ DataManager* TiledCellStMan::clone() const
     TiledCellStMan* smp = new TiledCellStMan (hypercolumnName_p,
 					      defaultTileShape_p,
 					      maximumCacheSize());
+    smp->setCompression (compression_p, compressionLevel_p);
     return smp;
 }
 
@@ -68,6 +68,7 @@ TiledColumnStMan::TiledColumnStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt64 ("MAXIMUMCACHESIZE"));
     }
+    setCompressionSpec (spec);
 }
 
 TiledColumnStMan::~TiledColumnStMan()
@@ -78,6 +79,7 @@ DataManager* TiledColumnStMan::clone() const
     TiledColumnStMan* smp = new TiledColumnStMan (hypercolumnName_p,
 						  tileShape_p,
 						  maximumCacheSize());
+    smp->setCompression (compression_p, compressionLevel_p);
     return smp;
 }
 
@@ -57,6 +57,7 @@ TiledDataStMan::TiledDataStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt64 ("MAXIMUMCACHESIZE"));
     }
+    setCompressionSpec (spec);
 }
 
 TiledDataStMan::~TiledDataStMan()
@@ -66,6 +67,7 @@ DataManager* TiledDataStMan::clone() const
 {
     TiledDataStMan* smp = new TiledDataStMan (hypercolumnName_p,
 					      maximumCacheSize());
+    smp->setCompression (compression_p, compressionLevel_p);
     return smp;
 }
 
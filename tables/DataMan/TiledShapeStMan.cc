@@ -73,6 +73,7 @@ TiledShapeStMan::TiledShapeStMan (const String& hypercolumnName,
     if (spec.isDefined ("MAXIMUMCACHESIZE")) {
         setPersMaxCacheSize (spec.asInt64 ("MAXIMUMCACHESIZE"));
     }
+    setCompressionSpec (spec);
 }
 
 TiledShapeStMan::~TiledShapeStMan()
@@ -83,6 +84,7 @@ DataManager* TiledShapeStMan::clone() const
     TiledShapeStMan* smp = new TiledShapeStMan (hypercolumnName_p,
 						defaultTileShape_p,
 						maximumCacheSize());
+    smp->setCompression (compression_p, compressionLevel_p);
     return smp;
 }
 
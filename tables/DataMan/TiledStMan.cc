@@ -32,6 +32,7 @@
 #include <casacore/tables/DataMan/TSMCubeMMap.h>
 #include <casacore/tables/DataMan/TSMCubeBuff.h>
 #include <casacore/tables/DataMan/TSMFile.h>
+#include <casacore/tables/DataMan/TSMTileCodec.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/ColumnDesc.h>
@@ -43,6 +44,7 @@
 #include <casacore/casa/Utilities/GenSort.h>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/DOos.h>
+#include <casacore/casa/System/AipsrcValue.h>
 #include <vector>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/tables/DataMan/DataManError.h>
@@ -57,10 +59,16 @@ TiledStMan::TiledStMan ()
   fileSet_p         (1, static_cast<TSMFile*>(0)),
   persMaxCacheSize_p(0),
   maxCacheSize_p    (0),
+  compression_p     ("none"),
+  compressionLevel_p(6),
+  adaptiveCache_p   (False),
   nrdim_p           (0),
   nrCoordVector_p   (0),
   dataChanged_p     (False)
-{}
+{
+    AipsrcValue<Bool>::find (adaptiveCache_p, "table.tsm.adaptivecache",
+                             False);
+}
 
 TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
 : DataManager       (),
@@ -69,10 +77,16 @@ TiledStMan::TiledStMan (const String& hypercolumnName, uInt maximumCacheSize)
   fileSet_p         (1, static_cast<TSMFile*>(0)),
   persMaxCacheSize_p(maximumCacheSize),
   maxCacheSize_p    (maximumCacheSize),
+  compression_p     ("none"),
+  compressionLevel_p(6),
+  adaptiveCache_p   (False),
   nrdim_p           (0),
   nrCoordVector_p   (0),
   dataChanged_p     (False)
-{}
+{
+    AipsrcValue<Bool>::find (adaptiveCache_p, "table.tsm.adaptivecache",
+                             False);
+}
 
 TiledStMan::~TiledStMan()
 {
@@ -288,6 +302,10 @@ Record TiledStMan::dataManagerSpec() const
     Record rec = getProperties();
     rec.define ("DEFAULTTILESHAPE", defaultTileShape().asVector());
     rec.define ("MAXIMUMCACHESIZE", Int64(persMaxCacheSize_p));
+    if (isCompressed()) {
+        rec.define ("COMPRESSION", compression_p);
+        rec.define ("COMPRESSIONLEVEL", compressionLevel_p);
+    }
     Record subrec;
     Int nrrec=0;
     for (uInt64 i=0; i<cubeSet_p.nelements(); i++) {
@@ -321,6 +339,33 @@ void TiledStMan::setProperties (const Record& rec)
 }
 
 
+void TiledStMan::setCompression (const String& codec, Int level)
+{
+    for (uInt i=0; i<fileSet_p.nelements(); i++) {
+        if (fileSet_p[i] != 0) {
+            throw TSMError ("Compression of TSM " + hypercolumnName_p +
+                            " can only be set before the table is created");
+        }
+    }
+    // Check if the codec can be used (it throws if not).
+    TSMTileCodec::Type type = TSMTileCodec::fromString (codec);
+    TSMTileCodec tileCodec (type, level);
+    compression_p      = tileCodec.name();
+    compressionLevel_p = level;
+}
+
+void TiledStMan::setCompressionSpec (const Record& spec)
+{
+    if (spec.isDefined ("COMPRESSION")) {
+        Int level = 6;
+        if (spec.isDefined ("COMPRESSIONLEVEL")) {
+            level = spec.asInt ("COMPRESSIONLEVEL");
+        }
+        setCompression (spec.asString ("COMPRESSION"), level);
+    }
+}
+
+
 void TiledStMan::setShape (rownr_t, TSMCube*, const IPosition&, const IPosition&)
 {
     throw (TSMError ("setShape is not possible for TSM " + hypercolumnName_p));
@@ -383,12 +428,12 @@ TSMCube* TiledStMan::makeTSMCube (TSMFile* file, const IPosition& cubeShape,
                                   Int64 fileOffset)
 {
     TSMCube* hypercube;
-    if (tsmOption().option() == TSMOption::MMap) {
+    if (cubeOption() == TSMOption::MMap) {
         //cout << "mmapping TSM1" << endl;
         AlwaysAssert (file->bucketFile()->isMapped(), AipsError);
         hypercube = new TSMCubeMMap (this, file, cubeShape, tileShape,
                                      values, fileOffset);
-    } else if (tsmOption().option() == TSMOption::Buffer) {
+    } else if (cubeOption() == TSMOption::Buffer) {
         //cout << "buffered TSM1" << endl;
         AlwaysAssert (file->bucketFile()->isBuffered(), AipsError);
         hypercube = new TSMCubeBuff (this, file, cubeShape, tileShape,
@@ -402,6 +447,17 @@ TSMCube* TiledStMan::makeTSMCube (TSMFile* file, const IPosition& cubeShape,
     return hypercube;
 }
 
+TSMOption::Option TiledStMan::cubeOption() const
+{
+    // Compressed tiles can only be accessed using a cache.
+    TSMOption::Option opt = tsmOption().option();
+    if (isCompressed()
+    &&  (opt == TSMOption::MMap  ||  opt == TSMOption::Buffer)) {
+        opt = TSMOption::Cache;
+    }
+    return opt;
+}
+
 TSMCube* TiledStMan::getTSMCube (uInt hypercube)
 {
     if (hypercube >= nhypercubes()  ||  cubeSet_p[hypercube] == 0) {
@@ -495,6 +551,17 @@ void TiledStMan::showCacheStatistics (ostream& os) const
     }
 }
 
+DataManIOStats TiledStMan::ioStatistics() const
+{
+    DataManIOStats stats;
+    for (uInt i=0; i<cubeSet_p.nelements(); i++) {
+	if (cubeSet_p[i] != 0) {
+	    cubeSet_p[i]->addIOStatistics (stats);
+	}
+    }
+    return stats;
+}
+
 TSMCube* TiledStMan::singleHypercube()
 {
     if (cubeSet_p.nelements() != 1  ||  cubeSet_p[0] == 0) {
@@ -913,7 +980,16 @@ TSMCube* TiledStMan::makeHypercube (const IPosition& cubeShape,
 
 void TiledStMan::createFile (uInt index)
 {
-    TSMFile* file = new TSMFile (this, index, tsmOption(), multiFile());
+    // Shuffle the bytes of the basic data type of the first data column.
+    uInt elemSize = 1;
+    if (dataCols_p.nelements() > 0  &&  dataCols_p[0]->tilePixelSize() > 0) {
+        elemSize = dataCols_p[0]->tilePixelSize() /
+                   dataCols_p[0]->getNrConvert();
+    }
+    TSMTileCodec codec (TSMTileCodec::fromString (compression_p),
+                        compressionLevel_p, elemSize);
+    TSMFile* file = new TSMFile (this, index, tsmOption(), multiFile(),
+                                 codec);
     fileSet_p[index] = file;
 }
 
@@ -1204,6 +1280,14 @@ uInt TiledStMan::headerFileGet (AipsIO& headerFile, rownr_t tabNrrow,
 	    fileSet_p[i] = 0;
 	}
     }
+    // The codec is kept in the files; they all use the same codec.
+    for (uInt64 i=0; i<nrFile; i++) {
+        if (fileSet_p[i] != 0) {
+            compression_p      = fileSet_p[i]->codec().name();
+            compressionLevel_p = fileSet_p[i]->codec().level();
+            break;
+        }
+    }
     uInt64 nrCube;
     if (version >= 3) {
       headerFile >> nrCube;
@@ -1219,10 +1303,10 @@ uInt TiledStMan::headerFileGet (AipsIO& headerFile, rownr_t tabNrrow,
     }
     for (uInt64 i=0; i<nrCube; i++) {
 	if (cubeSet_p[i] == 0) {
-            if (tsmOption().option() == TSMOption::MMap) {
+            if (cubeOption() == TSMOption::MMap) {
                 //cout << "mmapping TSM" << endl;
                 cubeSet_p[i] = new TSMCubeMMap (this, headerFile);
-            } else if (tsmOption().option() == TSMOption::Buffer) {
+            } else if (cubeOption() == TSMOption::Buffer) {
                 //cout << "buffered TSM" << endl;
                 cubeSet_p[i] = new TSMCubeBuff (this, headerFile);
             }else{
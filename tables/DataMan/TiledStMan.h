@@ -147,6 +147,25 @@ public:
     // Set the flag to "data has changed since last flush".
     void setDataChanged();
 
+    // Set the codec (and deflate level) used to compress the tiles.
+    // The possible codecs are none, shuffle, deflate and shuffle-deflate
+    // (see class <linkto class=TSMTileCodec>TSMTileCodec</linkto>).
+    // It can also be given in the data manager specification using the
+    // fields COMPRESSION and COMPRESSIONLEVEL.
+    // <br>It can only be set before the table is created; an exception
+    // is thrown otherwise or if the codec is unknown or not available.
+    void setCompression (const String& codec, Int level=6);
+
+    // Get the codec and level used to compress the tiles.
+    // <group>
+    const String& compression() const
+      { return compression_p; }
+    Int compressionLevel() const
+      { return compressionLevel_p; }
+    Bool isCompressed() const
+      { return compression_p != "none"; }
+    // </group>
+
     // Derive the tile shape from the hypercube shape for the given
     // number of pixels per tile. It is tried to get the same number
     // of tiles for each dimension.
@@ -177,6 +196,21 @@ public:
     // Get the current maximum cache size (in MiB (MibiByte)).
     uInt maximumCacheSize() const;
 
+    // Set or get adaptive cache sizing. If set, a hypercube resizes its
+    // cache when it detects that the sections accessed move regularly
+    // along an axis (e.g. when iterating through the rows or channels).
+    // The cache is sized to hold all tiles of a section, thus the tiles
+    // along the traversal axis, limited by the maximum cache size.
+    // It is not done if the user set the cache size explicitly.
+    // <br>The default is taken from the aipsrc variable
+    // <src>table.tsm.adaptivecache</src> (default False).
+    // <group>
+    void setAdaptiveCache (Bool adaptive)
+      { adaptiveCache_p = adaptive; }
+    Bool adaptiveCache() const
+      { return adaptiveCache_p; }
+    // </group>
+
     // Get the current cache size (in buckets) for the hypercube in
     // the given row.
     uInt cacheSize (rownr_t rownr) const;
@@ -263,6 +297,9 @@ public:
     // Show the statistics of all caches used.
     void showCacheStatistics (ostream& os) const;
 
+    // Get the IO statistics of all caches used.
+    virtual DataManIOStats ioStatistics() const;
+
     // Get the length of the data for the given number of pixels.
     // This can be used to calculate the length of a tile.
     uInt64 getLengthOffset (uInt64 nrPixels, std::vector<uInt>& dataOffset,
@@ -310,6 +347,10 @@ public:
                           const IPosition& tileShape,
                           const Record& values, Int64 fileOffset=-1);
 
+    // Get the TSMOption to use for the hypercubes. It is the option
+    // of the data manager, but compressed tiles always use a cache.
+    TSMOption::Option cubeOption() const;
+
     // Read a tile and convert the data to local format.
     void readTile (char* local, const std::vector<uInt>& localOffset,
 		   const char* external, const std::vector<uInt>& externalOffset,
@@ -386,6 +427,10 @@ protected:
     // Set the persistent maximum cache size (in MiB).
     void setPersMaxCacheSize (uInt nMiB);
 
+    // Set the codec from the COMPRESSION and COMPRESSIONLEVEL fields
+    // in the data manager specification (if defined).
+    void setCompressionSpec (const Record& spec);
+
     // Get the bindings of the columns with the given names.
     // If bound, the pointer to the TSMColumn object is stored in the block.
     // If mustExist is True, an exception is thrown if the column
@@ -516,6 +561,11 @@ protected:
     uInt      persMaxCacheSize_p;
     // The actual maximum cache size for a hypercube (in MiB).
     uInt      maxCacheSize_p;
+    // The codec and level used to compress the tiles.
+    String    compression_p;
+    Int       compressionLevel_p;
+    // Use adaptive cache sizing?
+    Bool      adaptiveCache_p;
     // The dimensionality of the hypercolumn.
     uInt      nrdim_p;
     // The number of vector coordinates.
@@ -86,6 +86,16 @@ uInt ROTiledStManAccessor::maximumCacheSize() const
     return dataManPtr_p->maximumCacheSize();
 }
 
+void ROTiledStManAccessor::setAdaptiveCache (Bool adaptive)
+{
+    dataManPtr_p->setAdaptiveCache (adaptive);
+}
+
+Bool ROTiledStManAccessor::adaptiveCache() const
+{
+    return dataManPtr_p->adaptiveCache();
+}
+
 uInt ROTiledStManAccessor::cacheSize (rownr_t rownr) const
 {
     return dataManPtr_p->cacheSize (rownr);
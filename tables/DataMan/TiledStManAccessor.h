@@ -186,6 +186,19 @@ public:
     // Get the maximum cache size (in MiB).
     uInt maximumCacheSize() const;
 
+    // Set or get adaptive cache sizing (which is not persistent).
+    // If set, the cache of a hypercube is resized automatically when
+    // the data are accessed by moving a section regularly along an axis.
+    // The cache will hold the tiles of an entire section, but not
+    // more than the maximum cache size. The decisions made are shown
+    // by <src>showCacheStatistics</src>.
+    // <br>Setting the cache size explicitly switches it off for
+    // the hypercube until <src>clearCaches</src> is called.
+    // <group>
+    void setAdaptiveCache (Bool adaptive);
+    Bool adaptiveCache() const;
+    // </group>
+
     // Get the current cache size (in buckets) for the hypercube in
     // the given row.
     uInt cacheSize (rownr_t rownr) const;
@@ -0,0 +1,173 @@
+//# tISMColumnCells.cc: Test getting column cells from the IncrementalStMan
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/IncrStManAccessor.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for getting the values of selected rows from the
+// IncrementalStMan, which uses a faster path for rows in ascending order.
+// </summary>
+
+const rownr_t nrow = 5000;
+
+Double timeValue (rownr_t row)
+  { return 1e9 + 10*Int(row/10); }
+Int antValue (rownr_t row)
+  { return row%7 < 4  ?  row%7 : 0; }
+String nameValue (rownr_t row)
+  { return "name" + String::toString(row/13); }
+Bool flagValue (rownr_t row)
+  { return row/29 % 2 == 0; }
+Vector<Float> dataValue (rownr_t row)
+{
+  Vector<Float> vec(3);
+  indgen (vec, Float(row/5));
+  return vec;
+}
+
+void writeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Int>    ("ANTENNA"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("FLAG"));
+  td.addColumn (ArrayColumnDesc<Float>   ("DATA", IPosition(1,3),
+                                          ColumnDesc::FixedShape));
+  SetupNewTable newtab("tISMColumnCells_tmp.data", td, Table::New);
+  // Use small buckets, so the rows are spread over many buckets.
+  IncrementalStMan ism("ISM", 2048);
+  newtab.bindAll (ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Double> time (tab, "TIME");
+  ScalarColumn<Int>    ant  (tab, "ANTENNA");
+  ScalarColumn<String> name (tab, "NAME");
+  ScalarColumn<Bool>   flag (tab, "FLAG");
+  ArrayColumn<Float>   data (tab, "DATA");
+  for (rownr_t row=0; row<nrow; ++row) {
+    time.put (row, timeValue(row));
+    ant.put  (row, antValue(row));
+    name.put (row, nameValue(row));
+    flag.put (row, flagValue(row));
+    data.put (row, dataValue(row));
+  }
+}
+
+// Check the values of the given rows.
+void checkRows (const Table& tab, const RefRows& rows)
+{
+  ScalarColumn<Double> time (tab, "TIME");
+  ScalarColumn<Int>    ant  (tab, "ANTENNA");
+  ScalarColumn<String> name (tab, "NAME");
+  ScalarColumn<Bool>   flag (tab, "FLAG");
+  ArrayColumn<Float>   data (tab, "DATA");
+  Vector<Double> timeVals = time.getColumnCells (rows);
+  Vector<Int>    antVals  = ant.getColumnCells (rows);
+  Vector<String> nameVals = name.getColumnCells (rows);
+  Vector<Bool>   flagVals = flag.getColumnCells (rows);
+  Matrix<Float>  dataVals = data.getColumnCells (rows);
+  RowNumbers rownrs = rows.convert();
+  AlwaysAssertExit (timeVals.size() == rownrs.size());
+  for (rownr_t i=0; i<rownrs.size(); ++i) {
+    rownr_t row = rownrs[i];
+    AlwaysAssertExit (timeVals[i] == timeValue(row));
+    AlwaysAssertExit (antVals[i]  == antValue(row));
+    AlwaysAssertExit (nameVals[i] == nameValue(row));
+    AlwaysAssertExit (flagVals[i] == flagValue(row));
+    AlwaysAssertExit (allEQ (dataVals.column(i), dataValue(row)));
+  }
+}
+
+void checkTable (const Table& tab)
+{
+  // Rows in ascending order, sparse and dense.
+  Vector<rownr_t> rows(nrow/3);
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    rows[i] = 3*i + i%2;
+  }
+  checkRows (tab, RefRows(rows));
+  Vector<rownr_t> sparse(17);
+  indgen (sparse, rownr_t(11), rownr_t(293));
+  checkRows (tab, RefRows(sparse));
+  // Rows in ascending order with duplicates.
+  Vector<rownr_t> dup(nrow/2);
+  for (rownr_t i=0; i<dup.size(); ++i) {
+    dup[i] = i - i%2;
+  }
+  checkRows (tab, RefRows(dup));
+  // Rows in descending and random order.
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    rows[i] = nrow-1 - 3*i;
+  }
+  checkRows (tab, RefRows(rows));
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    rows[i] = (i*7919) % nrow;
+  }
+  checkRows (tab, RefRows(rows));
+  // Row slices.
+  checkRows (tab, RefRows(3, nrow-1, 4));
+  checkRows (tab, RefRows(100, 2000));
+}
+
+int main()
+{
+  try {
+    writeTable();
+    {
+      Table tab("tISMColumnCells_tmp.data");
+      checkTable (tab);
+      cout << "checked ISM column cells" << endl;
+    }
+    {
+      Table tab("tISMColumnCells_tmp.data",
+                TableLock(TableLock::UserNoReadLocking));
+      ROIncrementalStManAccessor acc(tab, "ISM");
+      acc.setConcurrentRead (True);
+      checkTable (tab);
+      acc.setConcurrentRead (False);
+      cout << "checked ISM column cells in concurrent read mode" << endl;
+    }
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
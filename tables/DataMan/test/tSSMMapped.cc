@@ -0,0 +1,192 @@
+//# tSSMMapped.cc: Test reading a memory-mapped StandardStMan
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/StandardStManAccessor.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for reading a StandardStMan using memory-mapped IO.
+// </summary>
+
+const rownr_t nrow = 1000;
+
+Int intValue (rownr_t row)
+  { return 3*row - 100; }
+Double doubleValue (rownr_t row)
+  { return row / 7.; }
+Complex complexValue (rownr_t row)
+  { return Complex(row, -Float(row)); }
+Bool boolValue (rownr_t row)
+  { return row%3 == 1; }
+String stringValue (rownr_t row)
+  { return String(row%5 + 3, 'a') + String::toString(row); }
+Vector<Float> arrayValue (rownr_t row)
+{
+  Vector<Float> vec(4);
+  indgen (vec, Float(row*10));
+  return vec;
+}
+
+void writeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>     ("INT"));
+  td.addColumn (ScalarColumnDesc<Double>  ("DOUBLE"));
+  td.addColumn (ScalarColumnDesc<Complex> ("COMPLEX"));
+  td.addColumn (ArrayColumnDesc<Float>    ("ARRAY", IPosition(1,4),
+                                           ColumnDesc::Direct |
+                                           ColumnDesc::FixedShape));
+  td.addColumn (ScalarColumnDesc<String>  ("STRING"));
+  // Bools are stored as bits, so put them last to keep the others aligned.
+  td.addColumn (ScalarColumnDesc<Bool>    ("BOOL"));
+  SetupNewTable newtab("tSSMMapped_tmp.data", td, Table::New);
+  // Use small buckets, so the rows are spread over many buckets.
+  StandardStMan ssm("SSM", 2048);
+  newtab.bindAll (ssm);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>     intCol  (tab, "INT");
+  ScalarColumn<Double>  dblCol  (tab, "DOUBLE");
+  ScalarColumn<Complex> cxCol   (tab, "COMPLEX");
+  ScalarColumn<Bool>    boolCol (tab, "BOOL");
+  ScalarColumn<String>  strCol  (tab, "STRING");
+  ArrayColumn<Float>    arrCol  (tab, "ARRAY");
+  for (rownr_t row=0; row<nrow; ++row) {
+    intCol.put  (row, intValue(row));
+    dblCol.put  (row, doubleValue(row));
+    cxCol.put   (row, complexValue(row));
+    boolCol.put (row, boolValue(row));
+    strCol.put  (row, stringValue(row));
+    arrCol.put  (row, arrayValue(row));
+  }
+}
+
+void checkTable (const Table& tab)
+{
+  ScalarColumn<Int>     intCol  (tab, "INT");
+  ScalarColumn<Double>  dblCol  (tab, "DOUBLE");
+  ScalarColumn<Complex> cxCol   (tab, "COMPLEX");
+  ScalarColumn<Bool>    boolCol (tab, "BOOL");
+  ScalarColumn<String>  strCol  (tab, "STRING");
+  ArrayColumn<Float>    arrCol  (tab, "ARRAY");
+  // Read the rows forward and backward.
+  for (rownr_t i=0; i<2*nrow; ++i) {
+    rownr_t row = (i < nrow  ?  i : 2*nrow-1-i);
+    AlwaysAssertExit (intCol(row)  == intValue(row));
+    AlwaysAssertExit (dblCol(row)  == doubleValue(row));
+    AlwaysAssertExit (cxCol(row)   == complexValue(row));
+    AlwaysAssertExit (boolCol(row) == boolValue(row));
+    AlwaysAssertExit (strCol(row)  == stringValue(row));
+    AlwaysAssertExit (allEQ (arrCol(row), arrayValue(row)));
+  }
+  // Read entire columns.
+  Vector<Int> ints = intCol.getColumn();
+  Vector<String> strs = strCol.getColumn();
+  Matrix<Float> arrs = arrCol.getColumn();
+  for (rownr_t row=0; row<nrow; ++row) {
+    AlwaysAssertExit (ints[row] == intValue(row));
+    AlwaysAssertExit (strs[row] == stringValue(row));
+    AlwaysAssertExit (allEQ (arrs.column(row), arrayValue(row)));
+  }
+}
+
+void checkView (const Table& tab, Bool isMapped)
+{
+  ArrayColumn<Float> arrCol (tab, "ARRAY");
+  // A single row can always be viewed directly if mapped.
+  ArrayColumnView<Float> view = arrCol.getView (17);
+  AlwaysAssertExit (view.isReference() == isMapped);
+  AlwaysAssertExit (allEQ (view.array(), arrayValue(17)));
+  // Rows in more than one bucket have to be copied.
+  view = arrCol.getColumnRangeView (Slicer(IPosition(1,0),
+                                           IPosition(1,nrow),
+                                           Slicer::endIsLength));
+  AlwaysAssertExit (!view.isReference());
+  AlwaysAssertExit (allEQ (view.array()[999], arrayValue(999)));
+}
+
+int main()
+{
+  try {
+    writeTable();
+    {
+      // The file is only mapped for a readonly table.
+      Table tab("tSSMMapped_tmp.data", Table::Old, TSMOption::MMap);
+      ROStandardStManAccessor acc(tab, "SSM");
+      AlwaysAssertExit (acc.isMapped());
+      checkTable (tab);
+      checkView (tab, True);
+      cout << "checked mapped table" << endl;
+      // The mapping can be used in concurrent read mode.
+      acc.setConcurrentRead (True);
+      checkTable (tab);
+      acc.setConcurrentRead (False);
+      cout << "checked mapped table in concurrent read mode" << endl;
+      // Reopening for read/write removes the mapping.
+      tab.reopenRW();
+      AlwaysAssertExit (!acc.isMapped());
+      checkTable (tab);
+      ScalarColumn<Int> intCol (tab, "INT");
+      intCol.put (5, 55);
+      AlwaysAssertExit (intCol(5) == 55);
+      intCol.put (5, intValue(5));
+      cout << "checked reopened table" << endl;
+    }
+    {
+      Table tab("tSSMMapped_tmp.data", Table::Update, TSMOption::MMap);
+      ROStandardStManAccessor acc(tab, "SSM");
+      AlwaysAssertExit (!acc.isMapped());
+      checkTable (tab);
+      checkView (tab, False);
+      cout << "checked writable table" << endl;
+    }
+    {
+      Table tab("tSSMMapped_tmp.data", Table::Old, TSMOption::Cache);
+      ROStandardStManAccessor acc(tab, "SSM");
+      AlwaysAssertExit (!acc.isMapped());
+      checkTable (tab);
+      cout << "checked cached table" << endl;
+    }
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,176 @@
+//# tStManConcurrentRead.cc: Test concurrent reading of the SSM and ISM
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ScaColDesc.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/StandardStMan.h>
+#include <casacore/tables/DataMan/StandardStManAccessor.h>
+#include <casacore/tables/DataMan/IncrementalStMan.h>
+#include <casacore/tables/DataMan/IncrStManAccessor.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for reading the SSM and ISM by multiple threads
+// </summary>
+
+const rownr_t nrow = 20000;
+
+void createTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>("ssmInt"));
+  td.addColumn (ScalarColumnDesc<Double>("ssmDouble"));
+  td.addColumn (ScalarColumnDesc<Bool>("ssmBool"));
+  td.addColumn (ScalarColumnDesc<String>("ssmString"));
+  td.addColumn (ArrayColumnDesc<Float>("ssmArr", IPosition(1,4),
+                                       ColumnDesc::Direct));
+  td.addColumn (ScalarColumnDesc<Int>("ismInt"));
+  td.addColumn (ScalarColumnDesc<String>("ismString"));
+  SetupNewTable newtab("tStManConcurrentRead_tmp.tab", td, Table::New);
+  StandardStMan ssm("SSM", 1024);
+  IncrementalStMan ism("ISM", 1024);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("ismInt", ism);
+  newtab.bindColumn ("ismString", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    ssmInt    (tab, "ssmInt");
+  ScalarColumn<Double> ssmDouble (tab, "ssmDouble");
+  ScalarColumn<Bool>   ssmBool   (tab, "ssmBool");
+  ScalarColumn<String> ssmString (tab, "ssmString");
+  ArrayColumn<Float>   ssmArr    (tab, "ssmArr");
+  ScalarColumn<Int>    ismInt    (tab, "ismInt");
+  ScalarColumn<String> ismString (tab, "ismString");
+  Vector<Float> arr(4);
+  for (rownr_t i=0; i<nrow; ++i) {
+    ssmInt.put (i, i);
+    ssmDouble.put (i, i+0.5);
+    ssmBool.put (i, i%3 == 0);
+    ssmString.put (i, "str" + String::toString(i));
+    arr = Float(i);
+    ssmArr.put (i, arr);
+    ismInt.put (i, i/7);
+    ismString.put (i, "ism" + String::toString(i/11));
+  }
+}
+
+// Read the rows in a different order in each thread.
+void readTable (uInt nthread)
+{
+  Table tab("tStManConcurrentRead_tmp.tab",
+            TableLock(TableLock::UserNoReadLocking));
+  ROStandardStManAccessor ssmAcc(tab, "SSM");
+  ROIncrementalStManAccessor ismAcc(tab, "ISM");
+  // Read a value first to check that the column cache is invalidated.
+  ScalarColumn<Int> ssmInt (tab, "ssmInt");
+  ScalarColumn<Int> ismInt (tab, "ismInt");
+  AlwaysAssertExit (ssmInt(3) == 3  &&  ismInt(3) == 0);
+  ssmAcc.setConcurrentRead (True);
+  ismAcc.setConcurrentRead (True);
+  AlwaysAssertExit (ssmAcc.isConcurrentRead()  &&  ismAcc.isConcurrentRead());
+  const ScalarColumn<Double> ssmDouble (tab, "ssmDouble");
+  const ScalarColumn<Bool>   ssmBool   (tab, "ssmBool");
+  const ScalarColumn<String> ssmString (tab, "ssmString");
+  const ArrayColumn<Float>   ssmArr    (tab, "ssmArr");
+  const ScalarColumn<String> ismString (tab, "ismString");
+  std::atomic<uInt> nerr(0);
+  std::vector<std::thread> threads;
+  for (uInt t=0; t<nthread; ++t) {
+    threads.emplace_back ([&, t]() {
+      for (rownr_t j=0; j<nrow; ++j) {
+        rownr_t i = (j * (2*t+1) + t*1000) % nrow;
+        if (ssmInt(i) != Int(i)
+        ||  ssmDouble(i) != i+0.5
+        ||  ssmBool(i) != (i%3 == 0)
+        ||  ismInt(i) != Int(i/7)) {
+          nerr++;
+        }
+        if (j%10 == 0) {
+          if (ssmString(i) != "str" + String::toString(i)
+          ||  ismString(i) != "ism" + String::toString(i/11)
+          ||  ! allEQ (ssmArr(i), Float(i))) {
+            nerr++;
+          }
+        }
+      }
+    });
+  }
+  for (std::thread& thr : threads) {
+    thr.join();
+  }
+  AlwaysAssertExit (nerr == 0);
+  cout << "read table using " << nthread << " threads" << endl;
+  cout << ">>>" << endl;
+  ssmAcc.showCacheStatistics (cout);
+  cout << "<<<" << endl;
+  ismAcc.showCacheStatistics (cout);
+  ssmAcc.setConcurrentRead (False);
+  ismAcc.setConcurrentRead (False);
+  AlwaysAssertExit (ssmInt(nrow-1) == Int(nrow-1));
+  AlwaysAssertExit (ismInt(nrow-1) == Int((nrow-1)/7));
+}
+
+// Concurrent read mode cannot be used for a writable table.
+void checkWritable()
+{
+  Table tab("tStManConcurrentRead_tmp.tab", Table::Update);
+  ROStandardStManAccessor ssmAcc(tab, "SSM");
+  Bool failed = False;
+  try {
+    ssmAcc.setConcurrentRead (True);
+  } catch (const DataManError& x) {
+    cout << x.what() << endl;
+    failed = True;
+  }
+  AlwaysAssertExit (failed  &&  !ssmAcc.isConcurrentRead());
+}
+
+int main()
+{
+  try {
+    createTable();
+    readTable (1);
+    readTable (4);
+    readTable (8);
+    checkWritable();
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
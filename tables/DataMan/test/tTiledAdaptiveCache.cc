@@ -0,0 +1,135 @@
+//# tTiledAdaptiveCache.cc: Test program for adaptive cache sizing in the TSM
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the Tiled Storage Manager resizing its cache
+// according to the access pattern.
+// </summary>
+
+const uInt nrow = 64;
+const IPosition arrayShape(2, 20, 30);
+
+Float expected (uInt i, uInt j, uInt row)
+{
+  return row*1000 + j*20 + i;
+}
+
+void writeTable()
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float> ("Data", arrayShape,
+                                        ColumnDesc::FixedShape));
+  SetupNewTable newtab("tTiledAdaptiveCache_tmp.data", td, Table::New);
+  // The tile shape does not fit integrally in the cube shape.
+  // There are 4*5*8 tiles.
+  TiledColumnStMan sm1 ("TSMExample", IPosition(3,6,7,8));
+  newtab.bindAll (sm1);
+  Table table(newtab, nrow);
+  ArrayColumn<Float> data (table, "Data");
+  Matrix<Float> arr(arrayShape);
+  for (uInt row=0; row<nrow; ++row) {
+    for (Int j=0; j<arrayShape[1]; ++j) {
+      for (Int i=0; i<arrayShape[0]; ++i) {
+        arr(i,j) = expected (i, j, row);
+      }
+    }
+    data.put (row, arr);
+  }
+}
+
+// Read the data channel by channel (thus along a non-tile aligned axis).
+void readChannels (const ArrayColumn<Float>& data)
+{
+  for (Int i=0; i<arrayShape[0]; ++i) {
+    Cube<Float> arr = data.getColumn (Slicer(IPosition(2,i,0),
+                                             IPosition(2,1,arrayShape[1]),
+                                             Slicer::endIsLength));
+    AlwaysAssertExit (arr(0,5,7) == expected (i, 5, 7));
+  }
+}
+
+// Read a part of the data row by row.
+void readRows (const ArrayColumn<Float>& data)
+{
+  Slicer slicer(IPosition(2,2,3), IPosition(2,10,10), Slicer::endIsLength);
+  for (uInt row=0; row<nrow; ++row) {
+    Matrix<Float> arr = data.getSlice (row, slicer);
+    AlwaysAssertExit (arr(4,6) == expected (6, 9, row));
+  }
+}
+
+void checkAdaptive()
+{
+  Table table("tTiledAdaptiveCache_tmp.data");
+  ROTiledStManAccessor acc(table, "TSMExample");
+  acc.setAdaptiveCache (True);
+  AlwaysAssertExit (acc.adaptiveCache());
+  ArrayColumn<Float> data (table, "Data");
+  // A channel spans 1*5*8 tiles.
+  readChannels (data);
+  cout << "cache size when reading channels: " << acc.getCacheSize(0) << endl;
+  AlwaysAssertExit (acc.getCacheSize(0) == 40);
+  acc.showCacheStatistics (cout);
+  // A slice of a row spans 2*2*1 tiles.
+  readRows (data);
+  cout << "cache size when reading rows: " << acc.getCacheSize(0) << endl;
+  AlwaysAssertExit (acc.getCacheSize(0) == 4);
+  acc.showCacheStatistics (cout);
+  // An explicitly set cache size should not be changed.
+  acc.setCacheSize (0, 3);
+  readChannels (data);
+  AlwaysAssertExit (acc.getCacheSize(0) == 3);
+  // After clearing, the cache size can be adapted again.
+  acc.clearCaches();
+  readChannels (data);
+  AlwaysAssertExit (acc.getCacheSize(0) == 40);
+  cout << "checked explicitly set cache size" << endl;
+}
+
+int main()
+{
+  try {
+    writeTable();
+    checkAdaptive();
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,157 @@
+//# tTiledAsyncIO.cc: Test program for the TSM using asynchronous IO
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the Tiled Storage Manager reading its tiles in batches
+// using asynchronous IO.
+// </summary>
+
+const uInt nrow = 50;
+const IPosition arrayShape(2, 20, 30);
+
+// Get the expected value of a pixel.
+Float expected (uInt i, uInt j, uInt row)
+{
+  return row*1000 + j*20 + i;
+}
+
+// Get the expected values of a (strided) section of all rows.
+Cube<Float> expectedSection (const Slicer& slicer, Float add)
+{
+  IPosition shp = slicer.length();
+  Cube<Float> arr(shp[0], shp[1], nrow);
+  for (uInt row=0; row<nrow; ++row) {
+    for (Int j=0; j<shp[1]; ++j) {
+      for (Int i=0; i<shp[0]; ++i) {
+        arr(i,j,row) = add + expected (slicer.start()[0] +
+                                         i*slicer.stride()[0],
+                                       slicer.start()[1] +
+                                         j*slicer.stride()[1],
+                                       row);
+      }
+    }
+  }
+  return arr;
+}
+
+void writeTable()
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float> ("Data", arrayShape,
+                                        ColumnDesc::FixedShape));
+  SetupNewTable newtab("tTiledAsyncIO_tmp.data", td, Table::New);
+  // Let the tile shape not fit integrally in the cube shape.
+  TiledColumnStMan sm1 ("TSMExample", IPosition(3,6,7,4));
+  newtab.bindAll (sm1);
+  Table table(newtab, nrow, False, Table::LittleEndian, TSMOption::Cache);
+  ArrayColumn<Float> data (table, "Data");
+  Matrix<Float> arr(arrayShape);
+  for (uInt row=0; row<nrow; ++row) {
+    for (Int j=0; j<arrayShape[1]; ++j) {
+      for (Int i=0; i<arrayShape[0]; ++i) {
+        arr(i,j) = expected (i, j, row);
+      }
+    }
+    data.put (row, arr);
+  }
+}
+
+void checkTable (const TSMOption& tsmOpt, const String& optName, Float add)
+{
+  Table table("tTiledAsyncIO_tmp.data", Table::Old, tsmOpt);
+  ArrayColumn<Float> data (table, "Data");
+  // Read the entire column, a spectral line through all rows, a plane
+  // and a strided section.
+  Slicer full (IPosition(2,0,0), arrayShape, Slicer::endIsLength);
+  Slicer line (IPosition(2,3,5), IPosition(2,1,1), Slicer::endIsLength);
+  Slicer plane(IPosition(2,2,4), IPosition(2,15,21), Slicer::endIsLength);
+  Slicer strided (IPosition(2,1,2), IPosition(2,6,7), IPosition(2,3,4),
+                  Slicer::endIsLength);
+  AlwaysAssertExit (allEQ (data.getColumn(),
+                           expectedSection(full, add)));
+  AlwaysAssertExit (allEQ (data.getColumn(line),
+                           expectedSection(line, add)));
+  AlwaysAssertExit (allEQ (data.getColumn(plane),
+                           expectedSection(plane, add)));
+  AlwaysAssertExit (allEQ (data.getColumn(strided),
+                           expectedSection(strided, add)));
+  // Read the rows in reverse order.
+  for (Int row=nrow-1; row>=0; --row) {
+    Matrix<Float> arr = data.getSlice (row, plane);
+    for (uInt j=0; j<arr.ncolumn(); ++j) {
+      for (uInt i=0; i<arr.nrow(); ++i) {
+        AlwaysAssertExit (arr(i,j) == add + expected (i+2, j+4, row));
+      }
+    }
+  }
+  cout << "checked table using option " << optName << endl;
+  ROTiledStManAccessor acc(table, "TSMExample");
+  acc.showCacheStatistics (cout);
+}
+
+// Update the table using a small cache, so tiles are written and reread.
+void updateTable (Float add)
+{
+  Table table("tTiledAsyncIO_tmp.data", Table::Update, TSMOption::AsyncIO);
+  ROTiledStManAccessor acc(table, "TSMExample");
+  acc.setCacheSize (0, 4);
+  ArrayColumn<Float> data (table, "Data");
+  Array<Float> arr = data.getColumn();
+  arr += add;
+  data.putColumn (arr);
+  cout << "updated table using asynchronous IO" << endl;
+}
+
+int main()
+{
+  try {
+    writeTable();
+    checkTable (TSMOption::Cache, "Cache", 0);
+    checkTable (TSMOption::AsyncIO, "AsyncIO", 0);
+    updateTable (2);
+    checkTable (TSMOption::Cache, "Cache", 2);
+    checkTable (TSMOption::AsyncIO, "AsyncIO", 2);
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
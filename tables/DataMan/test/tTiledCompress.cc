@@ -0,0 +1,247 @@
+//# tTiledCompress.cc: Test program for the TSM using compressed tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/tables/DataMan/TSMTileCodec.h>
+#include <casacore/tables/DataMan/DataManError.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/File.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the Tiled Storage Managers using compressed tiles.
+// </summary>
+
+const IPosition arrayShape(2, 16, 25);
+
+// Fill a data and flag array for the given row.
+void fillArrays (uInt row, Matrix<Complex>& data, Matrix<Bool>& flag)
+{
+  for (Int j=0; j<arrayShape[1]; ++j) {
+    for (Int i=0; i<arrayShape[0]; ++i) {
+      data(i,j) = Complex(row + 0.5*j, -Float(i));
+      flag(i,j) = (row+i) % 5 == 0;
+    }
+  }
+}
+
+void checkTable (const String& name, uInt nrow, const TSMOption& tsmOpt)
+{
+  Table table(name, Table::Old, tsmOpt);
+  AlwaysAssertExit (table.nrow() == nrow);
+  ArrayColumn<Complex> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  Matrix<Complex> darr(arrayShape);
+  Matrix<Bool> farr(arrayShape);
+  for (uInt row=0; row<nrow; ++row) {
+    fillArrays (row, darr, farr);
+    AlwaysAssertExit (allEQ (data(row), darr));
+    AlwaysAssertExit (allEQ (flag(row), farr));
+  }
+  // Check a slice through all rows.
+  Array<Complex> slice = data.getColumn (Slicer(IPosition(2,3,4),
+                                                IPosition(2,1,1)));
+  AlwaysAssertExit (slice(IPosition(3,0,0,nrow-1)) ==
+                    Complex(nrow-1 + 2, -3));
+}
+
+// Get the physical size of the TSM data files.
+Int64 storedSize (const String& name)
+{
+  Int64 size = 0;
+  for (uInt i=0; i<2; ++i) {
+    File file(name + "/table.f0_TSM" + String::toString(i));
+    if (file.exists()) {
+      size += file.size();
+    }
+  }
+  return size;
+}
+
+// Write a table using the given codec set by the TSM object.
+// Thereafter extend the table and rewrite some data.
+void writeShape (const String& codec, uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Complex> ("Data", 2));
+  td.addColumn (ArrayColumnDesc<Bool> ("Flag", 2));
+  {
+    SetupNewTable newtab("tTiledCompress_tmp.data", td, Table::New);
+    TiledShapeStMan sm1 ("TSMExample", IPosition(3,8,5,4));
+    sm1.setCompression (codec);
+    newtab.bindAll (sm1);
+    Table table(newtab, nrow);
+    ArrayColumn<Complex> data (table, "Data");
+    ArrayColumn<Bool> flag (table, "Flag");
+    Matrix<Complex> darr(arrayShape);
+    Matrix<Bool> farr(arrayShape);
+    for (uInt row=0; row<nrow; ++row) {
+      fillArrays (row, darr, farr);
+      data.put (row, darr);
+      flag.put (row, farr);
+    }
+  }
+  checkTable ("tTiledCompress_tmp.data", nrow, TSMOption::Cache);
+  // Add rows and overwrite the data with a small cache, so tiles get
+  // written multiple times.
+  {
+    Table table("tTiledCompress_tmp.data", Table::Update);
+    ROTiledStManAccessor acc(table, "TSMExample");
+    acc.setCacheSize (0, 1);
+    Record dminfo = table.dataManagerInfo();
+    Record spec = dminfo.subRecord(0).subRecord("SPEC");
+    AlwaysAssertExit (spec.asString("COMPRESSION") == codec);
+    table.addRow (nrow);
+    ArrayColumn<Complex> data (table, "Data");
+    ArrayColumn<Bool> flag (table, "Flag");
+    Matrix<Complex> darr(arrayShape);
+    Matrix<Bool> farr(arrayShape);
+    for (uInt row=0; row<2*nrow; ++row) {
+      fillArrays (row, darr, farr);
+      data.put (row, darr);
+      flag.put (row, farr);
+    }
+  }
+  checkTable ("tTiledCompress_tmp.data", 2*nrow, TSMOption::Cache);
+  // Memory-mapped and buffered IO cannot be used; it should use the cache.
+  checkTable ("tTiledCompress_tmp.data", 2*nrow, TSMOption::MMap);
+  checkTable ("tTiledCompress_tmp.data", 2*nrow, TSMOption::Buffer);
+  checkTable ("tTiledCompress_tmp.data", 2*nrow, TSMOption::AsyncIO);
+  cout << "checked TiledShapeStMan with codec " << codec << endl;
+}
+
+// Write a table using the codec given in the data manager spec.
+// Check that deflated data are smaller than the data stored as is.
+void writeColumn (const String& codec, Bool compress, uInt nrow)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Complex> ("Data", arrayShape,
+                                          ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Bool> ("Flag", arrayShape,
+                                       ColumnDesc::FixedShape));
+  {
+    SetupNewTable newtab("tTiledCompress_tmp.data", td, Table::New);
+    Record spec;
+    spec.define ("DEFAULTTILESHAPE", IPosition(3,16,25,8).asVector());
+    spec.define ("COMPRESSION", codec);
+    spec.define ("COMPRESSIONLEVEL", 9);
+    TiledColumnStMan sm1 ("TSMExample", spec);
+    newtab.bindAll (sm1);
+    Table table(newtab, nrow);
+    ArrayColumn<Complex> data (table, "Data");
+    ArrayColumn<Bool> flag (table, "Flag");
+    Matrix<Complex> darr(arrayShape);
+    Matrix<Bool> farr(arrayShape);
+    for (uInt row=0; row<nrow; ++row) {
+      fillArrays (row, darr, farr);
+      data.put (row, darr);
+      flag.put (row, farr);
+    }
+  }
+  checkTable ("tTiledCompress_tmp.data", nrow, TSMOption::Cache);
+  Int64 dataSize = nrow * arrayShape.product() * (sizeof(Complex) + 1./8);
+  if (compress) {
+    AlwaysAssertExit (storedSize("tTiledCompress_tmp.data") < dataSize/2);
+  } else {
+    AlwaysAssertExit (storedSize("tTiledCompress_tmp.data") >= dataSize);
+  }
+  cout << "checked TiledColumnStMan with codec " << codec << endl;
+}
+
+// Check the shuffle and unshuffle functions.
+void checkShuffle()
+{
+  char buf[11] = {0,1,2,3,4,5,6,7,8,9,10};
+  char sbuf[11], ubuf[11];
+  TSMTileCodec::shuffle (sbuf, buf, 11, 4);
+  char expShuffle[11] = {0,4,1,5,2,6,3,7,8,9,10};
+  AlwaysAssertExit (memcmp (sbuf, expShuffle, 11) == 0);
+  TSMTileCodec::unshuffle (ubuf, sbuf, 11, 4);
+  AlwaysAssertExit (memcmp (ubuf, buf, 11) == 0);
+  // Check unknown codecs and levels.
+  Bool failed = False;
+  try {
+    TSMTileCodec::fromString ("zip");
+  } catch (const DataManError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+  AlwaysAssertExit (TSMTileCodec::fromString("Shuffle+Deflate") ==
+                    TSMTileCodec::ShuffleDeflate);
+  if (TSMTileCodec::hasDeflate()) {
+    failed = False;
+    try {
+      TSMTileCodec codec (TSMTileCodec::Deflate, 13);
+    } catch (const DataManError&) {
+      failed = True;
+    }
+    AlwaysAssertExit (failed);
+  }
+  cout << "checked shuffle" << endl;
+}
+
+int main()
+{
+  try {
+    checkShuffle();
+    writeShape ("shuffle", 17);
+    writeColumn ("none", False, 30);
+    writeColumn ("shuffle", False, 30);
+    // The deflate codecs can only be used if built with libdeflate.
+    if (TSMTileCodec::hasDeflate()) {
+      writeShape ("shuffle-deflate", 17);
+      writeShape ("deflate", 17);
+      writeColumn ("shuffle-deflate", True, 30);
+    } else {
+      Bool failed = False;
+      try {
+        writeColumn ("shuffle-deflate", True, 30);
+      } catch (const DataManError&) {
+        failed = True;
+      }
+      AlwaysAssertExit (failed);
+      cout << "checked TiledShapeStMan with codec shuffle-deflate" << endl;
+      cout << "checked TiledShapeStMan with codec deflate" << endl;
+      cout << "checked TiledColumnStMan with codec shuffle-deflate" << endl;
+    }
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
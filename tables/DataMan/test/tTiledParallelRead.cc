@@ -0,0 +1,162 @@
+//# tTiledParallelRead.cc: Test program for the parallel copy of TSM tiles
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/DataMan/TiledShapeStMan.h>
+#include <casacore/tables/DataMan/TiledStManAccessor.h>
+#include <casacore/casa/Arrays/Cube.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/IO/BucketCacheBudget.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for the Tiled Storage Manager copying the data of
+// multiple tiles in parallel. The result must be the same as when
+// using a single thread.
+// </summary>
+
+const uInt nrow = 40;
+const IPosition arrayShape(2, 17, 33);
+
+void writeTable (const String& name)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Complex> ("Data", 2));
+  td.addColumn (ArrayColumnDesc<Bool> ("Flag", 2));
+  SetupNewTable newtab(name, td, Table::New);
+  // Let the tile shape not fit integrally in the cube shape.
+  TiledShapeStMan sm1 ("TSMExample", IPosition(3,4,5,3));
+  newtab.bindAll (sm1);
+  Table table(newtab, nrow);
+  ArrayColumn<Complex> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  Matrix<Complex> darr(arrayShape);
+  Matrix<Bool> farr(arrayShape);
+  for (uInt row=0; row<nrow; ++row) {
+    for (Int j=0; j<arrayShape[1]; ++j) {
+      for (Int i=0; i<arrayShape[0]; ++i) {
+        darr(i,j) = Complex(row*1000 + j*20 + i, -Float(i));
+        farr(i,j) = (row+i+j) % 3 == 0;
+      }
+    }
+    data.put (row, darr);
+    flag.put (row, farr);
+  }
+}
+
+// Read the sections using the given number of threads and cache size.
+void readTable (uInt nthread, uInt cacheSize,
+                Array<Complex>& data1, Array<Complex>& data2,
+                Array<Complex>& data3, Array<Bool>& flag1)
+{
+  OMP::setNumThreads (nthread);
+  Table table("tTiledParallelRead_tmp.data");
+  ROTiledStManAccessor acc(table, "TSMExample");
+  acc.setCacheSize (0, cacheSize);
+  ArrayColumn<Complex> data (table, "Data");
+  ArrayColumn<Bool> flag (table, "Flag");
+  data1.reference (data.getColumn());
+  data2.reference (data.getColumn (Slicer(IPosition(2,1,3), IPosition(2,15,29),
+                                          Slicer::endIsLast)));
+  data3.reference (data.getColumn (Slicer(IPosition(2,1,2), IPosition(2,16,31),
+                                          IPosition(2,3,5),
+                                          Slicer::endIsLast)));
+  flag1.reference (flag.getColumn (Slicer(IPosition(2,0,1), IPosition(2,16,32),
+                                          IPosition(2,1,2),
+                                          Slicer::endIsLast)));
+}
+
+void checkRead (uInt nthread, uInt cacheSize)
+{
+  Array<Complex> ref1, ref2, ref3, data1, data2, data3;
+  Array<Bool> reff, flag1;
+  readTable (1, cacheSize, ref1, ref2, ref3, reff);
+  readTable (nthread, cacheSize, data1, data2, data3, flag1);
+  AlwaysAssertExit (allEQ (data1, ref1));
+  AlwaysAssertExit (allEQ (data2, ref2));
+  AlwaysAssertExit (allEQ (data3, ref3));
+  AlwaysAssertExit (allEQ (flag1, reff));
+  // Check some values.
+  AlwaysAssertExit (data1.shape() == IPosition(3,17,33,nrow));
+  AlwaysAssertExit (data2.shape() == IPosition(3,15,27,nrow));
+  AlwaysAssertExit (data3.shape() == IPosition(3,6,6,nrow));
+  AlwaysAssertExit (data3(IPosition(3,2,3,5)) == Complex(5*1000+17*20+7, -7));
+  cout << "read with " << nthread << " threads and cache size "
+       << cacheSize << endl;
+}
+
+// Read with a memory budget of only a few tiles, while the cache of
+// another table competes for it. The tiles of a chunk must stay in the
+// cache while they are copied.
+void checkBudget (uInt nthread)
+{
+  Array<Complex> ref1, ref2, ref3, data1, data2, data3;
+  Array<Bool> reff, flag1;
+  readTable (1, 100, ref1, ref2, ref3, reff);
+  BucketCacheBudget::setBudget (2048);
+  Table other("tTiledParallelRead_tmp.data2");
+  ROTiledStManAccessor acc(other, "TSMExample");
+  acc.setCacheSize (0, 100);
+  ArrayColumn<Complex> otherData (other, "Data");
+  Array<Complex> otherRef (otherData.getColumn());
+  for (uInt i=0; i<2; ++i) {
+    readTable (nthread, 100, data1, data2, data3, flag1);
+    AlwaysAssertExit (allEQ (data1, ref1));
+    AlwaysAssertExit (allEQ (data2, ref2));
+    AlwaysAssertExit (allEQ (data3, ref3));
+    AlwaysAssertExit (allEQ (flag1, reff));
+    AlwaysAssertExit (allEQ (otherData.getColumn(), otherRef));
+  }
+  AlwaysAssertExit (BucketCacheBudget::nrEvicted() > 0);
+  BucketCacheBudget::setBudget (0);
+  cout << "read with " << nthread << " threads and a small memory budget"
+       << endl;
+}
+
+int main()
+{
+  try {
+    writeTable ("tTiledParallelRead_tmp.data");
+    writeTable ("tTiledParallelRead_tmp.data2");
+    checkRead (4, 1);
+    checkRead (4, 3);
+    checkRead (3, 100);
+    checkRead (8, 1000);
+    checkBudget (4);
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
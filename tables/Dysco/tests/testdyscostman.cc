@@ -2,6 +2,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/directory.hpp>
 
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
@@ -27,9 +28,10 @@ casacore::Record GetDyscoSpec() {
 }
 
 struct TestTableFixture {
-  explicit TestTableFixture(size_t nAnt) {
+  explicit TestTableFixture(size_t nAnt, size_t nTime = 2,
+                            size_t nChannels = 1) {
     casacore::TableDesc tableDesc;
-    IPosition shape(2, 1, 1);
+    IPosition shape(2, 1, nChannels);
     casacore::ArrayColumnDesc<casacore::Complex> columnDesc(
         "DATA", "", "DyscoStMan", "", shape);
     columnDesc.setOptions(casacore::ColumnDesc::Direct |
@@ -55,7 +57,7 @@ struct TestTableFixture {
 
     size_t a1 = 0, a2 = 1;
     double time = 10.0;
-    const size_t nRow = 2 * nAnt * (nAnt - 1) / 2;
+    const size_t nRow = nTime * nAnt * (nAnt - 1) / 2;
     newTable.addRow(nRow);
     casacore::ScalarColumn<int> a1Col(newTable, "ANTENNA1"),
         a2Col(newTable, "ANTENNA2"), fieldCol(newTable, "FIELD_ID"),
@@ -82,7 +84,9 @@ struct TestTableFixture {
     casacore::ArrayColumn<casacore::Complex> dataCol(newTable, "DATA");
     for (size_t i = 0; i != nRow; ++i) {
       casacore::Array<casacore::Complex> arr(shape);
-      *arr.cbegin() = i;
+      for (size_t ch = 0; ch != nChannels; ++ch) {
+        arr(IPosition(2, 0, ch)) = casacore::Complex(i, ch);
+      }
       dataCol.put(i, arr);
     }
   }
@@ -159,6 +163,35 @@ BOOST_AUTO_TEST_CASE(read_past_end) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(read_order) {
+  // The blocks are large enough to be decoded by multiple threads, and
+  // sequential reads decode the next block in the background. The result
+  // should not depend on the order in which the rows are read.
+  TestTableFixture fixture(30, 5, 256);
+
+  casacore::Table table("TestTable", casacore::Table::Update);
+  casacore::ArrayColumn<casacore::Complex> dataCol(table, "DATA");
+  const size_t nRow = table.nrow();
+  std::vector<casacore::Array<casacore::Complex>> values(nRow);
+  for (size_t i = 0; i != nRow; ++i) {
+    values[i] = dataCol(i);
+  }
+  for (size_t i = nRow; i != 0; --i) {
+    BOOST_CHECK(allEQ(dataCol(i - 1), values[i - 1]));
+  }
+  for (size_t i = 0; i < nRow; i += 7) {
+    BOOST_CHECK(allEQ(dataCol(i), values[i]));
+  }
+  // Writing to the next block after a sequential read should not return
+  // the values that were decoded in the background.
+  const size_t rowsPerBlock = nRow / 5;
+  BOOST_CHECK(allEQ(dataCol(rowsPerBlock - 1), values[rowsPerBlock - 1]));
+  casacore::Array<casacore::Complex> newValue(values[0].shape(),
+                                              casacore::Complex(1.0, 2.0));
+  dataCol.put(rowsPerBlock, newValue);
+  BOOST_CHECK(allEQ(dataCol(rowsPerBlock), newValue));
+}
+
 BOOST_AUTO_TEST_CASE(readonly) {
   size_t nAnt = 3;
   TestTableFixture fixture(nAnt);
@@ -6,14 +6,56 @@
 #include "bytepacker.h"
 #include "threadgroup.h"
 
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/ms/MeasurementSets/MeasurementSet.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 
 namespace dyscostman {
 
+namespace {
+
+// Minimum number of symbols that a decoding thread should process; smaller
+// blocks are decoded by the calling thread only.
+constexpr size_t kMinSymbolsPerDecodeThread = 32768;
+
+// Call func(begin, end) for nThreads consecutive parts of the range [0, n).
+// The first part is processed by the calling thread. An exception thrown by
+// one of the parts is rethrown after all threads have finished.
+template <typename Func>
+void parallelFor(size_t nThreads, size_t n, Func func) {
+  nThreads = std::min(nThreads, n);
+  if (nThreads <= 1) {
+    func(0, n);
+  } else {
+    std::vector<std::exception_ptr> errors(nThreads);
+    threadgroup group;
+    for (size_t t = 1; t != nThreads; ++t) {
+      group.create_thread([&func, &errors, t, n, nThreads]() {
+        try {
+          func(n * t / nThreads, n * (t + 1) / nThreads);
+        } catch (...) {
+          errors[t] = std::current_exception();
+        }
+      });
+    }
+    try {
+      func(0, n / nThreads);
+    } catch (...) {
+      errors[0] = std::current_exception();
+    }
+    group.join_all();
+    for (const std::exception_ptr &error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace
+
 template <typename DataType>
 ThreadedDyscoColumn<DataType>::ThreadedDyscoColumn(DyscoStMan *parent,
                                                    int dtype)
@@ -29,13 +71,15 @@ ThreadedDyscoColumn<DataType>::ThreadedDyscoColumn(DyscoStMan *parent,
       _isCurrentBlockChanged(false),
       _blockSize(0),
       _antennaCount(0),
-      _timeBlockBuffer() {}
+      _timeBlockBuffer(),
+      _prefetchBlock(std::numeric_limits<size_t>::max()) {}
 
 // prepare the class for destruction when the derived class is destructed.
 // this is necessary because the virtual function of the derived class might get
 // called to empty the cache.
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::shutdown() {
+  stopPrefetch();
   if (_isCurrentBlockChanged) storeBlock();
 
   stopThreads();
@@ -78,31 +122,119 @@ void ThreadedDyscoColumn<DataType>::setShapeColumn(
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::loadBlock(size_t blockIndex) {
   if (blockIndex < nBlocksInFile()) {
-    readCompressedData(blockIndex, _packedBlockReadBuffer.data(), _blockSize);
-    const size_t nPolarizations = _shape[0], nChannels = _shape[1],
-                 nRows = nRowsInBlock(),
-                 nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
-                                                  nChannels, _antennaCount);
-    unsigned char *symbolStart =
-        _packedBlockReadBuffer.data() + nMetaFloats * sizeof(float);
-    BytePacker::unpack(_bitsPerSymbol, _unpackedSymbolReadBuffer.data(),
-                       symbolStart,
-                       symbolCount(nRows, nPolarizations, nChannels));
-    float *metaData = reinterpret_cast<float *>(_packedBlockReadBuffer.data());
-    initializeDecode(_timeBlockBuffer.get(), metaData, nRows, _antennaCount);
-    uint64_t startRow = getRowIndex(blockIndex);
-    _timeBlockBuffer->resize(nRows);
-    for (size_t blockRow = 0; blockRow != nRows; ++blockRow) {
-      int a1 = (*_ant1Col)(startRow + blockRow),
-          a2 = (*_ant2Col)(startRow + blockRow);
-      decode(_timeBlockBuffer.get(), _unpackedSymbolReadBuffer.data(), blockRow,
-             a1, a2);
-    }
+    std::vector<int> antenna1, antenna2;
+    readAntennae(blockIndex, antenna1, antenna2);
+    decodeBlock(blockIndex, antenna1.data(), antenna2.data(),
+                _packedBlockReadBuffer.data(),
+                _unpackedSymbolReadBuffer.data(), _timeBlockBuffer.get());
   }
   _currentBlock = blockIndex;
   _isCurrentBlockChanged = false;
 }
 
+// The antenna columns are read by the calling thread, because table
+// columns can not be accessed from the decoding threads.
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::readAntennae(size_t blockIndex,
+                                                 std::vector<int> &antenna1,
+                                                 std::vector<int> &antenna2) {
+  const size_t nRows = nRowsInBlock();
+  const casacore::Slicer slicer(casacore::IPosition(1, getRowIndex(blockIndex)),
+                                casacore::IPosition(1, nRows));
+  const casacore::Vector<int> a1 = _ant1Col->getColumnRange(slicer),
+                              a2 = _ant2Col->getColumnRange(slicer);
+  antenna1.assign(a1.begin(), a1.end());
+  antenna2.assign(a2.begin(), a2.end());
+}
+
+// Unpack and decode a block. The symbols are unpacked and the rows are
+// decoded in parallel; decoding a row only changes that row of the buffer.
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::decodeBlock(
+    size_t blockIndex, const int *antenna1, const int *antenna2,
+    unsigned char *packedBuffer, unsigned int *unpackedBuffer,
+    TimeBlockBuffer<data_t> *buffer) {
+  readCompressedData(blockIndex, packedBuffer, _blockSize);
+  const size_t nPolarizations = _shape[0], nChannels = _shape[1],
+               nRows = nRowsInBlock(),
+               nMetaFloats = metaDataFloatCount(nRows, nPolarizations,
+                                                nChannels, _antennaCount),
+               nSymbols = symbolCount(nRows, nPolarizations, nChannels);
+  const size_t nThreads =
+      std::max<size_t>(1, std::min(decodeThreadCount(),
+                                   nSymbols / kMinSymbolsPerDecodeThread));
+  unsigned char *symbolStart = packedBuffer + nMetaFloats * sizeof(float);
+  // Every part starts at a multiple of 8 symbols, thus at a byte boundary.
+  parallelFor(nThreads, (nSymbols + 7) / 8, [&](size_t begin, size_t end) {
+    const size_t first = begin * 8, last = std::min(end * 8, nSymbols);
+    if (first < last) {
+      BytePacker::unpack(_bitsPerSymbol, unpackedBuffer + first,
+                         symbolStart + begin * _bitsPerSymbol, last - first);
+    }
+  });
+  float *metaData = reinterpret_cast<float *>(packedBuffer);
+  initializeDecode(buffer, metaData, nRows, _antennaCount);
+  buffer->resize(nRows);
+  parallelFor(nThreads, nRows, [&](size_t begin, size_t end) {
+    for (size_t blockRow = begin; blockRow != end; ++blockRow) {
+      decode(buffer, unpackedBuffer, blockRow, antenna1[blockRow],
+             antenna2[blockRow]);
+    }
+  });
+}
+
+// Start decoding the given block in the background. Nothing is done if the
+// block does not exist or is still in the write cache.
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::startPrefetch(size_t blockIndex) {
+  stopPrefetch();
+  if (blockIndex >= nBlocksInFile() ||
+      getRowIndex(blockIndex) + nRowsInBlock() > _ant1Col->nrow())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_cache.find(blockIndex) != _cache.end()) return;
+  }
+  readAntennae(blockIndex, _prefetchAntenna1, _prefetchAntenna2);
+  if (!_prefetchBuffer) {
+    _prefetchBuffer.reset(new TimeBlockBuffer<data_t>(_shape[0], _shape[1]));
+  }
+  _prefetchPackedBuffer.resize(_blockSize);
+  _prefetchUnpackedBuffer.resize(_unpackedSymbolReadBuffer.size());
+  _prefetchThread = std::thread([this, blockIndex]() {
+    try {
+      decodeBlock(blockIndex, _prefetchAntenna1.data(),
+                  _prefetchAntenna2.data(), _prefetchPackedBuffer.data(),
+                  _prefetchUnpackedBuffer.data(), _prefetchBuffer.get());
+      _prefetchBlock = blockIndex;
+    } catch (...) {
+      // The block is decoded again when it is needed, which will
+      // report the error.
+    }
+  });
+}
+
+// Wait for the background decoding to finish and make the prefetched block
+// the current block if it is the requested one.
+template <typename DataType>
+bool ThreadedDyscoColumn<DataType>::takePrefetchedBlock(size_t blockIndex) {
+  if (_prefetchThread.joinable()) _prefetchThread.join();
+  const bool isPrefetched = _prefetchBlock == blockIndex;
+  if (isPrefetched) {
+    std::swap(_timeBlockBuffer, _prefetchBuffer);
+    _currentBlock = blockIndex;
+    _isCurrentBlockChanged = false;
+  }
+  _prefetchBlock = std::numeric_limits<size_t>::max();
+  return isPrefetched;
+}
+
+template <typename DataType>
+void ThreadedDyscoColumn<DataType>::stopPrefetch() {
+  if (_prefetchThread.joinable()) _prefetchThread.join();
+  _prefetchBlock = std::numeric_limits<size_t>::max();
+}
+
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::getValues(
     casacore::rownr_t rowNr, casacore::Array<DataType> *dataArr) {
@@ -131,7 +263,9 @@ void ThreadedDyscoColumn<DataType>::getValues(
 
       if (_currentBlock != blockIndex) {
         if (_isCurrentBlockChanged) storeBlock();
-        loadBlock(blockIndex);
+        const bool isSequential = blockIndex == _currentBlock + 1;
+        if (!takePrefetchedBlock(blockIndex)) loadBlock(blockIndex);
+        if (isSequential) startPrefetch(blockIndex + 1);
       }
 
       // The time block encoder is now initialized and contains the unpacked
@@ -169,6 +303,8 @@ void ThreadedDyscoColumn<DataType>::storeBlock() {
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::putValues(
     casacore::rownr_t rowNr, const casacore::Array<DataType> *dataArr) {
+  // A block decoded in the background might be changed by this write.
+  stopPrefetch();
   // Make sure array storage is contiguous.
   casacore::Bool deleteIt;
   const DataType* dataPtr = dataArr->getStorage (deleteIt);
@@ -222,6 +358,7 @@ template <typename DataType>
 void ThreadedDyscoColumn<DataType>::Prepare(DyscoDistribution, Normalization,
                                             double /*studentsTNu*/,
                                             double /*distributionTruncation*/) {
+  stopPrefetch();
   stopThreads();
   casacore::Table &table = storageManager().table();
   _ant1Col.reset(new casacore::ScalarColumn<int>(table, "ANTENNA1"));
@@ -233,6 +370,7 @@ void ThreadedDyscoColumn<DataType>::Prepare(DyscoDistribution, Normalization,
   size_t nPolarizations = _shape[0], nChannels = _shape[1];
   _timeBlockBuffer.reset(
       new TimeBlockBuffer<data_t>(nPolarizations, nChannels));
+  _prefetchBuffer.reset();
   if (_antennaCount != 0) {
     // TODO _timeBlockEncoder->SetNAntennae(_antennaCount);
   }
@@ -247,6 +385,7 @@ size_t ThreadedDyscoColumn<DataType>::defaultThreadCount() const {
 
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::InitializeAfterNRowsPerBlockIsKnown() {
+  stopPrefetch();
   stopThreads();
   if (_bitsPerSymbol == 0)
     throw DyscoStManError(
@@ -368,6 +507,7 @@ void ThreadedDyscoColumn<DataType>::SerializeExtraHeader(
 template <typename DataType>
 void ThreadedDyscoColumn<DataType>::UnserializeExtraHeader(
     std::istream &stream) {
+  stopPrefetch();
   Header header;
   header.Unserialize(stream);
   _antennaCount = header.antennaCount;
@@ -12,6 +12,8 @@
 #include <memory>
 #include <mutex>
 #include <random>
+#include <thread>
+#include <vector>
 
 #include "dyscostmancol.h"
 #include "serializable.h"
@@ -57,7 +59,9 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
 
   /**
    * Read the values for a particular row. This will read the required
-   * data and decode it.
+   * data and decode it. The rows of a time block are decoded in parallel.
+   * When the blocks are read in sequential order, the next block is
+   * decoded in the background while the rows of the current block are read.
    * @param rowNr The row number to get the values for.
    * @param dataPtr The array of values, which should be a contiguous array.
    */
@@ -178,16 +182,32 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
   void putValues(casacore::rownr_t rowNr, const casacore::Array<data_t> *dataPtr);
 
   void stopThreads();
+  void startPrefetch(size_t blockIndex);
+  bool takePrefetchedBlock(size_t blockIndex);
+  void stopPrefetch();
   void encodeAndWrite(size_t blockIndex, const CacheItem &item,
                       unsigned char *packedSymbolBuffer,
                       unsigned int *unpackedSymbolBuffer,
                       ThreadDataBase *threadUserData);
   bool isWriteItemAvailable(typename cache_t::iterator &i);
   void loadBlock(size_t blockIndex);
+  void decodeBlock(size_t blockIndex, const int *antenna1,
+                   const int *antenna2, unsigned char *packedBuffer,
+                   unsigned int *unpackedBuffer,
+                   TimeBlockBuffer<data_t> *buffer);
+  void readAntennae(size_t blockIndex, std::vector<int> &antenna1,
+                    std::vector<int> &antenna2);
   void storeBlock();
   size_t maxCacheSize() const {
     return ThreadedDyscoColumn::defaultThreadCount() * 12 / 10 + 1;
   }
+  /**
+   * Number of threads used for decoding. Decoding is deterministic, so
+   * unlike encoding this is not limited by a derived class.
+   */
+  size_t decodeThreadCount() const {
+    return ThreadedDyscoColumn::defaultThreadCount();
+  }
 
   unsigned _bitsPerSymbol;
   casacore::IPosition _shape;
@@ -209,6 +229,16 @@ class ThreadedDyscoColumn : public DyscoStManColumn {
   size_t _antennaCount;
 
   std::unique_ptr<TimeBlockBuffer<data_t>> _timeBlockBuffer;
+
+  // State of the background decoding of the next block. The prefetch thread
+  // is the only user of the decoder while it runs, so it is always joined
+  // before another block is decoded or written.
+  std::thread _prefetchThread;
+  size_t _prefetchBlock;
+  std::vector<int> _prefetchAntenna1, _prefetchAntenna2;
+  ao::uvector<unsigned char> _prefetchPackedBuffer;
+  ao::uvector<unsigned int> _prefetchUnpackedBuffer;
+  std::unique_ptr<TimeBlockBuffer<data_t>> _prefetchBuffer;
 };
 
 template <>
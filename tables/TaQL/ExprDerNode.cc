@@ -37,6 +37,7 @@
 #include <casacore/casa/OS/Time.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <algorithm>
 
 
 
@@ -50,6 +51,9 @@ TableExprNodeConstBool::TableExprNodeConstBool (const Bool& val)
 {}
 Bool TableExprNodeConstBool::getBool (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstBool::getBoolChunk (rownr_t, size_t nrow,
+                                           Bool* values)
+    { std::fill (values, values+nrow, value_p); }
 
 TableExprNodeConstInt::TableExprNodeConstInt (const Int64& val)
 : TableExprNodeBinary (NTInt, VTScalar, OtLiteral, Constant),
@@ -61,6 +65,12 @@ Double TableExprNodeConstInt::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstInt::getDComplex (const TableExprId&)
     { return double(value_p); }
+void TableExprNodeConstInt::getIntChunk (rownr_t, size_t nrow,
+                                         Int64* values)
+    { std::fill (values, values+nrow, value_p); }
+void TableExprNodeConstInt::getDoubleChunk (rownr_t, size_t nrow,
+                                            Double* values)
+    { std::fill (values, values+nrow, Double(value_p)); }
 
 TableExprNodeConstDouble::TableExprNodeConstDouble (const Double& val)
 : TableExprNodeBinary (NTDouble, VTScalar, OtLiteral, Constant),
@@ -70,6 +80,9 @@ Double TableExprNodeConstDouble::getDouble (const TableExprId&)
     { return value_p; }
 DComplex TableExprNodeConstDouble::getDComplex (const TableExprId&)
     { return value_p; }
+void TableExprNodeConstDouble::getDoubleChunk (rownr_t, size_t nrow,
+                                               Double* values)
+    { std::fill (values, values+nrow, value_p); }
 
 TableExprNodeConstDComplex::TableExprNodeConstDComplex (const DComplex& val)
 : TableExprNodeBinary (NTComplex, VTScalar, OtLiteral, Constant),
@@ -204,6 +217,27 @@ Double TableExprNodeColumn::getDouble (const TableExprId& id)
     tabCol_p.getScalar (id.rownr(), val);
     return val;
 }
+void TableExprNodeColumn::getBoolChunk (rownr_t startRow, size_t nrow,
+                                        Bool* values)
+{
+    if (! getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeBinary::getBoolChunk (startRow, nrow, values);
+    }
+}
+void TableExprNodeColumn::getIntChunk (rownr_t startRow, size_t nrow,
+                                       Int64* values)
+{
+    if (! getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeBinary::getIntChunk (startRow, nrow, values);
+    }
+}
+void TableExprNodeColumn::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                          Double* values)
+{
+    if (! getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeBinary::getDoubleChunk (startRow, nrow, values);
+    }
+}
 DComplex TableExprNodeColumn::getDComplex (const TableExprId& id)
 {
     DComplex val;
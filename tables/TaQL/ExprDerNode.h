@@ -76,6 +76,7 @@ public:
     TableExprNodeConstBool (const Bool& value);
     ~TableExprNodeConstBool() override = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
 private:
     Bool value_p;
 };
@@ -109,6 +110,10 @@ public:
     Int64    getInt      (const TableExprId& id) override;
     Double   getDouble   (const TableExprId& id) override;
     DComplex getDComplex (const TableExprId& id) override;
+    void getIntChunk    (rownr_t startRow, size_t nrow,
+                         Int64* values) override;
+    void getDoubleChunk (rownr_t startRow, size_t nrow,
+                         Double* values) override;
 private:
     Int64 value_p;
 };
@@ -141,6 +146,8 @@ public:
     ~TableExprNodeConstDouble() override = default;
     Double   getDouble   (const TableExprId& id) override;
     DComplex getDComplex (const TableExprId& id) override;
+    void getDoubleChunk (rownr_t startRow, size_t nrow,
+                         Double* values) override;
 private:
     Double value_p;
 };
@@ -320,6 +327,16 @@ public:
     String   getString   (const TableExprId& id) override;
     const TableColumn& getColumn() const;
 
+    // Get the data for a chunk of rows using a single column read.
+    // <group>
+    void getBoolChunk   (rownr_t startRow, size_t nrow,
+                         Bool* values) override;
+    void getIntChunk    (rownr_t startRow, size_t nrow,
+                         Int64* values) override;
+    void getDoubleChunk (rownr_t startRow, size_t nrow,
+                         Double* values) override;
+    // </group>
+
     // Get the data for the given rows.
     Array<Bool>     getColumnBool (const Vector<rownr_t>& rownrs) override;
     Array<uChar>    getColumnuChar (const Vector<rownr_t>& rownrs) override;
@@ -42,6 +42,7 @@
 #include <casacore/casa/BasicSL/Constants.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <cmath>
 #include <iomanip>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -865,6 +866,122 @@ Double TableExprFuncNode::getDouble (const TableExprId& id)
     return 0;
 }
 
+void TableExprFuncNode::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                        Double* values)
+{
+    if (dataType() != NTDouble  ||  valueType() != VTScalar) {
+        TableExprNodeMulti::getDoubleChunk (startRow, nrow, values);
+        return;
+    }
+    Double (*func)(Double) = 0;
+    Double (*func2)(Double, Double) = 0;
+    switch (funcType_p) {
+    case sinFUNC:
+        func = std::sin;
+        break;
+    case sinhFUNC:
+        func = std::sinh;
+        break;
+    case cosFUNC:
+        func = std::cos;
+        break;
+    case coshFUNC:
+        func = std::cosh;
+        break;
+    case expFUNC:
+        func = std::exp;
+        break;
+    case logFUNC:
+        func = std::log;
+        break;
+    case log10FUNC:
+        func = std::log10;
+        break;
+    case asinFUNC:
+        func = std::asin;
+        break;
+    case acosFUNC:
+        func = std::acos;
+        break;
+    case atanFUNC:
+        func = std::atan;
+        break;
+    case tanFUNC:
+        func = std::tan;
+        break;
+    case tanhFUNC:
+        func = std::tanh;
+        break;
+    case powFUNC:
+        func2 = std::pow;
+        break;
+    case atan2FUNC:
+        func2 = std::atan2;
+        break;
+    case sqrtFUNC:
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] = std::sqrt(values[i]) * scale_p;
+        }
+        return;
+    case squareFUNC:
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] *= values[i];
+        }
+        return;
+    case cubeFUNC:
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] *= values[i] * values[i];
+        }
+        return;
+    case absFUNC:
+        if (argDataType_p != NTDouble) {
+            break;
+        }
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] = std::abs(values[i]);
+        }
+        return;
+    case minFUNC:
+    case maxFUNC:
+      {
+        std::vector<Double> right(nrow);
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        operands_p[1]->getDoubleChunk (startRow, nrow, right.data());
+        if (funcType_p == minFUNC) {
+          for (size_t i=0; i<nrow; ++i) {
+            values[i] = min (values[i], right[i]);
+          }
+        } else {
+          for (size_t i=0; i<nrow; ++i) {
+            values[i] = max (values[i], right[i]);
+          }
+        }
+        return;
+      }
+    default:
+        break;
+    }
+    if (func) {
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] = func (values[i]);
+        }
+    } else if (func2) {
+        std::vector<Double> right(nrow);
+        operands_p[0]->getDoubleChunk (startRow, nrow, values);
+        operands_p[1]->getDoubleChunk (startRow, nrow, right.data());
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] = func2 (values[i], right[i]);
+        }
+    } else {
+        TableExprNodeMulti::getDoubleChunk (startRow, nrow, values);
+    }
+}
+
 DComplex TableExprFuncNode::getDComplex (const TableExprId& id)
 {
     if (dataType() == NTDouble) {
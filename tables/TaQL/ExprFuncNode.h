@@ -365,6 +365,10 @@ public:
     MVTime    getDate     (const TableExprId& id);
     // </group>
 
+    // Get the values for a chunk of rows. It is implemented for the
+    // common mathematical functions; the others are evaluated per row.
+    void getDoubleChunk (rownr_t startRow, size_t nrow, Double* values);
+
     // Check the data and value types of the operands.
     // It sets the exptected data and value types of the operands.
     // Set the value type of the function result and returns
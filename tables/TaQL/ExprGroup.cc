@@ -163,6 +163,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     { return False; }
   void TableExprGroupFuncBase::finish()
   {}
+  Bool TableExprGroupFuncBase::canMerge() const
+    { return False; }
+  void TableExprGroupFuncBase::merge (TableExprGroupFuncBase&)
+  { throw TableInvExpr ("TableExprGroupFuncBase::merge not implemented"); }
   std::shared_ptr<vector<TableExprId>> TableExprGroupFuncBase::getIds() const
   { throw TableInvExpr ("TableExprGroupFuncBase::getIds not implemented"); }
   Bool TableExprGroupFuncBase::getBool (const vector<TableExprId>&)
@@ -216,6 +220,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsId = id;
     }
   }
+  Bool TableExprGroupFirst::canMerge() const
+    { return True; }
+  void TableExprGroupFirst::merge (TableExprGroupFuncBase& other)
+  {
+    if (itsId.rownr() < 0) {
+      itsId = static_cast<TableExprGroupFirst&>(other).itsId;
+    }
+  }
   Bool TableExprGroupFirst::getBool (const vector<TableExprId>&)
     { return itsOperand->getBool (itsId); }
   Int64 TableExprGroupFirst::getInt (const vector<TableExprId>&)
@@ -250,6 +262,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsId = id;
   }
+  void TableExprGroupLast::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprId& id = static_cast<TableExprGroupLast&>(other).itsId;
+    if (id.rownr() >= 0) {
+      itsId = id;
+    }
+  }
 
   TableExprGroupExprId::TableExprGroupExprId (TableExprNodeRep* node)
     : TableExprGroupFuncBase (node)
@@ -266,6 +285,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsIds->push_back (id);
   }
+  Bool TableExprGroupExprId::canMerge() const
+    { return True; }
+  void TableExprGroupExprId::merge (TableExprGroupFuncBase& other)
+  {
+    const vector<TableExprId>& ids =
+      *static_cast<TableExprGroupExprId&>(other).itsIds;
+    itsIds->insert (itsIds->end(), ids.begin(), ids.end());
+  }
   std::shared_ptr<vector<TableExprId>> TableExprGroupExprId::getIds() const
   {
     return itsIds;
@@ -489,5 +516,25 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
   }
 
+  Bool TableExprGroupFuncSet::canMerge() const
+  {
+    for (uInt i=0; i<itsFuncs.size(); ++i) {
+      if (! itsFuncs[i]->canMerge()) {
+        return False;
+      }
+    }
+    return True;
+  }
+
+  void TableExprGroupFuncSet::merge (TableExprGroupFuncSet& other)
+  {
+    AlwaysAssert (other.itsFuncs.size() == itsFuncs.size(), AipsError);
+    // The other set contains the later rows.
+    itsId = other.itsId;
+    for (uInt i=0; i<itsFuncs.size(); ++i) {
+      itsFuncs[i]->merge (*other.itsFuncs[i]);
+    }
+  }
+
 
 } //# NAMESPACE CASACORE - END
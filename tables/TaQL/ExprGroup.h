@@ -221,6 +221,16 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // If needed, finish the aggregation.
     // By default nothing is done.
     virtual void finish();
+    // Can the (unfinished) aggregation result of another function object
+    // be merged into this one? It makes it possible to aggregate parts of
+    // a table in parallel. The default implementation returns False.
+    virtual Bool canMerge() const;
+    // Merge the aggregation result of another object of the same class
+    // into this one. The rows aggregated in <src>other</src> must be
+    // after the rows aggregated in this object. It is done before
+    // <src>finish</src> is called.
+    // The default implementation throws an exception.
+    virtual void merge (TableExprGroupFuncBase& other);
     // Get the assembled TableExprIds of a group. It is specifically meant
     // for TableExprGroupExprId used for lazy aggregation.
     virtual std::shared_ptr<vector<TableExprId>> getIds() const;
@@ -285,6 +295,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupFirst (TableExprNodeRep* node);
     virtual ~TableExprGroupFirst();
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (TableExprGroupFuncBase& other);
     virtual Bool getBool (const vector<TableExprId>&);
     virtual Int64 getInt (const vector<TableExprId>&);
     virtual Double getDouble (const vector<TableExprId>&);
@@ -318,6 +330,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     explicit TableExprGroupLast (TableExprNodeRep* node);
     virtual ~TableExprGroupLast();
     virtual void apply (const TableExprId& id);
+    virtual void merge (TableExprGroupFuncBase& other);
   };
 
   // <summary>
@@ -338,6 +351,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     virtual ~TableExprGroupExprId();
     virtual Bool isLazy() const;
     virtual void apply (const TableExprId& id);
+    virtual Bool canMerge() const;
+    virtual void merge (TableExprGroupFuncBase& other);
     virtual std::shared_ptr<vector<TableExprId>> getIds() const;
   private:
     std::shared_ptr<vector<TableExprId>> itsIds;
@@ -815,6 +830,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Apply the functions to the given row.
     void apply (const TableExprId& id);
 
+    // Can all functions in the set be merged?
+    Bool canMerge() const;
+
+    // Merge the functions of another set (containing rows after the rows
+    // in this set) into the functions of this set.
+    void merge (TableExprGroupFuncSet& other);
+
     // Get the vector of functions.
     const vector<std::shared_ptr<TableExprGroupFuncBase>>& getFuncs() const
       { return itsFuncs; }
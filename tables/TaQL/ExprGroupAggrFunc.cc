@@ -47,6 +47,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue++;
   }
+  Bool TableExprGroupCountAll::canMerge() const
+    { return True; }
+  void TableExprGroupCountAll::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupCountAll& o =
+      static_cast<TableExprGroupCountAll&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupCount::TableExprGroupCount (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node),
@@ -71,6 +79,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       itsValue++;
     }
   }
+  Bool TableExprGroupCount::canMerge() const
+    { return True; }
+  void TableExprGroupCount::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupCount& o = static_cast<TableExprGroupCount&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupAny::TableExprGroupAny (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, False)
@@ -82,6 +97,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue = True;
   }
+  Bool TableExprGroupAny::canMerge() const
+    { return True; }
+  void TableExprGroupAny::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupAny& o = static_cast<TableExprGroupAny&>(other);
+    if (o.itsValue) itsValue = True;
+  }
 
   TableExprGroupAll::TableExprGroupAll (TableExprNodeRep* node)
     : TableExprGroupFuncBool (node, True)
@@ -93,6 +115,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue = False;
   }
+  Bool TableExprGroupAll::canMerge() const
+    { return True; }
+  void TableExprGroupAll::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupAll& o = static_cast<TableExprGroupAll&>(other);
+    if (!o.itsValue) itsValue = False;
+  }
 
   TableExprGroupNTrue::TableExprGroupNTrue (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -104,6 +133,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (v) itsValue++;
   }
+  Bool TableExprGroupNTrue::canMerge() const
+    { return True; }
+  void TableExprGroupNTrue::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupNTrue& o = static_cast<TableExprGroupNTrue&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupNFalse::TableExprGroupNFalse (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -115,6 +151,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Bool v = itsOperand->getBool(id);
     if (!v) itsValue++;
   }
+  Bool TableExprGroupNFalse::canMerge() const
+    { return True; }
+  void TableExprGroupNFalse::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupNFalse& o = static_cast<TableExprGroupNFalse&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupMinInt::TableExprGroupMinInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::max())
@@ -126,6 +169,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinInt::canMerge() const
+    { return True; }
+  void TableExprGroupMinInt::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMinInt& o = static_cast<TableExprGroupMinInt&>(other);
+    if (o.itsValue<itsValue) itsValue = o.itsValue;
+  }
 
   TableExprGroupMaxInt::TableExprGroupMaxInt (TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, std::numeric_limits<Int64>::min())
@@ -137,6 +187,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxInt::canMerge() const
+    { return True; }
+  void TableExprGroupMaxInt::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMaxInt& o = static_cast<TableExprGroupMaxInt&>(other);
+    if (o.itsValue>itsValue) itsValue = o.itsValue;
+  }
 
   TableExprGroupSumInt::TableExprGroupSumInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -147,6 +204,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getInt(id);
   }
+  Bool TableExprGroupSumInt::canMerge() const
+    { return True; }
+  void TableExprGroupSumInt::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumInt& o = static_cast<TableExprGroupSumInt&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupProductInt::TableExprGroupProductInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node, 1)
@@ -157,6 +221,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getInt(id);
   }
+  Bool TableExprGroupProductInt::canMerge() const
+    { return True; }
+  void TableExprGroupProductInt::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductInt& o =
+      static_cast<TableExprGroupProductInt&>(other);
+    itsValue *= o.itsValue;
+  }
 
   TableExprGroupSumSqrInt::TableExprGroupSumSqrInt(TableExprNodeRep* node)
     : TableExprGroupFuncInt (node)
@@ -168,6 +240,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 v = itsOperand->getInt(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrInt::canMerge() const
+    { return True; }
+  void TableExprGroupSumSqrInt::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrInt& o =
+      static_cast<TableExprGroupSumSqrInt&>(other);
+    itsValue += o.itsValue;
+  }
 
 
   TableExprGroupMinDouble::TableExprGroupMinDouble(TableExprNodeRep* node)
@@ -180,6 +260,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v<itsValue) itsValue = v;
   }
+  Bool TableExprGroupMinDouble::canMerge() const
+    { return True; }
+  void TableExprGroupMinDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMinDouble& o =
+      static_cast<TableExprGroupMinDouble&>(other);
+    if (o.itsValue<itsValue) itsValue = o.itsValue;
+  }
 
   TableExprGroupMaxDouble::TableExprGroupMaxDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, std::numeric_limits<Double>::min())
@@ -191,6 +279,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     if (v>itsValue) itsValue = v;
   }
+  Bool TableExprGroupMaxDouble::canMerge() const
+    { return True; }
+  void TableExprGroupMaxDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMaxDouble& o =
+      static_cast<TableExprGroupMaxDouble&>(other);
+    if (o.itsValue>itsValue) itsValue = o.itsValue;
+  }
 
   TableExprGroupSumDouble::TableExprGroupSumDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -201,6 +297,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDouble(id);
   }
+  Bool TableExprGroupSumDouble::canMerge() const
+    { return True; }
+  void TableExprGroupSumDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumDouble& o =
+      static_cast<TableExprGroupSumDouble&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupProductDouble::TableExprGroupProductDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node, 1)
@@ -211,6 +315,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDouble(id);
   }
+  Bool TableExprGroupProductDouble::canMerge() const
+    { return True; }
+  void TableExprGroupProductDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductDouble& o =
+      static_cast<TableExprGroupProductDouble&>(other);
+    itsValue *= o.itsValue;
+  }
 
   TableExprGroupSumSqrDouble::TableExprGroupSumSqrDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node)
@@ -222,6 +334,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Double v = itsOperand->getDouble(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDouble::canMerge() const
+    { return True; }
+  void TableExprGroupSumSqrDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrDouble& o =
+      static_cast<TableExprGroupSumSqrDouble&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupMeanDouble::TableExprGroupMeanDouble(TableExprNodeRep* node)
     : TableExprGroupFuncDouble (node),
@@ -234,6 +354,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += itsOperand->getDouble(id);
     itsNr++;
   }
+  Bool TableExprGroupMeanDouble::canMerge() const
+    { return True; }
+  void TableExprGroupMeanDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDouble& o =
+      static_cast<TableExprGroupMeanDouble&>(other);
+    itsValue += o.itsValue;
+    itsNr    += o.itsNr;
+  }
   void TableExprGroupMeanDouble::finish()
   {
     if (itsNr > 0) {
@@ -260,6 +389,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsCurMean += delta/itsNr;
     itsValue   += delta*(v-itsCurMean);   // itsValue contains the M2 value
   }
+  Bool TableExprGroupVarianceDouble::canMerge() const
+    { return True; }
+  void TableExprGroupVarianceDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupVarianceDouble& o =
+      static_cast<TableExprGroupVarianceDouble&>(other);
+    // Combine the mean and M2 values of both parts (Chan et al.).
+    if (o.itsNr > 0) {
+      Int64 nr = itsNr + o.itsNr;
+      Double delta = o.itsCurMean - itsCurMean;
+      itsValue   += o.itsValue + delta*delta * itsNr / nr * o.itsNr;
+      itsCurMean += delta * o.itsNr / nr;
+      itsNr = nr;
+    }
+  }
   void TableExprGroupVarianceDouble::finish()
   {
     if (itsNr > itsDdof) {
@@ -292,6 +436,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += v*v;
     itsNr++;
   }
+  Bool TableExprGroupRmsDouble::canMerge() const
+    { return True; }
+  void TableExprGroupRmsDouble::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupRmsDouble& o =
+      static_cast<TableExprGroupRmsDouble&>(other);
+    itsValue += o.itsValue;
+    itsNr    += o.itsNr;
+  }
   void TableExprGroupRmsDouble::finish()
   {
     if (itsNr > 0) {
@@ -337,6 +490,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue += itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupSumDComplex::canMerge() const
+    { return True; }
+  void TableExprGroupSumDComplex::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumDComplex& o =
+      static_cast<TableExprGroupSumDComplex&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupProductDComplex::TableExprGroupProductDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node, DComplex(1,0))
@@ -347,6 +508,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     itsValue *= itsOperand->getDComplex(id);
   }
+  Bool TableExprGroupProductDComplex::canMerge() const
+    { return True; }
+  void TableExprGroupProductDComplex::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupProductDComplex& o =
+      static_cast<TableExprGroupProductDComplex&>(other);
+    itsValue *= o.itsValue;
+  }
 
   TableExprGroupSumSqrDComplex::TableExprGroupSumSqrDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node)
@@ -358,6 +527,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     DComplex v = itsOperand->getDComplex(id);
     itsValue += v*v;
   }
+  Bool TableExprGroupSumSqrDComplex::canMerge() const
+    { return True; }
+  void TableExprGroupSumSqrDComplex::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupSumSqrDComplex& o =
+      static_cast<TableExprGroupSumSqrDComplex&>(other);
+    itsValue += o.itsValue;
+  }
 
   TableExprGroupMeanDComplex::TableExprGroupMeanDComplex(TableExprNodeRep* node)
     : TableExprGroupFuncDComplex (node),
@@ -370,6 +547,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsValue += itsOperand->getDComplex(id);
     itsNr++;
   }
+  Bool TableExprGroupMeanDComplex::canMerge() const
+    { return True; }
+  void TableExprGroupMeanDComplex::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupMeanDComplex& o =
+      static_cast<TableExprGroupMeanDComplex&>(other);
+    itsValue += o.itsValue;
+    itsNr    += o.itsNr;
+  }
   void TableExprGroupMeanDComplex::finish()
   {
     if (itsNr > 0) {
@@ -396,6 +582,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     DComplex d = v - itsCurMean;
     itsValue += real(delta)*real(d) + imag(delta)*imag(d);
   }
+  Bool TableExprGroupVarianceDComplex::canMerge() const
+    { return True; }
+  void TableExprGroupVarianceDComplex::merge (TableExprGroupFuncBase& other)
+  {
+    const TableExprGroupVarianceDComplex& o =
+      static_cast<TableExprGroupVarianceDComplex&>(other);
+    // Combine the mean and M2 values of both parts (Chan et al.).
+    if (o.itsNr > 0) {
+      Int64 nr = itsNr + o.itsNr;
+      DComplex delta = o.itsCurMean - itsCurMean;
+      itsValue   += o.itsValue + norm(delta) * itsNr / nr * o.itsNr;
+      itsCurMean += delta * (Double(o.itsNr) / nr);
+      itsNr = nr;
+    }
+  }
   void TableExprGroupVarianceDComplex::finish()
   {
     if (itsNr > itsDdof) {
@@ -32,6 +32,10 @@
 #include <casacore/casa/Quanta/MVTime.h>
 #include <float.h>                     // for DBL_MAX
 #include <limits.h>                     // for DBL_MAX
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -53,6 +57,17 @@ Bool TableExprNodeEQInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) == rnode_p->getInt(id);
 }
+void TableExprNodeEQInt::getBoolChunk (rownr_t startRow, size_t nrow,
+                                       Bool* values)
+{
+    std::vector<Int64> left(nrow);
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, left.data());
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] == right[i];
+    }
+}
 
 TableExprNodeEQDouble::TableExprNodeEQDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -61,6 +76,17 @@ Bool TableExprNodeEQDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) == rnode_p->getDouble(id);
 }
+void TableExprNodeEQDouble::getBoolChunk (rownr_t startRow, size_t nrow,
+                                          Bool* values)
+{
+    std::vector<Double> left(nrow);
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, left.data());
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] == right[i];
+    }
+}
 
 TableExprNodeEQDComplex::TableExprNodeEQDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtEQ)
@@ -110,6 +136,17 @@ Bool TableExprNodeNEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) != rnode_p->getInt(id);
 }
+void TableExprNodeNEInt::getBoolChunk (rownr_t startRow, size_t nrow,
+                                       Bool* values)
+{
+    std::vector<Int64> left(nrow);
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, left.data());
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] != right[i];
+    }
+}
 
 TableExprNodeNEDouble::TableExprNodeNEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -118,6 +155,17 @@ Bool TableExprNodeNEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) != rnode_p->getDouble(id);
 }
+void TableExprNodeNEDouble::getBoolChunk (rownr_t startRow, size_t nrow,
+                                          Bool* values)
+{
+    std::vector<Double> left(nrow);
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, left.data());
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] != right[i];
+    }
+}
 
 TableExprNodeNEDComplex::TableExprNodeNEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtNE)
@@ -159,6 +207,17 @@ Bool TableExprNodeGTInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) > rnode_p->getInt(id);
 }
+void TableExprNodeGTInt::getBoolChunk (rownr_t startRow, size_t nrow,
+                                       Bool* values)
+{
+    std::vector<Int64> left(nrow);
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, left.data());
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] > right[i];
+    }
+}
 
 TableExprNodeGTDouble::TableExprNodeGTDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -167,6 +226,17 @@ Bool TableExprNodeGTDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) > rnode_p->getDouble(id);
 }
+void TableExprNodeGTDouble::getBoolChunk (rownr_t startRow, size_t nrow,
+                                          Bool* values)
+{
+    std::vector<Double> left(nrow);
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, left.data());
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] > right[i];
+    }
+}
 
 TableExprNodeGTDComplex::TableExprNodeGTDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGT)
@@ -200,6 +270,17 @@ Bool TableExprNodeGEInt::getBool (const TableExprId& id)
 {
     return lnode_p->getInt(id) >= rnode_p->getInt(id);
 }
+void TableExprNodeGEInt::getBoolChunk (rownr_t startRow, size_t nrow,
+                                       Bool* values)
+{
+    std::vector<Int64> left(nrow);
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, left.data());
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] >= right[i];
+    }
+}
 
 TableExprNodeGEDouble::TableExprNodeGEDouble (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -208,6 +289,17 @@ Bool TableExprNodeGEDouble::getBool (const TableExprId& id)
 {
     return lnode_p->getDouble(id) >= rnode_p->getDouble(id);
 }
+void TableExprNodeGEDouble::getBoolChunk (rownr_t startRow, size_t nrow,
+                                          Bool* values)
+{
+    std::vector<Double> left(nrow);
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, left.data());
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = left[i] >= right[i];
+    }
+}
 
 TableExprNodeGEDComplex::TableExprNodeGEDComplex (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtGE)
@@ -240,6 +332,10 @@ TableExprNodeINInt::TableExprNodeINInt (const TableExprNodeRep& node,
 {}
 void TableExprNodeINInt::optimize()
 {
+  // Keep the original set, so its ranges can be determined.
+  if (rnode_p->isConstant()) {
+    origRnode_p = rnode_p;
+  }
   doOptimize (rnode_p);
 }
 void TableExprNodeINInt::doOptimize (TENShPtr& rnode)
@@ -252,7 +348,7 @@ void TableExprNodeINInt::doOptimize (TENShPtr& rnode)
       // Remove masked elements.
       arr.reference (values.flatten());
     }
-    // Use an unordered_map for fast lookup.
+    // Use a hash map for fast lookup.
     rnode = std::make_shared<TableExprNodeSetOptUSet<Int64>>(*rnode, arr);
   }
 }
@@ -267,6 +363,10 @@ TableExprNodeINDouble::TableExprNodeINDouble (const TableExprNodeRep& node)
 {}
 void TableExprNodeINDouble::optimize()
 {
+  // Keep the original set, so its ranges can be determined.
+  if (rnode_p->isConstant()) {
+    origRnode_p = rnode_p;
+  }
   doOptimize (rnode_p);
 }
 void TableExprNodeINDouble::doOptimize (TENShPtr& rnode)
@@ -308,7 +408,7 @@ void TableExprNodeINString::doOptimize (TENShPtr& rnode)
         rnode = TableExprNodeSetOptContSetBase<String>::transform (set);
       }
     } else if (rnode->valueType() == VTArray) {
-      // Convert a constant array to an unordered_set for faster lookup.
+      // Convert a constant array to a hash map for faster lookup.
       MArray<String> values = rnode->getArrayString(0);
       Array<String> arr(values.array());
       if (values.hasMask()) {
@@ -346,6 +446,83 @@ Bool TableExprNodeINDate::getBool (const TableExprId& id)
 }
 
 
+// Can the node be evaluated for all rows in a chunk?
+// That is the case for scalar arithmetic and comparisons of scalar columns
+// and constants, because they cannot throw an exception.
+static Bool canEvalWholeChunk (TableExprNodeRep* node)
+{
+    std::vector<TableExprNodeRep*> nodes;
+    node->flattenTree (nodes);
+    for (TableExprNodeRep* nodeP : nodes) {
+        if (nodeP->valueType() != TableExprNodeRep::VTScalar) {
+            return False;
+        }
+        switch (nodeP->dataType()) {
+        case TableExprNodeRep::NTBool:
+        case TableExprNodeRep::NTInt:
+        case TableExprNodeRep::NTDouble:
+            break;
+        default:
+            return False;
+        }
+        switch (nodeP->operType()) {
+        case TableExprNodeRep::OtPlus:
+        case TableExprNodeRep::OtMinus:
+        case TableExprNodeRep::OtTimes:
+        case TableExprNodeRep::OtDivide:
+        case TableExprNodeRep::OtEQ:
+        case TableExprNodeRep::OtGE:
+        case TableExprNodeRep::OtGT:
+        case TableExprNodeRep::OtNE:
+        case TableExprNodeRep::OtAND:
+        case TableExprNodeRep::OtOR:
+        case TableExprNodeRep::OtNOT:
+        case TableExprNodeRep::OtMIN:
+        case TableExprNodeRep::OtLiteral:
+            break;
+        case TableExprNodeRep::OtColumn:
+            if (! dynamic_cast<TableExprNodeColumn*>(nodeP)) {
+                return False;
+            }
+            break;
+        default:
+            return False;
+        }
+    }
+    return True;
+}
+
+// Combine the result of the left operand of && (skipValue=True) or
+// || (skipValue=False) with the right operand.
+// As in getBool, the right operand is only evaluated for the rows where
+// the left value does not determine the result, unless the rows are all
+// undetermined or the right operand can be evaluated for all rows.
+static void evalRightChunk (TableExprNodeRep* rnode, Bool skipValue,
+                            rownr_t startRow, size_t nrow, Bool* values)
+{
+    size_t nundet = std::count (values, values+nrow, skipValue);
+    if (nundet == 0) {
+        return;
+    }
+    if (nundet == nrow  ||  canEvalWholeChunk (rnode)) {
+        std::unique_ptr<Bool[]> right(new Bool[nrow]);
+        rnode->getBoolChunk (startRow, nrow, right.get());
+        for (size_t i=0; i<nrow; ++i) {
+            if (values[i] == skipValue) {
+                values[i] = right[i];
+            }
+        }
+    } else {
+        TableExprId id;
+        for (size_t i=0; i<nrow; ++i) {
+            if (values[i] == skipValue) {
+                id.setRownr (startRow+i);
+                values[i] = rnode->getBool (id);
+            }
+        }
+    }
+}
+
 TableExprNodeOR::TableExprNodeOR (const TableExprNodeRep& node)
 : TableExprNodeBinary (NTBool, node, OtOR)
 {}
@@ -353,6 +530,12 @@ Bool TableExprNodeOR::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) || rnode_p->getBool(id);
 }
+void TableExprNodeOR::getBoolChunk (rownr_t startRow, size_t nrow,
+                                    Bool* values)
+{
+    lnode_p->getBoolChunk (startRow, nrow, values);
+    evalRightChunk (rnode_p.get(), False, startRow, nrow, values);
+}
 
 
 TableExprNodeAND::TableExprNodeAND (const TableExprNodeRep& node)
@@ -362,6 +545,12 @@ Bool TableExprNodeAND::getBool (const TableExprId& id)
 {
     return lnode_p->getBool(id) && rnode_p->getBool(id);
 }
+void TableExprNodeAND::getBoolChunk (rownr_t startRow, size_t nrow,
+                                     Bool* values)
+{
+    lnode_p->getBoolChunk (startRow, nrow, values);
+    evalRightChunk (rnode_p.get(), True, startRow, nrow, values);
+}
 
 
 TableExprNodeNOT::TableExprNodeNOT (const TableExprNodeRep& node)
@@ -371,6 +560,14 @@ Bool TableExprNodeNOT::getBool (const TableExprId& id)
 {
   return ! lnode_p->getBool(id);
 }
+void TableExprNodeNOT::getBoolChunk (rownr_t startRow, size_t nrow,
+                                     Bool* values)
+{
+    lnode_p->getBoolChunk (startRow, nrow, values);
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = !values[i];
+    }
+}
 
 
 
@@ -444,7 +641,7 @@ void TableExprNodeGTDouble::ranges (std::vector<TableExprRange>& blrange)
         end = DBL_MAX;
     }else{
         if (rnode_p->operType()  == TableExprNodeRep::OtColumn
-        &&  lnode_p->valueType() == TableExprNodeRep::VTScalar
+        &&  rnode_p->valueType() == TableExprNodeRep::VTScalar
         &&  lnode_p->operType()  == TableExprNodeRep::OtLiteral) {
             tsncol = rnode_p;
             end = lnode_p->getDouble (0);
@@ -459,6 +656,155 @@ void TableExprNodeGTDouble::ranges (std::vector<TableExprRange>& blrange)
 }
 
 
+//# Create the range of a comparison of a scalar column with a literal.
+//# The range is [literal,DBL_MAX] if the column is the left operand,
+//# otherwise [-DBL_MAX,literal]. It is a single value for ==.
+//# A closed range is used for > and <, because the ranges only need to be
+//# a superset of the values to select.
+static void makeCompareRange (std::vector<TableExprRange>& blrange,
+                              const TENShPtr& lnode, const TENShPtr& rnode,
+                              Bool isEQ)
+{
+    Double st = 0;
+    Double end = 0;
+    TENShPtr tsncol = 0;
+    if (lnode->operType()  == TableExprNodeRep::OtColumn
+    &&  lnode->valueType() == TableExprNodeRep::VTScalar
+    &&  rnode->operType()  == TableExprNodeRep::OtLiteral) {
+        tsncol = lnode;
+        st = rnode->getDouble (0);
+        end = (isEQ  ?  st : DBL_MAX);
+    } else if (rnode->operType()  == TableExprNodeRep::OtColumn
+           &&  rnode->valueType() == TableExprNodeRep::VTScalar
+           &&  lnode->operType()  == TableExprNodeRep::OtLiteral) {
+        tsncol = rnode;
+        end = lnode->getDouble (0);
+        st = (isEQ  ?  end : -DBL_MAX);
+    }
+    TableExprNodeRep::createRange (blrange,
+                                   dynamic_cast<TableExprNodeColumn*>(tsncol.get()),
+                                   st, end);
+}
+
+void TableExprNodeEQInt::ranges (std::vector<TableExprRange>& blrange)
+{
+    makeCompareRange (blrange, lnode_p, rnode_p, True);
+}
+
+void TableExprNodeGEInt::ranges (std::vector<TableExprRange>& blrange)
+{
+    makeCompareRange (blrange, lnode_p, rnode_p, False);
+}
+
+void TableExprNodeGTInt::ranges (std::vector<TableExprRange>& blrange)
+{
+    makeCompareRange (blrange, lnode_p, rnode_p, False);
+}
+
+
+//# Create the ranges of a scalar column compared with a constant set
+//# or array using IN. A discrete interval (start:end:incr) is taken as
+//# a whole; it runs from end to start if the increment is negative.
+//# No range is created for mid-width intervals or for sets containing
+//# arrays.
+static void makeInRanges (std::vector<TableExprRange>& blrange,
+                          const TENShPtr& lnode, const TENShPtr& rnode)
+{
+    blrange.resize (0);
+    TableExprNodeColumn* tsncol = 0;
+    if (lnode->operType() == TableExprNodeRep::OtColumn
+    &&  lnode->valueType() == TableExprNodeRep::VTScalar
+    &&  rnode  &&  rnode->isConstant()) {
+        tsncol = dynamic_cast<TableExprNodeColumn*>(lnode.get());
+    }
+    if (tsncol == 0) {
+        return;
+    }
+    std::vector<std::pair<Double,Double>> intervals;
+    if (rnode->valueType() == TableExprNodeRep::VTArray) {
+        if (rnode->dataType() == TableExprNodeRep::NTInt) {
+            MArray<Int64> values = rnode->getArrayInt (0);
+            Array<Int64> arr(values.hasMask() ? values.flatten() : values.array());
+            for (auto v : arr) {
+                intervals.push_back (std::make_pair (Double(v), Double(v)));
+            }
+        } else if (rnode->dataType() == TableExprNodeRep::NTDouble) {
+            MArray<Double> values = rnode->getArrayDouble (0);
+            Array<Double> arr(values.hasMask() ? values.flatten() : values.array());
+            for (auto v : arr) {
+                intervals.push_back (std::make_pair (v, v));
+            }
+        } else {
+            return;
+        }
+    } else if (rnode->valueType() == TableExprNodeRep::VTSet) {
+        const TableExprNodeSet& set =
+            dynamic_cast<const TableExprNodeSet&>(*rnode);
+        if (set.hasArrays()) {
+            return;
+        }
+        for (size_t i=0; i<set.size(); ++i) {
+            const TableExprNodeSetElemBase& elem = *(set[i]);
+            if (elem.isMidWidth()
+            ||  (elem.dataType() != TableExprNodeRep::NTInt
+                 &&  elem.dataType() != TableExprNodeRep::NTDouble)) {
+                return;
+            }
+            Double st  = -DBL_MAX;
+            Double end = DBL_MAX;
+            if (elem.start()) {
+                st = elem.start()->getDouble (0);
+            }
+            if (elem.isSingle()) {
+                end = st;
+            } else if (elem.end()) {
+                end = elem.end()->getDouble (0);
+            }
+            if (elem.isDiscrete()  &&  elem.increment()) {
+                if (! elem.increment()->isConstant()) {
+                    return;
+                }
+                if (elem.increment()->getDouble (0) < 0) {
+                    // Descending, so the start is the upper bound.
+                    end = (elem.start()  ?  st : DBL_MAX);
+                    st  = (elem.end()  ?  elem.end()->getDouble (0) : -DBL_MAX);
+                }
+            }
+            intervals.push_back (std::make_pair (st, end));
+        }
+    } else {
+        return;
+    }
+    //# Order the intervals and combine overlapping ones.
+    std::sort (intervals.begin(), intervals.end());
+    Vector<Double> stv(intervals.size());
+    Vector<Double> endv(intervals.size());
+    size_t nr = 0;
+    for (const auto& interval : intervals) {
+        if (nr > 0  &&  interval.first <= endv[nr-1]) {
+            endv[nr-1] = std::max (endv[nr-1], interval.second);
+        } else {
+            stv[nr]  = interval.first;
+            endv[nr] = interval.second;
+            nr++;
+        }
+    }
+    stv.resize (nr, True);
+    endv.resize (nr, True);
+    blrange.push_back (TableExprRange (tsncol->getColumn(), stv, endv));
+}
+
+void TableExprNodeINInt::ranges (std::vector<TableExprRange>& blrange)
+{
+    makeInRanges (blrange, lnode_p, origRnode_p ? origRnode_p : rnode_p);
+}
+
+void TableExprNodeINDouble::ranges (std::vector<TableExprRange>& blrange)
+{
+    makeInRanges (blrange, lnode_p, origRnode_p ? origRnode_p : rnode_p);
+}
+
+
 //# Or two blocks of ranges.
 void TableExprNodeOR::ranges (std::vector<TableExprRange>& blrange)
 {
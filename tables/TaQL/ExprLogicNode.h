@@ -102,6 +102,8 @@ public:
     TableExprNodeEQInt (const TableExprNodeRep&);
     ~TableExprNodeEQInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
+    void ranges (std::vector<TableExprRange>&) override;
 };
 
 
@@ -132,6 +134,7 @@ public:
     TableExprNodeEQDouble (const TableExprNodeRep&);
     ~TableExprNodeEQDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
     void ranges (std::vector<TableExprRange>&) override;
 };
 
@@ -314,6 +317,7 @@ public:
     TableExprNodeNEInt (const TableExprNodeRep&);
     ~TableExprNodeNEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
 };
 
 
@@ -344,6 +348,7 @@ public:
     TableExprNodeNEDouble (const TableExprNodeRep&);
     ~TableExprNodeNEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
 };
 
 
@@ -495,6 +500,8 @@ public:
     TableExprNodeGTInt (const TableExprNodeRep&);
     ~TableExprNodeGTInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
+    void ranges (std::vector<TableExprRange>&) override;
 };
 
 
@@ -525,6 +532,7 @@ public:
     TableExprNodeGTDouble (const TableExprNodeRep&);
     ~TableExprNodeGTDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
     void ranges (std::vector<TableExprRange>&) override;
 };
 
@@ -647,6 +655,8 @@ public:
     TableExprNodeGEInt (const TableExprNodeRep&);
     ~TableExprNodeGEInt() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
+    void ranges (std::vector<TableExprRange>&) override;
 };
 
 
@@ -677,6 +687,7 @@ public:
     TableExprNodeGEDouble (const TableExprNodeRep&);
     ~TableExprNodeGEDouble() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
     void ranges (std::vector<TableExprRange>&) override;
 };
 
@@ -793,6 +804,9 @@ public:
 // compare is always a Bool.
 // The right hand side can be optimized if it contains a constant array which
 // can be replaced by an std::unordered_set<Int64> or a Block<Bool>.
+// If a scalar column is compared with a constant set, the function
+// <src>ranges</src> gives the value ranges of the set, so an index can be
+// used to preselect the rows.
 // </synopsis> 
 
 class TableExprNodeINInt : public TableExprNodeBinary
@@ -804,7 +818,10 @@ public:
     void optimize() override;
     static void doOptimize (TENShPtr& rnode);
     Bool getBool (const TableExprId& id) override;
+    void ranges (std::vector<TableExprRange>&) override;
 private:
+    //# The constant right hand side before being optimized.
+    TENShPtr origRnode_p;
 };
 
 
@@ -829,6 +846,8 @@ private:
 // compare is always a Bool.
 // The right hand side can be optimized if it contains a constant set with
 // bounded intervals.
+// If a scalar column is compared with a constant set, the function
+// <src>ranges</src> gives the value ranges of the set.
 // </synopsis> 
 
 class TableExprNodeINDouble : public TableExprNodeBinary
@@ -839,6 +858,10 @@ public:
     void optimize() override;
     static void doOptimize (TENShPtr& rnode);
     Bool getBool (const TableExprId& id) override;
+    void ranges (std::vector<TableExprRange>&) override;
+private:
+    //# The constant right hand side before being optimized.
+    TENShPtr origRnode_p;
 };
 
 
@@ -964,6 +987,7 @@ public:
     TableExprNodeOR (const TableExprNodeRep&);
     ~TableExprNodeOR() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
     void ranges (std::vector<TableExprRange>&) override;
 };
 
@@ -993,6 +1017,7 @@ public:
     TableExprNodeAND (const TableExprNodeRep&);
     ~TableExprNodeAND() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
     void ranges (std::vector<TableExprRange>&) override;
 };
 
@@ -1022,6 +1047,7 @@ public:
     TableExprNodeNOT (const TableExprNodeRep&);
     ~TableExprNodeNOT() = default;
     Bool getBool (const TableExprId& id) override;
+    void getBoolChunk (rownr_t startRow, size_t nrow, Bool* values) override;
 };
 
 
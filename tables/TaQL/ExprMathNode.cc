@@ -28,6 +28,7 @@
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Quanta/MVTime.h>
 #include <casacore/casa/BasicMath/Math.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -51,6 +52,16 @@ Double TableExprNodePlusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) + rnode_p->getInt(id); }
 DComplex TableExprNodePlusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) + rnode_p->getInt(id)); }
+void TableExprNodePlusInt::getIntChunk (rownr_t startRow, size_t nrow,
+                                        Int64* values)
+{
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, values);
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] += right[i];
+    }
+}
 
 TableExprNodePlusDouble::TableExprNodePlusDouble (const TableExprNodeRep& node)
 : TableExprNodePlus (NTDouble, node)
@@ -61,6 +72,16 @@ Double TableExprNodePlusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
 DComplex TableExprNodePlusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) + rnode_p->getDouble(id); }
+void TableExprNodePlusDouble::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                              Double* values)
+{
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, values);
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] += right[i];
+    }
+}
 
 TableExprNodePlusDComplex::TableExprNodePlusDComplex (const TableExprNodeRep& node)
 : TableExprNodePlus (NTComplex, node)
@@ -123,6 +144,16 @@ Double TableExprNodeMinusInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) - rnode_p->getInt(id); }
 DComplex TableExprNodeMinusInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) - rnode_p->getInt(id)); }
+void TableExprNodeMinusInt::getIntChunk (rownr_t startRow, size_t nrow,
+                                         Int64* values)
+{
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, values);
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] -= right[i];
+    }
+}
 
 TableExprNodeMinusDouble::TableExprNodeMinusDouble (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTDouble, node)
@@ -141,6 +172,16 @@ Double TableExprNodeMinusDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
 DComplex TableExprNodeMinusDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) - rnode_p->getDouble(id); }
+void TableExprNodeMinusDouble::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                               Double* values)
+{
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, values);
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] -= right[i];
+    }
+}
 
 TableExprNodeMinusDComplex::TableExprNodeMinusDComplex (const TableExprNodeRep& node)
 : TableExprNodeMinus (NTComplex, node)
@@ -196,6 +237,16 @@ Double TableExprNodeTimesInt::getDouble (const TableExprId& id)
     { return lnode_p->getInt(id) * rnode_p->getInt(id); }
 DComplex TableExprNodeTimesInt::getDComplex (const TableExprId& id)
     { return double(lnode_p->getInt(id) * rnode_p->getInt(id)); }
+void TableExprNodeTimesInt::getIntChunk (rownr_t startRow, size_t nrow,
+                                         Int64* values)
+{
+    std::vector<Int64> right(nrow);
+    lnode_p->getIntChunk (startRow, nrow, values);
+    rnode_p->getIntChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] *= right[i];
+    }
+}
 
 TableExprNodeTimesDouble::TableExprNodeTimesDouble (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTDouble, node)
@@ -206,6 +257,16 @@ Double TableExprNodeTimesDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
 DComplex TableExprNodeTimesDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) * rnode_p->getDouble(id); }
+void TableExprNodeTimesDouble::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                               Double* values)
+{
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, values);
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] *= right[i];
+    }
+}
 
 TableExprNodeTimesDComplex::TableExprNodeTimesDComplex (const TableExprNodeRep& node)
 : TableExprNodeTimes (NTComplex, node)
@@ -262,6 +323,16 @@ Double TableExprNodeDivideDouble::getDouble (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
 DComplex TableExprNodeDivideDouble::getDComplex (const TableExprId& id)
     { return lnode_p->getDouble(id) / rnode_p->getDouble(id); }
+void TableExprNodeDivideDouble::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                                Double* values)
+{
+    std::vector<Double> right(nrow);
+    lnode_p->getDoubleChunk (startRow, nrow, values);
+    rnode_p->getDoubleChunk (startRow, nrow, right.data());
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] /= right[i];
+    }
+}
 
 TableExprNodeDivideDComplex::TableExprNodeDivideDComplex (const TableExprNodeRep& node)
 : TableExprNodeDivide (NTComplex, node)
@@ -354,6 +425,22 @@ Double TableExprNodeMIN::getDouble (const TableExprId& id)
     { return -(lnode_p->getDouble(id)); }
 DComplex TableExprNodeMIN::getDComplex (const TableExprId& id)
     { return -(lnode_p->getDComplex(id)); }
+void TableExprNodeMIN::getIntChunk (rownr_t startRow, size_t nrow,
+                                    Int64* values)
+{
+    lnode_p->getIntChunk (startRow, nrow, values);
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = -values[i];
+    }
+}
+void TableExprNodeMIN::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                       Double* values)
+{
+    lnode_p->getDoubleChunk (startRow, nrow, values);
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = -values[i];
+    }
+}
 
 
 TableExprNodeBitNegate::TableExprNodeBitNegate (const TableExprNodeRep& node)
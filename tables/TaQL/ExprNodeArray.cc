@@ -1442,6 +1442,34 @@ Bool TableExprNodeArrayPart::getColumnDataType (DataType& dt) const
     return False;
 }
 
+Bool TableExprNodeArrayPart::canGetColumnChunk() const
+{
+    return colNode_p  &&  valueType() == VTScalar  &&
+           inxNode_p->isConstant()  &&
+           colNode_p->getColumn().columnDesc().isFixedShape();
+}
+void TableExprNodeArrayPart::getBoolChunk (rownr_t startRow, size_t nrow,
+                                           Bool* values)
+{
+    if (!canGetColumnChunk()  ||  !getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeArray::getBoolChunk (startRow, nrow, values);
+    }
+}
+void TableExprNodeArrayPart::getIntChunk (rownr_t startRow, size_t nrow,
+                                          Int64* values)
+{
+    if (!canGetColumnChunk()  ||  !getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeArray::getIntChunk (startRow, nrow, values);
+    }
+}
+void TableExprNodeArrayPart::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                             Double* values)
+{
+    if (!canGetColumnChunk()  ||  !getColumnChunk (startRow, nrow, values)) {
+        TableExprNodeArray::getDoubleChunk (startRow, nrow, values);
+    }
+}
+
 Bool TableExprNodeArrayPart::getBool (const TableExprId& id)
 {
     DebugAssert (valueType() == VTScalar, AipsError);
@@ -839,6 +839,17 @@ public:
     String   getString   (const TableExprId& id) override;
     MVTime   getDate     (const TableExprId& id) override;
 
+    // Get a chunk of values of a single element in a fixed shaped column
+    // using a single column read.
+    // <group>
+    void getBoolChunk   (rownr_t startRow, size_t nrow,
+                         Bool* values) override;
+    void getIntChunk    (rownr_t startRow, size_t nrow,
+                         Int64* values) override;
+    void getDoubleChunk (rownr_t startRow, size_t nrow,
+                         Double* values) override;
+    // </group>
+
     MArray<Bool>     getArrayBool     (const TableExprId& id) override;
     MArray<Int64>    getArrayInt      (const TableExprId& id) override;
     MArray<Double>   getArrayDouble   (const TableExprId& id) override;
@@ -872,6 +883,10 @@ public:
     const TableExprNodeArrayColumn* getColumnNode() const;
 
 private:
+    // Can a chunk be read using getColumnChunk?
+    // That is the case for a constant scalar index in a fixed shaped column.
+    Bool canGetColumnChunk() const;
+
     TableExprNodeIndex*       inxNode_p;
     TableExprNodeArray*       arrNode_p;
     TableExprNodeArrayColumn* colNode_p;   //# 0 if arrNode is no arraycolumn
@@ -32,6 +32,8 @@
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Containers/Block.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Utilities/Assert.h>
 #include <casacore/tables/TaQL/MArray.h>
 #include <casacore/tables/TaQL/MArrayLogical.h>
 #include <casacore/casa/iostream.h>
@@ -152,6 +154,131 @@ void TableExprNodeRep::fillExprType (const TableExprNodeRep* node)
 Bool TableExprNodeRep::getColumnDataType (DataType&) const
     { return False; }
 
+void TableExprNodeRep::getBoolChunk (rownr_t startRow, size_t nrow,
+                                     Bool* values)
+{
+    TableExprId id;
+    for (size_t i=0; i<nrow; ++i) {
+        id.setRownr (startRow+i);
+        values[i] = getBool (id);
+    }
+}
+void TableExprNodeRep::getIntChunk (rownr_t startRow, size_t nrow,
+                                    Int64* values)
+{
+    TableExprId id;
+    for (size_t i=0; i<nrow; ++i) {
+        id.setRownr (startRow+i);
+        values[i] = getInt (id);
+    }
+}
+void TableExprNodeRep::getDoubleChunk (rownr_t startRow, size_t nrow,
+                                       Double* values)
+{
+    if (dataType() == NTInt) {
+        std::vector<Int64> ivalues(nrow);
+        getIntChunk (startRow, nrow, ivalues.data());
+        for (size_t i=0; i<nrow; ++i) {
+            values[i] = ivalues[i];
+        }
+    } else {
+        TableExprId id;
+        for (size_t i=0; i<nrow; ++i) {
+            id.setRownr (startRow+i);
+            values[i] = getDouble (id);
+        }
+    }
+}
+
+// Copy the column values to the chunk converting the data type.
+template<typename T, typename R>
+void copyColumnChunk (const Array<T>& arr, size_t nrow, R* values)
+{
+    AlwaysAssert (arr.size() == nrow, AipsError);
+    Bool deleteIt;
+    const T* data = arr.getStorage (deleteIt);
+    for (size_t i=0; i<nrow; ++i) {
+        values[i] = data[i];
+    }
+    arr.freeStorage (data, deleteIt);
+}
+
+Bool TableExprNodeRep::getColumnChunk (rownr_t startRow, size_t nrow,
+                                       Bool* values)
+{
+    DataType dt;
+    if (!getColumnDataType(dt)  ||  dt != TpBool) {
+        return False;
+    }
+    Vector<rownr_t> rownrs(nrow);
+    indgen (rownrs, startRow);
+    copyColumnChunk (getColumnBool(rownrs), nrow, values);
+    return True;
+}
+Bool TableExprNodeRep::getColumnChunk (rownr_t startRow, size_t nrow,
+                                       Int64* values)
+{
+    DataType dt;
+    if (! getColumnDataType(dt)) {
+        return False;
+    }
+    Vector<rownr_t> rownrs(nrow);
+    indgen (rownrs, startRow);
+    switch (dt) {
+    case TpUChar:
+        copyColumnChunk (getColumnuChar(rownrs), nrow, values);
+        break;
+    case TpShort:
+        copyColumnChunk (getColumnShort(rownrs), nrow, values);
+        break;
+    case TpUShort:
+        copyColumnChunk (getColumnuShort(rownrs), nrow, values);
+        break;
+    case TpInt:
+        copyColumnChunk (getColumnInt(rownrs), nrow, values);
+        break;
+    case TpUInt:
+        copyColumnChunk (getColumnuInt(rownrs), nrow, values);
+        break;
+    case TpInt64:
+        copyColumnChunk (getColumnInt64(rownrs), nrow, values);
+        break;
+    default:
+        return False;
+    }
+    return True;
+}
+Bool TableExprNodeRep::getColumnChunk (rownr_t startRow, size_t nrow,
+                                       Double* values)
+{
+    DataType dt;
+    if (! getColumnDataType(dt)) {
+        return False;
+    }
+    Vector<rownr_t> rownrs(nrow);
+    indgen (rownrs, startRow);
+    switch (dt) {
+    case TpFloat:
+        copyColumnChunk (getColumnFloat(rownrs), nrow, values);
+        break;
+    case TpDouble:
+        copyColumnChunk (getColumnDouble(rownrs), nrow, values);
+        break;
+    default:
+        {
+            // Integer columns are converted.
+            std::vector<Int64> ivalues(nrow);
+            if (! getColumnChunk (startRow, nrow, ivalues.data())) {
+                return False;
+            }
+            for (size_t i=0; i<nrow; ++i) {
+                values[i] = ivalues[i];
+            }
+        }
+    }
+    return True;
+}
+
 // Convert the tree to a number of range vectors which at least
 // select the same things.
 // By default a not possible is returned (an empty block).
@@ -319,6 +319,29 @@ public:
     virtual MVTime getDate       (const TableExprId& id);
     // </group>
 
+    // Get the scalar values for this node in a chunk of <src>nrow</src>
+    // consecutive rows starting at <src>startRow</src>. The values are
+    // stored in <src>values</src>, which must have room for
+    // <src>nrow</src> values.
+    // <br>This chunk-at-a-time evaluation avoids the virtual function calls
+    // per row per node done by the scalar get functions above. The nodes
+    // for columns, constants, arithmetic, comparisons and logical operators,
+    // and the common mathematical functions implement them as loops over
+    // contiguous buffers that can be vectorized by the compiler.
+    // The default implementations call the scalar get function for each row,
+    // where an Int node is converted to Double.
+    // Note that in this way subexpressions are evaluated for more rows than
+    // with the scalar get functions (except for the right operand of && and
+    // ||), so the values can be obtained in any order.
+    // <group>
+    virtual void getBoolChunk   (rownr_t startRow, size_t nrow,
+                                 Bool* values);
+    virtual void getIntChunk    (rownr_t startRow, size_t nrow,
+                                 Int64* values);
+    virtual void getDoubleChunk (rownr_t startRow, size_t nrow,
+                                 Double* values);
+    // </group>
+
     // Get an array value for this node in the given row.
     // The appropriate functions are implemented in the derived classes and
     // will usually invoke the get in their children and apply the
@@ -424,6 +447,17 @@ public:
     virtual Array<String>   getColumnString (const Vector<rownr_t>& rownrs);
     // </group>
 
+    // Get the values of a chunk of rows using the getColumnXXX functions
+    // if the node is a scalar column or a constant array column element
+    // (see <src>getColumnDataType</src>). The column values are converted
+    // to the given type; Bool is only possible for a Bool column.
+    // It returns False if not possible.
+    // <group>
+    Bool getColumnChunk (rownr_t startRow, size_t nrow, Bool* values);
+    Bool getColumnChunk (rownr_t startRow, size_t nrow, Int64* values);
+    Bool getColumnChunk (rownr_t startRow, size_t nrow, Double* values);
+    // </group>
+
     // Convert the tree to a number of range vectors which at least
     // select the same things.
     // This function is very useful to convert the expression to
@@ -98,10 +98,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                                        const Array<T>& arr)
     : TableExprNodeSetOptBase (orig)
   {
-    itsMap.clear();
+    itsMap.reserve (arr.size());
     auto iter = arr.begin();
     for (size_t i=0; i<arr.size(); ++i) {
-      itsMap.insert (std::make_pair (*iter, i));
+      itsMap.insert (*iter, i);
       ++iter;
     }
   }
@@ -110,17 +110,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void TableExprNodeSetOptUSet<T>::show (ostream& os, uInt indent) const
   {
     TableExprNodeRep::show (os, indent);
-    os << "Int set as std::unordered_map<T>" << endl;
+    os << "Int set as FlatHashMap<T>" << endl;
   }
   
   template<typename T>
   Int64 TableExprNodeSetOptUSet<T>::find (T value) const
   {
-    auto iter = itsMap.find(value);
-    if (iter == itsMap.end()) {
+    const Int64* index = itsMap.find(value);
+    if (index == 0) {
       return -1;
     }
-    return iter->second;
+    return *index;
   }
 
 
@@ -29,7 +29,7 @@
 //# Includes
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprNodeRep.h>
-#include <unordered_map>
+#include <casacore/casa/Containers/FlatHashMap.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -114,10 +114,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // This templated class is an optimized representation of an constant
   // integer or string array set used by the IN operator.
   // If applicable, TableExprLogicNode instantiates an object of this class.
-  // <br>The representation is a std::unordered_map containing the array values
+  // <br>The representation is a FlatHashMap containing the array values
   // and the index in the array.
-  // <br>Note that a std::unordered_map is used instead of std::map because its
-  // hashing mechanism makes it faster.
+  // <br>Note that a FlatHashMap is used instead of std::map or
+  // std::unordered_map because its open addressing makes it faster.
+  // It matters for the join operator which can do millions of lookups.
   // </synopsis>
 
   template <typename T>
@@ -134,7 +135,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Int64 find (T value) const override;
 
   private:
-    std::unordered_map<T,Int64> itsMap;
+    FlatHashMap<T,Int64> itsMap;
     // Explicitly hide base function to prevent warning
     using TableExprNodeSetOptBase::find;
   };
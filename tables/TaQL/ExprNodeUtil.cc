@@ -25,6 +25,12 @@
 
 //# Includes
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/ExprDerNode.h>
+#include <casacore/tables/TaQL/ExprNodeArray.h>
+#include <casacore/tables/TaQL/ExprUDFNode.h>
+#include <casacore/tables/TaQL/ExprUDFNodeArray.h>
+#include <casacore/tables/TaQL/TaQLJoin.h>
+#include <casacore/tables/TaQL/TableParseJoin.h>
 #include <casacore/tables/Tables/TableError.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -114,6 +120,83 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return nrow;
     }
 
+    static Bool canProbeJoinInParallel (TableExprNodeRep* node)
+    {
+      const TaQLJoinColumn* colNode = dynamic_cast<TaQLJoinColumn*>(node);
+      if (colNode) {
+        return colNode->valueType() == TableExprNodeRep::VTScalar  &&
+               colNode->join().canProbeInParallel();
+      }
+      const TaQLJoinRowid* rowidNode = dynamic_cast<TaQLJoinRowid*>(node);
+      if (rowidNode) {
+        return rowidNode->join().canProbeInParallel();
+      }
+      return False;
+    }
+
+    Bool canEvaluateInParallel (TableExprNodeRep* node)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      for (auto nodeP : allNodes) {
+        if (nodeP->getTableInfo().isJoinTable()) {
+          // Join columns can be used if the join can be probed in parallel.
+          // Only scalar join columns are possible, because they read
+          // all their data when constructed.
+          if (! canProbeJoinInParallel (nodeP)) {
+            return False;
+          }
+          continue;
+        }
+        if (nodeP->isAggregate()
+        ||  nodeP->operType() == TableExprNodeRep::OtRandom
+        ||  dynamic_cast<TableExprUDFNode*>(nodeP)
+        ||  dynamic_cast<TableExprUDFNodeArray*>(nodeP)) {
+          return False;
+        }
+        if (nodeP->operType() == TableExprNodeRep::OtColumn) {
+          // The index node keeps the variable indices in a Slicer.
+          if (dynamic_cast<TableExprNodeIndex*>(nodeP)) {
+            if (! nodeP->isConstant()) {
+              return False;
+            }
+          } else {
+            TableExprNodeColumn* colNode =
+              dynamic_cast<TableExprNodeColumn*>(nodeP);
+            TableExprNodeArrayColumn* arrNode =
+              dynamic_cast<TableExprNodeArrayColumn*>(nodeP);
+            if (colNode) {
+              if (! colNode->getColumn().canReadConcurrently()) {
+                return False;
+              }
+            } else if (arrNode) {
+              if (! arrNode->getColumn().canReadConcurrently()) {
+                return False;
+              }
+            } else {
+              return False;
+            }
+          }
+        }
+      }
+      return True;
+    }
+
+    Bool canEvaluateInChunks (TableExprNodeRep* node)
+    {
+      std::vector<TableExprNodeRep*> allNodes;
+      node->flattenTree (allNodes);
+      for (auto nodeP : allNodes) {
+        if (nodeP->isAggregate()
+        ||  nodeP->getTableInfo().isJoinTable()
+        ||  dynamic_cast<TableExprUDFNode*>(nodeP)
+        ||  dynamic_cast<TableExprUDFNodeArray*>(nodeP)) {
+          return False;
+        }
+      }
+      return True;
+    }
+
     
   }
 
@@ -75,6 +75,21 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the nr of rows in the tables used.
     // An exception is thrown if the tables differ in the nr of rows.
     rownr_t getCheckNRow (const std::vector<Table>&);
+
+    // Can the node and its children be evaluated by multiple threads
+    // at the same time (for different rows)?
+    // That is not possible if the expression contains nodes with a state,
+    // such as user defined, aggregate and random functions, or variable
+    // array indices. Furthermore, all columns used must be readable
+    // concurrently. Columns in a join table can only be used if they are
+    // scalar and if the join can be probed in parallel.
+    Bool canEvaluateInParallel (TableExprNodeRep* node);
+
+    // Can the node and its children be evaluated a chunk of rows at a time
+    // (using the getXXXChunk functions)?
+    // That is not possible if the expression contains user defined or
+    // aggregate functions, or columns in a join table.
+    Bool canEvaluateInChunks (TableExprNodeRep* node);
 }
   
 
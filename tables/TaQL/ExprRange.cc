@@ -28,6 +28,7 @@
 #include <casacore/casa/Arrays/Slice.h>
 #include <casacore/casa/BasicMath/Math.h>
 #include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/Utilities/Assert.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -46,6 +47,17 @@ TableExprRange::TableExprRange(const TableColumn& col, double stval,
     eval_p(0) = endval;
 }
 
+TableExprRange::TableExprRange (const TableColumn& col,
+                                const Vector<double>& stval,
+                                const Vector<double>& endval)
+: sval_p     (stval.copy()),
+  eval_p     (endval.copy()),
+  tabColPtr_p(0)
+{
+    AlwaysAssert (stval.size() == endval.size(), AipsError);
+    tabColPtr_p = new TableColumn(col);
+}
+
 TableExprRange::TableExprRange (const TableExprRange& that)
 : sval_p     (that.sval_p),
   eval_p     (that.eval_p),
@@ -137,6 +149,12 @@ void TableExprRange::mixOr (const TableExprRange& that)
         nrres++;
         j++;
     }
+    //# Nothing to do if both have no intervals.
+    if (nrres == 0) {
+        sval_p.resize(0);
+        eval_p.resize(0);
+        return;
+    }
     //# Now combine overlapping intervals and store result in temporary.
     Vector<double> stmp(nrres);
     Vector<double> etmp(nrres);
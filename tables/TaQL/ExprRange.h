@@ -62,6 +62,9 @@ class TableColumn;
 // Only double values are taken into account.
 // It can handle operators &&, ||, ==, >, >=, <, <=, !.
 // It can handle a comparison operator only for a column with a constant.
+// It can also handle IN (thus also BETWEEN) of a column with a constant set.
+// Note that the ranges are a superset of the values to be selected;
+// for instance, the range for <src>col > 3</src> includes 3.
 // Other operators and expressions are non-convertable.
 //
 // The ranges function in class TableExprNode returns a Block
@@ -91,6 +94,11 @@ public:
     // Construct from a column and a single constant range.
     TableExprRange (const TableColumn&, double stval, double endval);
 
+    // Construct from a column and the start and end values of its ranges.
+    // The ranges must be in ascending order and must not overlap.
+    TableExprRange (const TableColumn&, const Vector<double>& stval,
+                    const Vector<double>& endval);
+
     // Copy constructor.
     TableExprRange (const TableExprRange&);
 
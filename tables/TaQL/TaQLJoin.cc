@@ -104,19 +104,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       std::vector<T> vals;
       T val = vec[index[0]];
       std::vector<rownr_t> srows;
-      srows.push_back (index[0]);
+      srows.push_back (rows[index[0]]);
       for (size_t j=1; j<rows.size(); ++j) {
-        Int64 row = index[j];
-        T val2 = vec[row];
+        T val2 = vec[index[j]];
         if (val2 == val) {
-          srows.push_back (row);
+          srows.push_back (rows[index[j]]);
         } else {
           vals.push_back (val);
           children.push_back (TaQLJoin::createRecursive
                               (mainNodes, joinNodes, srows, level+1));
           val = val2;
           srows.resize(0);
-          srows.push_back (index[j]);
+          srows.push_back (rows[index[j]]);
         }
       }
       vals.push_back (val);
@@ -169,11 +168,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       T st = stvals[index[0]];
       T end = endvals[index[0]];
       std::vector<rownr_t> srows;
-      srows.push_back (index[0]);
+      srows.push_back (rows[index[0]]);
       for (size_t j=1; j<rows.size(); ++j) {
         Int64 row = rows[index[j]];
-        T st2 = stvals[row];
-        T end2 = endvals[row];
+        T st2 = stvals[index[j]];
+        T end2 = endvals[index[j]];
         if (st2 == st  &&  end2 == end) {
           srows.push_back (row);
         } else {
@@ -184,7 +183,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           st = st2;
           end = end2;
           srows.resize(0);
-          srows.push_back (index[j]);
+          srows.push_back (row);
         }
       }
       starts.push_back (st);
@@ -260,6 +259,142 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 
   
+  std::shared_ptr<TaQLJoinBase> TaQLJoin::createHash
+  (const std::vector<TableExprNode>& eqMainNodes,
+   const std::vector<TableExprNode>& eqJoinNodes,
+   const std::vector<TableExprNode>& inMainNodes,
+   const std::vector<TableExprNode>& inJoinNodes,
+   const std::vector<rownr_t>& rows)
+  {
+    // Check the data types; only Int and String can be used in a hash map.
+    size_t nint = 0;
+    for (size_t i=0; i<eqJoinNodes.size(); ++i) {
+      const TENShPtr& node = eqJoinNodes[i].getRep();
+      const TENShPtr& mainNode = eqMainNodes[i].getRep();
+      AlwaysAssert (node->valueType() == TableExprNodeRep::VTScalar, AipsError);
+      if (node->dataType() == TableExprNodeRep::NTInt  &&
+          mainNode->dataType() == TableExprNodeRep::NTInt) {
+        nint++;
+      } else if (node->dataType() != TableExprNodeRep::NTString  ||
+                 mainNode->dataType() != TableExprNodeRep::NTString) {
+        throw TableInvExpr ("In a equality join condition only Int and String "
+                            "data types are possible");
+      }
+    }
+    // A single part can use its value as the key.
+    if (eqJoinNodes.size() == 1) {
+      if (nint == 1) {
+        return std::shared_ptr<TaQLJoinBase>
+          (new TaQLHashJoin<Int64> (eqMainNodes, eqJoinNodes,
+                                    inMainNodes, inJoinNodes, rows));
+      }
+      return std::shared_ptr<TaQLJoinBase>
+        (new TaQLHashJoin<String> (eqMainNodes, eqJoinNodes,
+                                   inMainNodes, inJoinNodes, rows));
+    }
+    return std::shared_ptr<TaQLJoinBase>
+      (new TaQLHashJoin<TaQLJoinKey,TaQLJoinKeyHash>
+       (eqMainNodes, eqJoinNodes, inMainNodes, inJoinNodes, rows));
+  }
+
+
+  size_t TaQLJoinKeyHash::operator() (const TaQLJoinKey& key) const
+  {
+    // Combine the hashes of the values (as boost::hash_combine does).
+    size_t hash = 0;
+    for (Int64 value : key.itsInts) {
+      hash ^= std::hash<Int64>()(value) + 0x9e3779b97f4a7c15ULL +
+              (hash<<6) + (hash>>2);
+    }
+    for (const String& value : key.itsStrings) {
+      hash ^= std::hash<String>()(value) + 0x9e3779b97f4a7c15ULL +
+              (hash<<6) + (hash>>2);
+    }
+    return hash;
+  }
+
+  // Fill the key from the values of the nodes for the given row.
+  static void fillJoinKey (const std::vector<TENShPtr>& nodes,
+                           const TableExprId& id, Int64& key)
+  {
+    key = nodes[0]->getInt (id);
+  }
+  static void fillJoinKey (const std::vector<TENShPtr>& nodes,
+                           const TableExprId& id, String& key)
+  {
+    key = nodes[0]->getString (id);
+  }
+  static void fillJoinKey (const std::vector<TENShPtr>& nodes,
+                           const TableExprId& id, TaQLJoinKey& key)
+  {
+    key.itsInts.clear();
+    key.itsStrings.clear();
+    for (const TENShPtr& node : nodes) {
+      if (node->dataType() == TableExprNodeRep::NTInt) {
+        key.itsInts.push_back (node->getInt (id));
+      } else {
+        key.itsStrings.push_back (node->getString (id));
+      }
+    }
+  }
+
+  template<typename K, typename Hash>
+  TaQLHashJoin<K,Hash>::TaQLHashJoin
+  (const std::vector<TableExprNode>& eqMainNodes,
+   const std::vector<TableExprNode>& eqJoinNodes,
+   const std::vector<TableExprNode>& inMainNodes,
+   const std::vector<TableExprNode>& inJoinNodes,
+   const std::vector<rownr_t>& rows)
+    : itsMap (rows.size())
+  {
+    std::vector<TENShPtr> joinNodes;
+    for (size_t i=0; i<eqJoinNodes.size(); ++i) {
+      itsMainNodes.push_back (eqMainNodes[i].getRep());
+      joinNodes.push_back (eqJoinNodes[i].getRep());
+    }
+    // Build the hash map in a single pass over the join table rows.
+    // Without IN parts the map contains the first row having the key
+    // (as TaQLJoin does). Otherwise it contains the index of the group of
+    // rows having the key.
+    std::vector<std::vector<rownr_t>> groups;
+    K key;
+    for (rownr_t row : rows) {
+      fillJoinKey (joinNodes, TableExprId(row), key);
+      if (inJoinNodes.empty()) {
+        itsMap.insert (key, row);
+      } else {
+        std::pair<Int64*,Bool> res = itsMap.insert (key, groups.size());
+        if (res.second) {
+          groups.push_back (std::vector<rownr_t>());
+        }
+        groups[*res.first].push_back (row);
+      }
+    }
+    // Make a TaQLJoin tree for the IN parts of each group.
+    itsChildren.reserve (groups.size());
+    for (const std::vector<rownr_t>& grows : groups) {
+      itsChildren.push_back (TaQLJoin::createRecursive (inMainNodes, inJoinNodes,
+                                                        grows, 0));
+    }
+  }
+
+  template<typename K, typename Hash>
+  Int64 TaQLHashJoin<K,Hash>::findRow (const TableExprId& id)
+  {
+    K key;
+    fillJoinKey (itsMainNodes, id, key);
+    const Int64* value = itsMap.find (key);
+    if (value == 0) {
+      return -1;
+    }
+    if (itsChildren.empty()) {
+      return *value;
+    }
+    return itsChildren[*value]->findRow (id);
+  }
+
+
+
   TaQLJoinColumn::TaQLJoinColumn (const TENShPtr& columnNode,
                                   const TableParseJoin& join)
     : TableExprNodeRep (*columnNode),
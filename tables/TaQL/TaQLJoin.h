@@ -29,6 +29,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprDerNode.h>
 #include <casacore/tables/TaQL/ExprNodeSetOpt.h>
+#include <casacore/casa/Containers/FlatHashMap.h>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -190,6 +191,18 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
      const std::vector<rownr_t>& rows,
      size_t level);
 
+    // Create a TaQLHashJoin object for the equality parts of a join
+    // condition. If IN parts are given, a tree of TaQLJoin objects is
+    // created for them (using createRecursive) per unique equality key.
+    // The key type of the hash map depends on the number and data types
+    // of the equality parts.
+    static std::shared_ptr<TaQLJoinBase> createHash
+    (const std::vector<TableExprNode>& eqMainNodes,
+     const std::vector<TableExprNode>& eqJoinNodes,
+     const std::vector<TableExprNode>& inMainNodes,
+     const std::vector<TableExprNode>& inJoinNodes,
+     const std::vector<rownr_t>& rows);
+
   private:
     TENShPtr itsMainNode;
     TENShPtr itsJoinNode;                  // only used for automatic deletion
@@ -198,6 +211,78 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   };
 
 
+  // <summary>
+  // Key consisting of multiple values of an equality join condition
+  // </summary>
+  // <use visibility=local>
+  // <synopsis>
+  // TaQLJoinKey holds the integer and string values of all equality
+  // parts of a join condition, so they can be looked up in a single hash
+  // map. TaQLJoinKeyHash is the hash functor for it.
+  // </synopsis>
+
+  struct TaQLJoinKey
+  {
+    std::vector<Int64>  itsInts;
+    std::vector<String> itsStrings;
+
+    Bool operator== (const TaQLJoinKey& that) const
+      { return itsInts == that.itsInts  &&  itsStrings == that.itsStrings; }
+  };
+
+  struct TaQLJoinKeyHash
+  {
+    size_t operator() (const TaQLJoinKey& key) const;
+  };
+
+
+  // <summary>
+  // Class handling the equality parts of a join condition using a hash map
+  // </summary>
+  // <use visibility=local>
+  // <reviewed reviewer="" date="" tests="tTableGramJoin">
+  // </reviewed>
+  // <synopsis>
+  // TaQLHashJoin is the join operator used if a join condition contains
+  // equality (==) parts. Instead of a level per part as in TaQLJoin,
+  // it combines the values of all equality parts into a single key, which
+  // is looked up in a FlatHashMap. The hash map is built from the join table
+  // in a single pass without sorting. Like TaQLJoin it maps a key to the
+  // first join table row having that key.
+  // <br>If the join condition also contains IN parts, the hash map gives
+  // the index of a TaQLJoin tree handling the IN parts for the join table
+  // rows having that key.
+  // <br>Finding a row (probing) does not change the object, so the rows
+  // of the main table can be probed in parallel as long as the main table
+  // expressions can be evaluated in parallel.
+  // </synopsis>
+  // <templating arg=K>
+  //  <li> Int64 or String for a single equality part, otherwise TaQLJoinKey.
+  // </templating>
+
+  template<typename K, typename Hash=std::hash<K>>
+  class TaQLHashJoin : public TaQLJoinBase
+  {
+  public:
+    // Build the hash map from the given rows of the join table.
+    TaQLHashJoin (const std::vector<TableExprNode>& eqMainNodes,
+                  const std::vector<TableExprNode>& eqJoinNodes,
+                  const std::vector<TableExprNode>& inMainNodes,
+                  const std::vector<TableExprNode>& inJoinNodes,
+                  const std::vector<rownr_t>& rows);
+
+    ~TaQLHashJoin() override = default;
+
+    // Find the row number in the join table for the given row in the main table.
+    Int64 findRow (const TableExprId&) override;
+
+  private:
+    std::vector<TENShPtr> itsMainNodes;
+    FlatHashMap<K,Int64,Hash> itsMap;  // join row or index in itsChildren
+    std::vector<std::shared_ptr<TaQLJoinBase>> itsChildren;
+  };
+
+
   // <summary>
   // A column in a join table
   // </summary>
@@ -221,6 +306,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the table info for this column.
     TableExprInfo getTableInfo() const override;
 
+    // Get the join object used to map the row numbers.
+    const TableParseJoin& join() const
+      { return itsJoin; }
+
     // Get the data for the given id.
     // Using the Join object it maps the row number in the main table
     // to the row number in the join table.
@@ -344,6 +433,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     TaQLJoinRowid (const TableExprInfo&, const TableParseJoin&);
     ~TaQLJoinRowid() override = default;
     TableExprInfo getTableInfo() const override;
+    // Get the join object used to map the row numbers.
+    const TableParseJoin& join() const
+      { return itsJoin; }
     // Get the data (rowid in join table) for the given id.
     // Using the Join object it maps the row number in the main table
     // to the row number in the join table.
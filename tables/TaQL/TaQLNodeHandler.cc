@@ -569,6 +569,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Add an entry to the stack.
     Bool outer = itsStack.empty();
     TableParseQuery* curSel = pushStack (TableParseQuery::PSELECT);
+    if (outer  &&  node.style().doProfiling()) {
+      curSel->startProfile();
+    }
     // First handle LIMIT/OFFSET, because limit is needed when creating
     // a temp table for a select without a FROM.
     // In its turn limit/offset might use WITH tables, so do them very first.
@@ -618,6 +621,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLNodeResult TaQLNodeHandler::visitUpdateNode (const TaQLUpdateNodeRep& node)
   {
     TableParseQuery* curSel = pushStack (TableParseQuery::PUPDATE);
+    if (node.style().doProfiling()) {
+      curSel->startProfile();
+    }
     // First handle LIMIT/OFFSET, because limit is needed when creating
     // a temp table for a select without a FROM.
     // In its turn limit/offset might use WITH tables, so do them very first.
@@ -642,6 +648,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLNodeResult TaQLNodeHandler::visitInsertNode (const TaQLInsertNodeRep& node)
   {
     TableParseQuery* curSel = pushStack (TableParseQuery::PINSERT);
+    if (node.style().doProfiling()) {
+      curSel->startProfile();
+    }
     handleTables  (node.itsWith, False);
     handleTables  (node.itsTables);
     handleInsCol  (node.itsColumns);
@@ -678,6 +687,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   TaQLNodeResult TaQLNodeHandler::visitDeleteNode (const TaQLDeleteNodeRep& node)
   {
     TableParseQuery* curSel = pushStack (TableParseQuery::PDELETE);
+    if (node.style().doProfiling()) {
+      curSel->startProfile();
+    }
     handleTables  (node.itsWith, False);
     handleTables  (node.itsTables);
     handleWhere   (node.itsWhere);
@@ -696,6 +708,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   {
     Bool outer = itsStack.empty();
     TableParseQuery* curSel = pushStack (TableParseQuery::PCOUNT);
+    if (outer  &&  node.style().doProfiling()) {
+      curSel->startProfile();
+    }
     handleTables  (node.itsWith, False);
     handleTables  (node.itsTables);
     visitNode     (node.itsColumns);
@@ -31,11 +31,12 @@
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
 TaQLStyle::TaQLStyle (uInt origin)
-  : itsOrigin    (origin),
-    itsEndExcl   (False),
-    itsCOrder    (False),
-    itsDoTiming  (False),
-    itsDoTracing (False)
+  : itsOrigin      (origin),
+    itsEndExcl     (False),
+    itsCOrder      (False),
+    itsDoTiming    (False),
+    itsDoTracing   (False),
+    itsDoProfiling (False)
 {
   // Define mscal as a synonym for derivedmscal.
   defineSynonym ("mscal", "derivedmscal");
@@ -73,6 +74,10 @@ void TaQLStyle::set (const String& value)
     itsDoTracing = True;
   } else if (val == "NOTRACE") {
     itsDoTracing = False;
+  } else if (val == "PROFILE") {
+    itsDoProfiling = True;
+  } else if (val == "NOPROFILE") {
+    itsDoProfiling = False;
   } else {
     throw TableError(value + " is an invalid TaQL STYLE value");
   }
@@ -81,8 +86,9 @@ void TaQLStyle::set (const String& value)
 void TaQLStyle::reset()
 {
   set ("GLISH");
-  itsDoTiming  = False;
-  itsDoTracing = False;
+  itsDoTiming    = False;
+  itsDoTracing   = False;
+  itsDoProfiling = False;
 }
 
 void TaQLStyle::defineSynonym (const String& synonym, const String& udfLibName)
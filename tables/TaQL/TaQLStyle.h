@@ -70,7 +70,8 @@ public:
 
   // Set the style according to the (case-insensitive) value.
   // Possible values are Glish, Python, Base0, Base1, FortranOrder, Corder,
-  // InclEnd, and ExclEnd.
+  // InclEnd, and ExclEnd. Furthermore Time, Trace, and Profile (and their
+  // negations NoTime, NoTrace, and NoProfile) can be given.
   void set (const String& value);
 
   // Define a UDF library name synonym.
@@ -113,12 +114,23 @@ public:
   Bool doTracing() const
     { return itsDoTracing; }
 
+  // Set if profiling needs to be done.
+  void setProfiling (Bool doProfiling)
+    { itsDoProfiling = doProfiling; }
+
+  // Should profiling be done?
+  // If so, the query is executed and for each step its time, number of
+  // rows and IO statistics are shown (see class TableParseProfile).
+  Bool doProfiling() const
+    { return itsDoProfiling; }
+
 private:
   uInt itsOrigin;
   Bool itsEndExcl;
   Bool itsCOrder;
   Bool itsDoTiming;
   Bool itsDoTracing;
+  Bool itsDoProfiling;
   std::map<String,String> itsUDFLibNameMap;
 };
 
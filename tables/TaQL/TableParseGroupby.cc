@@ -29,7 +29,12 @@
 #include <casacore/tables/TaQL/ExprNodeSet.h>
 #include <casacore/tables/TaQL/TableExprIdAggr.h>
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/tables/TaQL/ExprAggrNode.h>
+#include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/OS/OMP.h>
+#include <exception>
+#include <type_traits>
 
 using namespace std;
 
@@ -195,15 +200,35 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       immediateNodes.push_back (&expridNode);
     }
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> funcSets;
+    uInt nthreads = nthreadsGroupAggr (immediateNodes, rownrs.size());
     // Use a faster way for a single groupby key.
     if (itsGroupbyNodes.size() == 1  &&
         itsGroupbyNodes[0].dataType() == TpDouble) {
-      funcSets = singleKey<Double> (immediateNodes, rownrs);
+      if (nthreads > 1) {
+        funcSets = groupInParallel<Double> (immediateNodes, rownrs, nthreads);
+      } else {
+        std::vector<Double> keys;
+        funcSets = singleKey (immediateNodes, rownrs, 0, rownrs.size(),
+                              keys, 0);
+      }
     } else if (itsGroupbyNodes.size() == 1  &&
                itsGroupbyNodes[0].dataType() == TpInt) {
-      funcSets = singleKey<Int64> (immediateNodes, rownrs);
+      if (nthreads > 1) {
+        funcSets = groupInParallel<Int64> (immediateNodes, rownrs, nthreads);
+      } else {
+        std::vector<Int64> keys;
+        funcSets = singleKey (immediateNodes, rownrs, 0, rownrs.size(),
+                              keys, 0);
+      }
     } else {
-      funcSets = multiKey (immediateNodes, rownrs);
+      if (nthreads > 1) {
+        funcSets = groupInParallel<TableExprGroupKeySet> (immediateNodes,
+                                                          rownrs, nthreads);
+      } else {
+        std::vector<TableExprGroupKeySet> keys;
+        funcSets = multiKey (immediateNodes, rownrs, 0, rownrs.size(),
+                             keys, 0);
+      }
     }
     // Let the function nodes finish their operation.
     // Form the rownr vector from the rows kept in the aggregate objects.
@@ -252,7 +277,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
   std::vector<std::shared_ptr<TableExprGroupFuncSet>> TableParseGroupby::multiKey
-  (const std::vector<TableExprNodeRep*>& nodes, const Vector<rownr_t>& rownrs) const
+  (const std::vector<TableExprNodeRep*>& nodes, const Vector<rownr_t>& rownrs,
+   rownr_t st, rownr_t end, std::vector<TableExprGroupKeySet>& keys,
+   std::mutex* mutex) const
   {
     // Group the data according to the (maybe empty) groupby.
     // Step through the table in the normal order which may not be the
@@ -266,14 +293,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Loop through all rows.
     // For each row generate the key to get the right entry.
     TableExprId rowid(0);
-    for (rownr_t i=0; i<rownrs.size(); ++i) {
+    for (rownr_t i=st; i<end; ++i) {
       rowid.setRownr (rownrs[i]);
       keySet.fill (itsGroupbyNodes, rowid);
       Int groupnr = funcSets.size();
       std::map<TableExprGroupKeySet, Int>::iterator iter=keyFuncMap.find (keySet);
       if (iter == keyFuncMap.end()) {
         keyFuncMap[keySet] = groupnr;
-        funcSets.push_back (std::make_shared<TableExprGroupFuncSet>(nodes));
+        keys.push_back (keySet);
+        funcSets.push_back (makeFuncSet (nodes, mutex));
       } else {
         groupnr = iter->second;
       }
@@ -282,5 +310,106 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     return funcSets;
   }
 
+  std::shared_ptr<TableExprGroupFuncSet> TableParseGroupby::makeFuncSet
+  (const std::vector<TableExprNodeRep*>& nodes, std::mutex* mutex)
+  {
+    // The aggregate nodes keep the last function object made,
+    // so they cannot be made by multiple threads at the same time.
+    if (mutex) {
+      std::lock_guard<std::mutex> lock(*mutex);
+      return std::make_shared<TableExprGroupFuncSet>(nodes);
+    }
+    return std::make_shared<TableExprGroupFuncSet>(nodes);
+  }
+
+  uInt TableParseGroupby::nthreadsGroupAggr
+  (const std::vector<TableExprNodeRep*>& nodes, rownr_t nrow) const
+  {
+    // Each thread should handle a reasonable number of rows.
+    const rownr_t minRowsPerThread = 16384;
+    uInt nthreads = Table::getSelectNThreads();
+    if (nthreads == 0) {
+      nthreads = OMP::maxThreads();
+    }
+    nthreads = std::min (rownr_t(nthreads), nrow / minRowsPerThread);
+    if (nthreads <= 1) {
+      return 1;
+    }
+    // All aggregation results must be mergeable.
+    TableExprGroupFuncSet funcSet(nodes);
+    if (! funcSet.canMerge()) {
+      return 1;
+    }
+    // The groupby keys and the operands must be evaluated in parallel.
+    for (const TableExprNode& node : itsGroupbyNodes) {
+      if (! TableExprNodeUtil::canEvaluateInParallel (node.getRep().get())) {
+        return 1;
+      }
+    }
+    for (TableExprNodeRep* node : nodes) {
+      TableExprAggrNode* aggrNode = dynamic_cast<TableExprAggrNode*>(node);
+      if (! aggrNode) {
+        return 1;
+      }
+      for (const TENShPtr& operand : aggrNode->operands()) {
+        if (! TableExprNodeUtil::canEvaluateInParallel (operand.get())) {
+          return 1;
+        }
+      }
+    }
+    return nthreads;
+  }
+
+  template<typename K>
+  std::vector<std::shared_ptr<TableExprGroupFuncSet>>
+  TableParseGroupby::groupInParallel
+  (const std::vector<TableExprNodeRep*>& nodes, const Vector<rownr_t>& rownrs,
+   uInt nthreads) const
+  {
+    std::vector<std::vector<std::shared_ptr<TableExprGroupFuncSet>>>
+      parts(nthreads);
+    std::vector<std::vector<K>> keys(nthreads);
+    std::mutex mutex;
+    std::exception_ptr error;
+    rownr_t nrow = rownrs.size();
+#pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+    for (Int i=0; i<Int(nthreads); ++i) {
+      try {
+        rownr_t st  = nrow * i / nthreads;
+        rownr_t end = nrow * (i+1) / nthreads;
+        if constexpr (std::is_same<K, TableExprGroupKeySet>::value) {
+          parts[i] = multiKey (nodes, rownrs, st, end, keys[i], &mutex);
+        } else {
+          parts[i] = singleKey (nodes, rownrs, st, end, keys[i], &mutex);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (! error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception (error);
+    }
+    // Merge the groups of the parts in order, so the groups are ordered
+    // as in a serial grouping.
+    std::vector<std::shared_ptr<TableExprGroupFuncSet>> funcSets;
+    std::map<K, size_t> keyFuncMap;
+    for (uInt i=0; i<nthreads; ++i) {
+      for (size_t j=0; j<parts[i].size(); ++j) {
+        typename std::map<K, size_t>::iterator iter =
+          keyFuncMap.find (keys[i][j]);
+        if (iter == keyFuncMap.end()) {
+          keyFuncMap.insert (std::make_pair (keys[i][j], funcSets.size()));
+          funcSets.push_back (parts[i][j]);
+        } else {
+          funcSets[iter->second]->merge (*parts[i][j]);
+        }
+      }
+    }
+    return funcSets;
+  }
+
 
 } //# NAMESPACE CASACORE - END
@@ -30,6 +30,8 @@
 #include <casacore/casa/aips.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
+#include <map>
+#include <mutex>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -121,9 +123,15 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // first row of each group.
     std::shared_ptr<TableExprGroupResult> countAll (Vector<rownr_t>& rownrs) const;
 
-    // Create the set of aggregate functions and groupby keys.
+    // Create the set of aggregate functions and groupby keys for the
+    // rows <src>rownrs[st:end]</src>.
+    // The keys of the groups are stored in <src>keys</src>.
+    // If given, the mutex is used to create the function objects
+    // when grouping in parallel.
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> multiKey
-    (const std::vector<TableExprNodeRep*>&, const Vector<rownr_t>& rownrs) const;
+    (const std::vector<TableExprNodeRep*>&, const Vector<rownr_t>& rownrs,
+     rownr_t st, rownr_t end, std::vector<TableExprGroupKeySet>& keys,
+     std::mutex* mutex) const;
 
     // Create the set of aggregate functions and groupby keys in case
     // a single groupby key is given.
@@ -131,7 +139,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     template<typename T>
     std::vector<std::shared_ptr<TableExprGroupFuncSet>> singleKey
     (const std::vector<TableExprNodeRep*>& nodes,
-     const Vector<rownr_t>& rownrs) const
+     const Vector<rownr_t>& rownrs, rownr_t st, rownr_t end,
+     std::vector<T>& keys, std::mutex* mutex) const
     {
       // We have to group the data according to the (possibly empty) groupby.
       // We step through the table in the normal order which may not be the
@@ -146,7 +155,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // For each row generate the key to get the right entry.
       TableExprId rowid(0);
       T key;
-      for (rownr_t i=0; i<rownrs.size(); ++i) {
+      for (rownr_t i=st; i<end; ++i) {
         rowid.setRownr (rownrs[i]);
         itsGroupbyNodes[0].get (rowid, key);
         if (key != lastKey) {
@@ -154,8 +163,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
           if (iter == keyFuncMap.end()) {
             groupnr = funcSets.size();
             keyFuncMap[key] = groupnr;
-            funcSets.push_back (std::shared_ptr<TableExprGroupFuncSet>
-                                (new TableExprGroupFuncSet (nodes)));
+            keys.push_back (key);
+            funcSets.push_back (makeFuncSet (nodes, mutex));
           } else {
             groupnr = iter->second;
           }
@@ -166,6 +175,26 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       return funcSets;
     }
 
+    // Create the function set for a new group.
+    static std::shared_ptr<TableExprGroupFuncSet> makeFuncSet
+    (const std::vector<TableExprNodeRep*>& nodes, std::mutex* mutex);
+
+    // Get the number of threads to use for the grouping and aggregation.
+    // It is 1 if the number of rows is small, if the aggregation results
+    // cannot be merged, or if the expressions cannot be evaluated
+    // in parallel.
+    uInt nthreadsGroupAggr (const std::vector<TableExprNodeRep*>& nodes,
+                            rownr_t nrow) const;
+
+    // Group and aggregate the rows in parallel. Each thread handles a
+    // contiguous part of the rows. Thereafter the groups of the parts
+    // are merged in order, so the result is the same as the result of
+    // a serial grouping (except for round-off errors).
+    template<typename K>
+    std::vector<std::shared_ptr<TableExprGroupFuncSet>> groupInParallel
+    (const std::vector<TableExprNodeRep*>& nodes,
+     const Vector<rownr_t>& rownrs, uInt nthreads) const;
+
     // Get pointers to the aggregate nodes in the node expression.
     void getAggrNodes (const TableExprNode& node,
                        std::vector<TableExprNodeRep*>& aggrNodes) const;
@@ -29,15 +29,17 @@
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprNodeUtil.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <atomic>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   TableParseJoin::TableParseJoin (TableParseQuery* parent)
     : itsParent          (parent),
       itsParentJoinIndex (-1),
-      itsLastMainRow     (-1),
-      itsLastJoinRow     (0)
+      itsParallelProbe   (False)
   {
+    static std::atomic<Int64> nextId (0);
+    itsId = nextId++;
     // Get the FROM tables which are all FROM tables before this JOIN clause.
     for (const auto& tabp : itsParent->tableList().fromTables()) {
       itsFromTables.push_back (tabp.table());
@@ -52,11 +54,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (! itsJoin) {
       return id.rownr();
     }
-    if (id.rownr() != itsLastMainRow) {
-      itsLastMainRow = id.rownr();
-      itsLastJoinRow = itsJoin->findRow(id);
+    // Usually multiple join columns are used for the same main row, so keep
+    // the last row found. It is kept per thread, so rows can be found
+    // in parallel. A few slots are used, because finding the row in a nested
+    // join also finds the row in its parent join.
+    struct LastRow {
+      Int64 joinId  = -1;
+      Int64 mainRow = -1;
+      Int64 joinRow = 0;
+    };
+    thread_local LastRow lastRows[8];
+    LastRow& last = lastRows[itsId % 8];
+    if (last.joinId != itsId  ||  last.mainRow != id.rownr()) {
+      Int64 joinRow = itsJoin->findRow(id);
+      last.joinId  = itsId;
+      last.mainRow = id.rownr();
+      last.joinRow = joinRow;
     }
-    return itsLastJoinRow;
+    return last.joinRow;
   }
 
   void TableParseJoin::addTable (Int tabnr, const String& name,
@@ -184,9 +199,6 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
         break;
       }
     }
-    // Append the IN parts to the EQ parts, so the faster EQ lookups are done first.
-    eqParts.insert (eqParts.end(), inParts.begin(), inParts.end());
-    eqMainParts.insert (eqMainParts.end(), inMainParts.begin(), inMainParts.end());
     // Everything seems to be fine.
     // Now read the join data for each part.
     // Joins can only be done on Int, Double, String and DateTime (handled as Double).
@@ -194,7 +206,24 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     for (size_t i=0; i<nrow; ++i) {
       rows[i] = i;
     }
-    itsJoin = TaQLJoin::createRecursive(eqMainParts, eqParts, rows, 0);
+    // The EQ parts are handled by a single hash lookup, which is done first.
+    // The IN parts (interval lookups) are handled in a tree below it.
+    if (eqParts.empty()) {
+      itsJoin = TaQLJoin::createRecursive(inMainParts, inParts, rows, 0);
+    } else {
+      itsJoin = TaQLJoin::createHash(eqMainParts, eqParts,
+                                     inMainParts, inParts, rows);
+    }
+    eqParts.insert (eqParts.end(), inParts.begin(), inParts.end());
+    eqMainParts.insert (eqMainParts.end(), inMainParts.begin(), inMainParts.end());
+    // The join can be probed in parallel if all main parts can be evaluated
+    // in parallel.
+    itsParallelProbe = True;
+    for (const auto& tnode : eqMainParts) {
+      if (! TableExprNodeUtil::canEvaluateInParallel (tnode.getRep().get())) {
+        itsParallelProbe = False;
+      }
+    }
     // Clear the cache in the TaQLJoinColumn nodes of the join conditions.
     for (const auto& tnode : eqParts) {
       std::vector<TableExprNodeRep*> nodes;
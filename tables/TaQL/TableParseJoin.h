@@ -65,6 +65,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   // A tree, consisting of TaQLJoinBase objects, is built to execute the condition.
   // It finds the matching row in the join table given a row in the main table.
   // Each level in the tree is an AND part in the condition.
+  // <br>If the condition contains = parts, they are handled together by a
+  // TaQLHashJoin object at the top of the tree. It looks up the combined
+  // values of the = parts in a hash map built from the join table.
+  // The IN parts form the levels below it.
+  // <br>Finding the join row does not change the tree, so it can be done
+  // in parallel if the main table expressions in the condition can be
+  // evaluated in parallel (see <src>canProbeInParallel</src>).
   // </synopsis> 
 
   class TableParseJoin
@@ -87,6 +94,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //# is not set. In that case the given row id is already the original
     //# rownr in the join table and should be returned as such. 
     Int64 findRow (const TableExprId& id) const;
+
+    // Can findRow be used by multiple threads at the same time?
+    // It is possible if the main table expressions in the join condition
+    // can be evaluated in parallel.
+    Bool canProbeInParallel() const
+      { return itsParallelProbe; }
     
   private:
     // Split the ON condition recursively into its AND parts.
@@ -115,8 +128,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     //# Index in TableParseQuery's vector of joins; <0 is no parent join.
     Int                itsParentJoinIndex;
     std::shared_ptr<TaQLJoinBase> itsJoin;
-    mutable Int64      itsLastMainRow;   // Last main table row looked for
-    mutable Int64      itsLastJoinRow;   // Join table row matching itsLastMainRow
+    Int64              itsId;            // Unique id used by findRow's cache
+    Bool               itsParallelProbe;
   };
 
 } //# NAMESPACE CASACORE - END
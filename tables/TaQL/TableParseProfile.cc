@@ -0,0 +1,142 @@
+//# TableParseProfile.cc: Class to profile the execution of a TaQL command
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/TaQL/TableParseProfile.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/OS/Path.h>
+#include <casacore/casa/iostream.h>
+#include <iomanip>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  TableParseProfile::TableParseProfile()
+  {}
+
+  void TableParseProfile::start (const std::vector<Table>& tables)
+  {
+    itsTables     = tables;
+    itsStartStats = getIOStats (tables);
+    itsTimer.mark();
+  }
+
+  void TableParseProfile::stop (const String& step,
+                                rownr_t nrowIn, rownr_t nrowOut)
+  {
+    Step result;
+    result.name    = step;
+    result.time    = itsTimer.real();
+    result.nrowIn  = nrowIn;
+    result.nrowOut = nrowOut;
+    // Determine the IO done in this step by the data managers known
+    // at the start of the step.
+    std::map<const DataManager*,IOStats> stats = getIOStats (itsTables);
+    for (const auto& st : itsStartStats) {
+      auto iter = stats.find (st.first);
+      if (iter != stats.end()) {
+        IOStats io (iter->second);
+        // The statistics might have been reset in the meantime.
+        if (io.stats.nAccess >= st.second.stats.nAccess  &&
+            io.stats.nRead >= st.second.stats.nRead) {
+          io.stats.nAccess    -= st.second.stats.nAccess;
+          io.stats.nRead      -= st.second.stats.nRead;
+          io.stats.nBytesRead -= st.second.stats.nBytesRead;
+        }
+        if (io.stats.nAccess > 0  ||  io.stats.nRead > 0) {
+          result.io.push_back (io);
+        }
+      }
+    }
+    itsSteps.push_back (result);
+    itsTimer.mark();
+  }
+
+  void TableParseProfile::show (ostream& os) const
+  {
+    os << "Profile of the TaQL command:" << endl;
+    os << "  step              time(s)      rows in     rows out" << endl;
+    for (const Step& step : itsSteps) {
+      os << "  " << std::left << std::setw(14) << step.name << std::right
+         << std::fixed << std::setprecision(3) << std::setw(11) << step.time
+         << std::setw(13) << step.nrowIn
+         << std::setw(13) << step.nrowOut << endl;
+      os.unsetf (std::ios::fixed);
+      os << std::setprecision(6);
+      for (const IOStats& io : step.io) {
+        os << "      " << io.name << "  columns: " << io.columns << endl;
+        os << "        accesses: " << io.stats.nAccess
+           << "  reads: " << io.stats.nRead
+           << "  bytes read: " << io.stats.nBytesRead;
+        if (io.stats.nAccess >= io.stats.nRead  &&  io.stats.nAccess > 0) {
+          os << "  hit rate: "
+             << 100. * Double(io.stats.nAccess - io.stats.nRead) /
+                       Double(io.stats.nAccess) << '%';
+        }
+        os << endl;
+      }
+    }
+  }
+
+  std::map<const DataManager*,TableParseProfile::IOStats>
+  TableParseProfile::getIOStats (const std::vector<Table>& tables)
+  {
+    std::map<const DataManager*,IOStats> stats;
+    for (const Table& tab : tables) {
+      Record dminfo = tab.dataManagerInfo();
+      for (uInt i=0; i<dminfo.nfields(); ++i) {
+        const Record& dm = dminfo.subRecord(i);
+        Vector<String> columns (dm.asArrayString("COLUMNS"));
+        if (columns.empty()) {
+          continue;
+        }
+        // Some table types (e.g., a concatenation) cannot give their
+        // data managers; skip them.
+        const DataManager* dmPtr = 0;
+        try {
+          dmPtr = tab.findDataManager (columns[0], True);
+        } catch (const AipsError&) {
+          continue;
+        }
+        // Data managers used by multiple tables are only counted once.
+        if (stats.find (dmPtr) == stats.end()) {
+          IOStats io;
+          io.name = Path(tab.tableName()).baseName() + ':' +
+                    dm.asString("NAME") + " (" + dm.asString("TYPE") + ')';
+          for (uInt j=0; j<columns.size(); ++j) {
+            if (j > 0) {
+              io.columns += ',';
+            }
+            io.columns += columns[j];
+          }
+          io.stats = dmPtr->ioStatistics();
+          stats.insert (std::make_pair (dmPtr, io));
+        }
+      }
+    }
+    return stats;
+  }
+
+} //# NAMESPACE CASACORE - END
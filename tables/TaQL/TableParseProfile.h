@@ -0,0 +1,123 @@
+//# TableParseProfile.h: Class to profile the execution of a TaQL command
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEPARSEPROFILE_H
+#define TABLES_TABLEPARSEPROFILE_H
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/casa/OS/Timer.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <casacore/casa/iosfwd.h>
+#include <map>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+  // <summary>
+  // Class to profile the execution of a TaQL command
+  // </summary>
+
+  // <use visibility=local>
+
+  // <reviewed reviewer="" date="" tests="tTableParseProfile">
+  // </reviewed>
+
+  // <synopsis>
+  // TableParseProfile is used by TableParseQuery if the style PROFILE is
+  // given in a TaQL command, thus like:
+  // <srcblock>
+  //   USING STYLE PROFILE SELECT FROM my.ms WHERE ANTENNA1=2 ORDERBY TIME
+  // </srcblock>
+  // The command is executed as usual, but for each step (like open, where,
+  // groupby, orderby, projection, update) the wall time and the number of
+  // rows before and after the step are collected. Furthermore, for each
+  // data manager used by the tables in the FROM clause, it determines the
+  // number of bucket (or tile) accesses, the number of buckets read,
+  // the number of bytes read and the resulting cache hit rate.
+  // The results are shown when the command has been executed.
+  // <p>
+  // The open step covers the time from the start of handling the command
+  // until the first step executing it. Thus it includes opening the tables,
+  // preparing the expressions and building the index of a join.
+  // IO statistics are collected from the first step after opening.
+  // <br>Note that the IO statistics are kept by the storage managers per
+  // data manager, not per column. Only data managers with IO in a step
+  // are shown.
+  // </synopsis>
+
+  // <motivation>
+  // It should be possible to see where a slow query spends its time
+  // without using a profiler.
+  // </motivation>
+
+  class TableParseProfile
+  {
+  public:
+    // The constructor starts timing the open step.
+    TableParseProfile();
+
+    // Start timing a step. The IO statistics of the data managers used
+    // by the given tables are kept to determine the IO done in the step.
+    void start (const std::vector<Table>& tables);
+
+    // End a step giving its name and the number of rows before and after it.
+    void stop (const String& step, rownr_t nrowIn, rownr_t nrowOut);
+
+    // Show the profile of all steps.
+    void show (ostream& os) const;
+
+  private:
+    // IO statistics of a data manager.
+    struct IOStats {
+      String         name;
+      String         columns;
+      DataManIOStats stats;
+    };
+    // The results of a step.
+    struct Step {
+      String               name;
+      Double               time;
+      rownr_t              nrowIn;
+      rownr_t              nrowOut;
+      std::vector<IOStats> io;
+    };
+
+    // Get the IO statistics of all data managers used by the tables.
+    static std::map<const DataManager*,IOStats> getIOStats
+    (const std::vector<Table>& tables);
+
+    //# Data members.
+    Timer                                itsTimer;
+    std::vector<Table>                   itsTables;
+    std::map<const DataManager*,IOStats> itsStartStats;
+    std::vector<Step>                    itsSteps;
+  };
+
+} //# NAMESPACE CASACORE - END
+
+#endif
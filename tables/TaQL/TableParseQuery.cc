@@ -90,6 +90,30 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     delete resultSet_p;
   }
 
+  void TableParseQuery::startProfile()
+  {
+    profile_p.reset (new TableParseProfile());
+  }
+
+  void TableParseQuery::profileStart()
+  {
+    if (profile_p) {
+      std::vector<Table> tables;
+      for (const auto& tabp : tableList_p.fromTables()) {
+        tables.push_back (tabp.table());
+      }
+      profile_p->start (tables);
+    }
+  }
+
+  void TableParseQuery::profileStop (const String& step,
+                                     rownr_t nrowIn, rownr_t nrowOut)
+  {
+    if (profile_p) {
+      profile_p->stop (step, nrowIn, nrowOut);
+    }
+  }
+
   TableParseJoin& TableParseQuery::addJoin()
   {
     // Add a TableParseJoin object.
@@ -833,7 +857,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     if (noDupl_p) {
       sortOpt += Sort::NoDuplicates;
     }
-    sort.sort (newRownrs, nrrow, sortOpt);
+    // If only the first rows are needed (LIMIT), only those are sorted.
+    Int64 nrNeeded = sortLimit();
+    if (nrNeeded >= 0) {
+      sort.partialSort (newRownrs, nrrow, nrNeeded, sortOpt);
+    } else {
+      sort.sort (newRownrs, nrrow, sortOpt);
+    }
     if (showTimings) {
       timer.show ("  Orderby     ");
     }
@@ -845,6 +875,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   }
 
 
+  Int64 TableParseQuery::sortLimit() const
+  {
+    // Limit/offset is applied after the sort, unless DISTINCT is given.
+    // A negative offset or limit counts from the end, so needs all rows.
+    if (distinct_p  ||  offset_p < 0) {
+      return -1;
+    }
+    if (limit_p != 0) {
+      return (limit_p < 0  ?  -1 : offset_p + limit_p*stride_p);
+    }
+    return (endrow_p > 0  ?  endrow_p : -1);
+  }
+
   void TableParseQuery::doLimOff (Bool showTimings)
   {
     Timer timer;
@@ -1219,6 +1262,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     //# The first table in the list is the source table.
     Table table = tableList_p.firstTable();
+    //# The time until now is taken by opening the tables and preparing.
+    profileStop ("Open", 0, table.nrow());
     //# Set endrow_p if positive limit and positive or no offset.
     if (offset_p >= 0  &&  limit_p > 0) {
       endrow_p = offset_p + limit_p * stride_p;
@@ -1245,7 +1290,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       //#//                 << rang[i].end() << endl;
       //#//        }
       Timer timer;
+      profileStart();
       resultTable = table(node_p, nrmax);
+      profileStop ("Where", table.nrow(), resultTable.nrow());
       if (showTimings) {
         timer.show ("  Where       ");
       }
@@ -1258,11 +1305,14 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Execute possible groupby/aggregate.
     std::shared_ptr<TableExprGroupResult> groupResult;
     if (groupby_p.isUsed() != 0) {
+      profileStart();
+      rownr_t nrowIn = rownrs_p.size();
       groupResult = doGroupby (showTimings);
       // Aggregate results and normal table rows need to have the same rownrs,
       // so set the selected rows in the table column objects.
       resultTable = adjustApplySelNodes(table);
       table = resultTable;
+      profileStop ("Groupby", nrowIn, table.nrow());
       if (doTracing) {
         cerr << "GROUPBY resulted in " << table.nrow() << " groups" << endl;
         cerr << "  applySelection called for " << applySelNodes_p.size()
@@ -1272,9 +1322,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Do the projection of SELECT columns used in HAVING or ORDERBY.
     // Thereafter the column nodes need to use rownrs 0..n.
     if (tableProject_p.nColumnsPreCalc() > 0) {
+      profileStart();
       doProjectExpr (True, groupResult);
       resultTable = adjustApplySelNodes(table);
       table = resultTable;
+      profileStop ("Preprojection", rownrs_p.size(), table.nrow());
       if (doTracing) {
         cerr << "Pre-projected " << tableProject_p.nColumnsPreCalc()
              << " columns" << endl;
@@ -1283,14 +1335,20 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
     }
     // Do the possible HAVING step.
+    profileStart();
+    rownr_t nrowIn = rownrs_p.size();
     if (doHaving (showTimings, groupResult)) {
+      profileStop ("Having", nrowIn, rownrs_p.size());
       if (doTracing) {
         cerr << "HAVING resulted in " << rownrs_p.size() << " rows" << endl;
       }
     }
     //# Then do the sort.
     if (sort_p.size() > 0) {
+      profileStart();
+      nrowIn = rownrs_p.size();
       doSort (showTimings);
+      profileStop ("Orderby", nrowIn, rownrs_p.size());
       if (doTracing) {
         cerr << "ORDERBY resulted in " << rownrs_p.size() << " rows" << endl;
       }
@@ -1299,7 +1357,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // because duplicate rows will be removed.
     if (!distinct_p  &&  (offset_p != 0  ||  limit_p != 0  ||
                           endrow_p != 0  || stride_p != 1)) {
+      profileStart();
+      nrowIn = rownrs_p.size();
       doLimOff (showTimings);
+      profileStop ("Limit/offset", nrowIn, rownrs_p.size());
       if (doTracing) {
         cerr << "LIMIT/OFFSET resulted in " << rownrs_p.size() << " rows" << endl;
       }
@@ -1326,22 +1387,29 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
     }
     //# Then do the update, delete, insert, or projection and so.
+    profileStart();
+    nrowIn = rownrs_p.size();
     if (commandType_p == PUPDATE) {
       doUpdate (showTimings, table, resultTable, rownrs_p);
       table.flush();
+      profileStop ("Update", nrowIn, rownrs_p.size());
     } else if (commandType_p == PINSERT) {
       Table tabNewRows = doInsert (showTimings, table);
       table.flush();
       resultTable = tabNewRows;
+      profileStop ("Insert", nrowIn, resultTable.nrow());
     } else if (commandType_p == PDELETE) {
       doDelete (showTimings, table);
       table.flush();
+      profileStop ("Delete", nrowIn, rownrs_p.size());
     } else if (commandType_p == PCOUNT) {
       resultTable = doCount (showTimings, table);
+      profileStop ("Count", nrowIn, resultTable.nrow());
     } else {
       //# Then do the projection.
       if (tableProject_p.getColumnNames().size() > 0) {
         resultTable = doProject (showTimings, table, groupResult);
+        profileStop ("Projection", nrowIn, resultTable.nrow());
         if (doTracing) {
           cerr << "Final projection done of "
                << tableProject_p.getColumnNames().size() -
@@ -1353,7 +1421,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       // If select distinct is given, limit/offset must be done at the end.
       if (distinct_p  &&  (offset_p != 0  ||  limit_p != 0  ||
                            endrow_p != 0  || stride_p != 1)) {
+        profileStart();
+        nrowIn = resultTable.nrow();
         resultTable = doLimOff (showTimings, resultTable);
+        profileStop ("Limit/offset", nrowIn, resultTable.nrow());
         if (doTracing) {
           cerr << "LIMIT/OFFSET resulted in " << resultTable.nrow()
                << " rows" << endl;
@@ -1361,7 +1432,10 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       }
       //# Finally rename or copy using the given name (and flush it).
       if (resultType_p != 0  ||  ! resultName_p.empty()) {
+        profileStart();
+        nrowIn = resultTable.nrow();
         resultTable = doFinish (showTimings, resultTable, tempTables, stack);
+        profileStop ("Giving", nrowIn, resultTable.nrow());
         if (doTracing) {
           cerr << "Finished the GIVING command" << endl;
         }
@@ -1369,6 +1443,9 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     }
     //# Keep the table for later.
     table_p = resultTable;
+    if (profile_p) {
+      profile_p->show (cout);
+    }
   }
 
   String TableParseQuery::getTableStructure (const Vector<String>& parts,
@@ -34,6 +34,7 @@
 #include <casacore/tables/TaQL/TableParseUpdate.h>
 #include <casacore/tables/TaQL/TableParseSortKey.h>
 #include <casacore/tables/TaQL/TableParseGroupby.h>
+#include <casacore/tables/TaQL/TableParseProfile.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/tables/TaQL/ExprGroup.h>
@@ -140,6 +141,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                   const std::vector<const Table*>& tempTables = std::vector<const Table*>(),
                   const std::vector<TableParseQuery*>& stack = std::vector<TableParseQuery*>());
 
+    // Start profiling the command (for style PROFILE).
+    // It has to be called before the tables are opened.
+    // The profile is shown when the command has been executed.
+    void startProfile();
+
     // Execute a query in a FROM clause resulting in a Table.
     Table doFromQuery (Bool showTimings);
 
@@ -375,8 +381,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                    const std::shared_ptr<TableExprGroupResult>& groups);
 
     // Do the sort step.
+    // If a limit is given, only the first rows are sorted.
     void doSort (Bool showTimings);
 
+    // Get the number of sorted rows needed by the limit/offset step.
+    // It returns -1 if all rows are needed.
+    Int64 sortLimit() const;
+
     // Do the limit/offset step.
     void  doLimOff (Bool showTimings);
     Table doLimOff (Bool showTimings, const Table& table);
@@ -389,6 +400,13 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                     const std::vector<const Table*>& tempTables,
                     const std::vector<TableParseQuery*>& stack);
 
+    // Start or stop profiling a step in the execution of the command.
+    // Nothing is done if no profiling is done.
+    // <group>
+    void profileStart();
+    void profileStop (const String& step, rownr_t nrowIn, rownr_t nrowOut);
+    // </group>
+
     // Make an array from the contents of a column in a subquery.
     TableExprNode getColSet();
 
@@ -453,6 +471,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     Table projectExprTable_p;
     //# The resulting row numbers.
     Vector<rownr_t> rownrs_p;
+    //# The profile of the command (only set for style PROFILE).
+    std::shared_ptr<TableParseProfile> profile_p;
   };
 
 
@@ -0,0 +1,195 @@
+//# tExprNodeChunk.cc: Test program for the chunked evaluation of TaQL expressions
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprNodeRep.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/BasicMath/Math.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+#include <memory>
+#include <vector>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for the chunked evaluation of TaQL expressions.
+// </summary>
+
+const rownr_t nrow = 10000;
+const String tabName("tExprNodeChunk_tmp.tab");
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<uInt>   ("ANT"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Float>  ("WEIGHT"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("FLAG"));
+  td.addColumn (ArrayColumnDesc<Double>  ("UVW", IPosition(1,3),
+                                          ColumnDesc::Direct));
+  td.addColumn (ArrayColumnDesc<Int>     ("VAR"));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm("SSM", 4096);
+  IncrementalStMan ism("ISM", 4096);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("SCAN", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<uInt>   antCol(tab, "ANT");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Float>  weightCol(tab, "WEIGHT");
+  ScalarColumn<Bool>   flagCol(tab, "FLAG");
+  ArrayColumn<Double>  uvwCol(tab, "UVW");
+  ArrayColumn<Int>     varCol(tab, "VAR");
+  Vector<Double> uvw(3);
+  for (rownr_t i=0; i<nrow; ++i) {
+    scanCol.put (i, i/100);
+    antCol.put (i, i%27);
+    timeCol.put (i, Double((i*7919)%nrow) - 5000);
+    weightCol.put (i, (i%9) * 0.5);
+    flagCol.put (i, i%7 == 0);
+    uvw[0] = (i%101) * 20.;
+    uvw[1] = (i%103) * -15.;
+    uvw[2] = i%5;
+    uvwCol.put (i, uvw);
+    // Only some cells of VAR are defined.
+    if (i%3 == 0) {
+      varCol.put (i, Vector<Int>(2, i%11));
+    }
+  }
+}
+
+// Compare the chunked evaluation of a Bool expression with the evaluation
+// per row and with the result of a selection. The number of rows is not a
+// multiple of the chunk size used.
+void checkBool (const Table& tab, const TableExprNode& node)
+{
+  const rownr_t nr = tab.nrow();
+  std::unique_ptr<Bool[]> vals(new Bool[nr]);
+  node.getRep()->getBoolChunk (0, nr, vals.get());
+  rownr_t nmatch = 0;
+  for (rownr_t i=0; i<nr; ++i) {
+    AlwaysAssertExit (vals[i] == node.getBool(i));
+    if (vals[i]) nmatch++;
+  }
+  // Check a chunk not starting at row 0.
+  std::unique_ptr<Bool[]> part(new Bool[nr/2]);
+  node.getRep()->getBoolChunk (nr/3, nr/2, part.get());
+  for (rownr_t i=0; i<nr/2; ++i) {
+    AlwaysAssertExit (part[i] == vals[nr/3 + i]);
+  }
+  Table sel = tab(node);
+  AlwaysAssertExit (sel.nrow() == nmatch);
+  cout << nmatch << ' ';
+}
+
+// Compare the chunked evaluation of a numeric expression with the
+// evaluation per row.
+void checkDouble (const Table& tab, const TableExprNode& node)
+{
+  const rownr_t nr = tab.nrow();
+  std::vector<Double> vals(nr);
+  node.getRep()->getDoubleChunk (0, nr, vals.data());
+  for (rownr_t i=0; i<nr; ++i) {
+    Double val = node.getDouble(i);
+    AlwaysAssertExit ((isNaN(val) && isNaN(vals[i]))  ||  vals[i] == val);
+  }
+  if (node.getNodeRep()->dataType() == TableExprNodeRep::NTInt) {
+    std::vector<Int64> ivals(nr);
+    node.getRep()->getIntChunk (0, nr, ivals.data());
+    for (rownr_t i=0; i<nr; ++i) {
+      AlwaysAssertExit (ivals[i] == node.getInt(i));
+    }
+  }
+}
+
+void testExpr (const Table& tab)
+{
+  TableExprNode scan   = tab.col("SCAN");
+  TableExprNode ant    = tab.col("ANT");
+  TableExprNode time   = tab.col("TIME");
+  TableExprNode weight = tab.col("WEIGHT");
+  TableExprNode flag   = tab.col("FLAG");
+  TableExprNode uvw    = tab.col("UVW");
+  TableExprNode var    = tab.col("VAR");
+  TableExprNodeSet inx0, inx1;
+  inx0.add (TableExprNodeSetElem(TableExprNode(Int64(0))));
+  inx1.add (TableExprNodeSetElem(1));
+  TableExprNode u = uvw(inx0);
+  TableExprNode v = uvw(inx1);
+  checkDouble (tab, scan*2 - ant);
+  checkDouble (tab, -scan + 3);
+  checkDouble (tab, time / 3. + weight);
+  checkDouble (tab, sqrt(u*u + v*v));
+  checkDouble (tab, sin(time) * cos(time) - exp(weight));
+  checkDouble (tab, log(time) + log10(abs(time)));
+  checkDouble (tab, pow(weight, 2.5) + atan2(u, v) + square(weight));
+  checkDouble (tab, max(time, u) - min(v, weight));
+  checkDouble (tab, iif(flag, time, weight));
+  checkBool (tab, sqrt(square(u) + square(v)) > 1000.);
+  checkBool (tab, scan == 3  ||  ant == 5u);
+  checkBool (tab, scan > 50  &&  time <= 0.  &&  !flag);
+  checkBool (tab, scan != 4  &&  weight >= 2);
+  checkBool (tab, flag  ||  time < -4000.);
+  checkBool (tab, time < 0  &&  flag);
+  checkBool (tab, time > 1e10  ||  (scan < 3  &&  !flag));
+  // The right operand must not be evaluated for undefined VAR cells.
+  checkBool (tab, isdefined(var)  &&  sum(var) > 10);
+  checkBool (tab, !isdefined(var)  ||  sum(var) > 10);
+  TableExprNodeSet inxv;
+  inxv.add (TableExprNodeSetElem(1));
+  checkBool (tab, isdefined(var)  &&  var(inxv) > 4);
+  cout << endl;
+}
+
+void testSelect()
+{
+  Table tab(tabName);
+  testExpr (tab);
+  // The same for a selection from the table.
+  Table sel = tab(tab.col("ANT") != 3u);
+  testExpr (sel);
+  // Check that limit and offset are obeyed.
+  Table sel1 = tableCommand ("select from $1 where SCAN == 37 || ANT == 26"
+                             " limit 10 offset 5", tab).table();
+  cout << "rows " << sel1.rowNumbers() << endl;
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testSelect();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,166 @@
+//# tTableGroupbyParallel.cc: Test program for GROUPBY and aggregation using multiple threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan/StandardStManAccessor.h>
+#include <casacore/tables/DataMan/IncrStManAccessor.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for GROUPBY and aggregation using multiple threads.
+// </summary>
+
+const rownr_t nrow = 200000;
+const String tabName("tTableGroupbyParallel_tmp.tab");
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Int>    ("ANT1"));
+  td.addColumn (ScalarColumnDesc<Int>    ("ANT2"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("FLAG"));
+  td.addColumn (ArrayColumnDesc<Float>   ("DATA", IPosition(1,2),
+                                          ColumnDesc::Direct));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm("SSM", 4096);
+  IncrementalStMan ism("ISM", 4096);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("SCAN", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<Int>    ant1Col(tab, "ANT1");
+  ScalarColumn<Int>    ant2Col(tab, "ANT2");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Bool>   flagCol(tab, "FLAG");
+  ArrayColumn<Float>   dataCol(tab, "DATA");
+  Vector<Float> data(2);
+  for (rownr_t i=0; i<nrow; ++i) {
+    scanCol.put (i, i/1000);
+    ant1Col.put (i, i%7);
+    ant2Col.put (i, i%11);
+    timeCol.put (i, Double((i*7919)%nrow) * 0.25);
+    flagCol.put (i, i%13 == 0);
+    data[0] = i%17;
+    data[1] = i%19;
+    dataCol.put (i, data);
+  }
+}
+
+// Check that the columns of two tables are the same.
+// Double values can have round-off differences.
+void compareTables (const Table& tab1, const Table& tab2)
+{
+  AlwaysAssertExit (tab1.nrow() == tab2.nrow());
+  Vector<String> names = tab1.tableDesc().columnNames();
+  for (const String& name : names) {
+    TableColumn col(tab1, name);
+    const ColumnDesc& cd = col.columnDesc();
+    if (cd.isArray()) {
+      AlwaysAssertExit (allEQ (ArrayColumn<Double>(tab1, name).getColumn(),
+                               ArrayColumn<Double>(tab2, name).getColumn()));
+    } else if (cd.dataType() == TpDouble) {
+      AlwaysAssertExit (allNear (ScalarColumn<Double>(tab1, name).getColumn(),
+                                 ScalarColumn<Double>(tab2, name).getColumn(),
+                                 1e-10));
+    } else if (cd.dataType() == TpBool) {
+      AlwaysAssertExit (allEQ (ScalarColumn<Bool>(tab1, name).getColumn(),
+                               ScalarColumn<Bool>(tab2, name).getColumn()));
+    } else {
+      AlwaysAssertExit (allEQ (ScalarColumn<Int64>(tab1, name).getColumn(),
+                               ScalarColumn<Int64>(tab2, name).getColumn()));
+    }
+  }
+}
+
+// Execute the query serially and in parallel and compare the results.
+Table checkQuery (const Table& tab, const String& query)
+{
+  Table::setSelectNThreads (1);
+  Table res1 = tableCommand (query, tab).table();
+  Table::setSelectNThreads (4);
+  Table res2 = tableCommand (query, tab).table();
+  Table::setSelectNThreads (1);
+  compareTables (res1, res2);
+  cout << res1.nrow() << ' ';
+  return res1;
+}
+
+void testGroupby()
+{
+  Table tab(tabName, TableLock(TableLock::UserNoReadLocking));
+  ROStandardStManAccessor ssmAcc(tab, "SSM");
+  ROIncrementalStManAccessor ismAcc(tab, "ISM");
+  ssmAcc.setConcurrentRead (True);
+  ismAcc.setConcurrentRead (True);
+  // Multiple keys.
+  Table res = checkQuery
+    (tab, "select ANT1, ANT2, gcount() as N, gsum(SCAN) as S,"
+     " gmin(TIME) as MINT, gmax(TIME) as MAXT, gmean(TIME) as MEANT,"
+     " gvariance(TIME) as VART, gstddev(TIME) as STDT, grms(TIME) as RMST,"
+     " gfirst(TIME) as FIRSTT, glast(TIME) as LASTT, gmedian(TIME) as MEDT,"
+     " gany(FLAG) as ANYF, gall(FLAG) as ALLF, gntrue(FLAG) as NTF"
+     " from $1 groupby ANT1, ANT2");
+  cout << "first group: " << ScalarColumn<Int64>(res, "N")(0) << ' '
+       << ScalarColumn<Int64>(res, "S")(0) << ' '
+       << ScalarColumn<Double>(res, "MEDT")(0) << ' '
+       << ScalarColumn<Double>(res, "FIRSTT")(0) << ' '
+       << ScalarColumn<Double>(res, "LASTT")(0) << endl;
+  // A single Int key.
+  checkQuery (tab, "select SCAN, gcount() as N, gmax(ANT1+ANT2) as M,"
+              " gsum(sum(DATA)) as S, gproduct(ANT1 % 2 + 1) as P,"
+              " gsumsqr(TIME) as SQ, gfractile(TIME, 0.3) as FR"
+              " from $1 groupby SCAN");
+  // A single Double key, a WHERE and a HAVING.
+  checkQuery (tab, "select floor(TIME/1000) as TK, gmin(SCAN) as MI,"
+              " gmean(ANT1) as ME, gnfalse(FLAG) as NF from $1"
+              " where ANT2 != 3 groupby floor(TIME/1000)"
+              " having gmin(SCAN) < 100");
+  // Aggregation without GROUPBY.
+  checkQuery (tab, "select gcount() as N, gsum(TIME) as S, gmin(ANT2) as MI"
+              " from $1");
+  // Array aggregates are not mergeable, so they are done serially.
+  checkQuery (tab, "select ANT1, gsums(DATA) as S from $1 groupby ANT1");
+  cout << endl;
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testGroupby();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
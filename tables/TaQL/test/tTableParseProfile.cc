@@ -0,0 +1,149 @@
+//# tTableParseProfile.cc: Test program for profiling TaQL commands
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan/DataManAccessor.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for profiling TaQL commands (style PROFILE).
+// </summary>
+
+const String tabName("tTableParseProfile_tmp.tab");
+
+// ID is stored in the ISM, the other columns in the SSM.
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("ID"));
+  td.addColumn (ScalarColumnDesc<Double> ("VALUE"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm("SSM", 512);
+  IncrementalStMan ism("ISM");
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("ID", ism);
+  Table tab(newtab, 1000);
+  ScalarColumn<Int>    idCol(tab, "ID");
+  ScalarColumn<Double> valCol(tab, "VALUE");
+  ScalarColumn<String> nameCol(tab, "NAME");
+  for (rownr_t i=0; i<tab.nrow(); ++i) {
+    idCol.put (i, i/100);
+    valCol.put (i, Double(i%17));
+    nameCol.put (i, "name" + String::toString(i%3));
+  }
+}
+
+// Execute the command with the profile going to a string.
+// Show the profile without the (variable) times and IO counts.
+void doCommand (const String& command)
+{
+  ostringstream os;
+  streambuf* coutBuf = cout.rdbuf (os.rdbuf());
+  try {
+    tableCommand ("using style profile " + command);
+  } catch (...) {
+    cout.rdbuf (coutBuf);
+    throw;
+  }
+  cout.rdbuf (coutBuf);
+  cout << command << endl;
+  istringstream is(os.str());
+  String line;
+  Bool inProfile = False;
+  while (getline (is, line)) {
+    istringstream ls(line);
+    String word1, word2;
+    ls >> word1 >> word2;
+    if (line.find ("Profile of the TaQL command") != String::npos) {
+      inProfile = True;
+    } else if (inProfile  &&  word1 == "step") {
+      cout << "  step rows_in rows_out" << endl;
+    } else if (inProfile  &&  word1 == "accesses:") {
+      // Only tell if data were accessed.
+      AlwaysAssertExit (! word2.empty());
+      cout << "      accessed" << endl;
+    } else if (inProfile  &&  line.find ("columns:") != String::npos) {
+      cout << "    " << word1 << ' ' << word2
+           << line.substr (line.find ("columns:") + 8) << endl;
+    } else if (inProfile) {
+      String nrowIn, nrowOut;
+      ls >> nrowIn >> nrowOut;
+      cout << "  " << word1 << ' ' << nrowIn << ' ' << nrowOut << endl;
+    }
+  }
+  cout << endl;
+}
+
+void testIOStats()
+{
+  Table tab(tabName);
+  RODataManAccessor ssmAcc(tab, "SSM", False);
+  RODataManAccessor ismAcc(tab, "ISM", False);
+  DataManIOStats stats = ssmAcc.ioStatistics();
+  AlwaysAssertExit (stats.nAccess == 0  &&  stats.nRead == 0);
+  // Reading a column accesses the buckets.
+  ScalarColumn<Double>(tab, "VALUE").getColumn();
+  stats = ssmAcc.ioStatistics();
+  AlwaysAssertExit (stats.nAccess > 0  &&  stats.nRead > 0);
+  AlwaysAssertExit (stats.nRead <= stats.nAccess);
+  AlwaysAssertExit (stats.nBytesRead == stats.nRead * 512);
+  AlwaysAssertExit (ismAcc.ioStatistics().nAccess == 0);
+  ScalarColumn<Int>(tab, "ID").getColumn();
+  AlwaysAssertExit (ismAcc.ioStatistics().nRead > 0);
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testIOStats();
+    doCommand ("select from " + tabName + " where ID in [2,5]");
+    doCommand ("select ID, gsum(VALUE) from " + tabName +
+               " where VALUE > 3 groupby ID having gsum(VALUE) > 500"
+               " orderby ID desc limit 2");
+    doCommand ("select distinct NAME from " + tabName +
+               " orderby NAME giving tTableParseProfile_tmp.res as memory");
+    doCommand ("count ID from " + tabName);
+    doCommand ("update " + tabName + " set VALUE=VALUE+1 where ID=3");
+    doCommand ("delete from " + tabName + " where ID>7");
+    // Profiling is only done if asked for.
+    ostringstream os;
+    streambuf* coutBuf = cout.rdbuf (os.rdbuf());
+    tableCommand ("select from " + tabName + " where ID=2");
+    cout.rdbuf (coutBuf);
+    AlwaysAssertExit (os.str().empty());
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,145 @@
+//# tTableSelectParallel.cc: Test program for selecting rows using multiple threads
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan/StandardStManAccessor.h>
+#include <casacore/tables/DataMan/IncrStManAccessor.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/tables/TaQL/ExprNodeUtil.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for selecting rows using multiple threads.
+// </summary>
+
+const rownr_t nrow = 100000;
+const String tabName("tTableSelectParallel_tmp.tab");
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  td.addColumn (ArrayColumnDesc<Float>   ("DATA", IPosition(1,2),
+                                          ColumnDesc::Direct));
+  td.addColumn (ArrayColumnDesc<Int>     ("TSM", IPosition(1,2),
+                                          ColumnDesc::Direct));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm("SSM", 4096);
+  IncrementalStMan ism("ISM", 4096);
+  TiledColumnStMan tsm("TSM", IPosition(2,2,1000));
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("SCAN", ism);
+  newtab.bindColumn ("TSM", tsm);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<String> nameCol(tab, "NAME");
+  ArrayColumn<Float>   dataCol(tab, "DATA");
+  ArrayColumn<Int>     tsmCol(tab, "TSM");
+  Vector<Float> data(2);
+  for (rownr_t i=0; i<nrow; ++i) {
+    scanCol.put (i, i/1000);
+    timeCol.put (i, Double((i*7919)%nrow));
+    nameCol.put (i, "name" + String::toString(i%13));
+    data[0] = i%17;
+    data[1] = i%19;
+    dataCol.put (i, data);
+    tsmCol.put (i, Vector<Int>(2, i%10));
+  }
+}
+
+// Select serially and in parallel and check that the results are equal.
+void checkSelect (const Table& tab, const TableExprNode& node,
+                  rownr_t maxRow=0, rownr_t offset=0)
+{
+  Table::setSelectNThreads (1);
+  Table sel1 = tab(node, maxRow, offset);
+  Table::setSelectNThreads (4);
+  Table sel2 = tab(node, maxRow, offset);
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(), sel2.rowNumbers()));
+  cout << sel1.nrow() << ' ';
+}
+
+Bool canParallel (const TableExprNode& node)
+{
+  return TableExprNodeUtil::canEvaluateInParallel (node.getRep().get());
+}
+
+void testSelect()
+{
+  Table tab(tabName, TableLock(TableLock::UserNoReadLocking));
+  TableExprNode scan = tab.col("SCAN");
+  TableExprNode time = tab.col("TIME");
+  TableExprNode name = tab.col("NAME");
+  TableExprNode data = tab.col("DATA");
+  // Without concurrent read mode a serial selection has to be done.
+  AlwaysAssertExit (! canParallel (time > 10.));
+  ROStandardStManAccessor ssmAcc(tab, "SSM");
+  ROIncrementalStManAccessor ismAcc(tab, "ISM");
+  ssmAcc.setConcurrentRead (True);
+  ismAcc.setConcurrentRead (True);
+  AlwaysAssertExit (canParallel (time > 10.  &&  scan == 3));
+  AlwaysAssertExit (canParallel (name == "name3"  ||  sum(data) > 30));
+  AlwaysAssertExit (canParallel (min(data) > 3));
+  AlwaysAssertExit (! canParallel (sum(tab.col("TSM")) == 6));
+  AlwaysAssertExit (! canParallel (time > tab.nodeRandom()));
+  checkSelect (tab, time > 10.  &&  scan == 3);
+  checkSelect (tab, time < 50000.  ||  scan > 90);
+  checkSelect (tab, sin(time) > 0.5  &&  name == "name7");
+  checkSelect (tab, sum(data) > 25.  &&  min(data) < 10);
+  checkSelect (tab, time < 0.);
+  checkSelect (tab, sum(tab.col("TSM")) == 6);
+  // maxRow and offset.
+  checkSelect (tab, time > 10., 10);
+  checkSelect (tab, time > 10., 40000, 30000);
+  checkSelect (tab, time > 10., 0, 99980);
+  checkSelect (tab, time > 10., 1000000, 1000000);
+  cout << endl;
+  // TaQL uses the same selection code.
+  Table::setSelectNThreads (0);
+  Table sel = tableCommand ("select from $1 where TIME between 100 and 200"
+                            " && SCAN < 50 limit 10 offset 5", tab).table();
+  cout << "rows " << sel.rowNumbers() << endl;
+  Table::setSelectNThreads (1);
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testSelect();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+//# tTableSortLimit.cc: Test program for TaQL ORDERBY with LIMIT
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for a TaQL ORDERBY combined with LIMIT and/or OFFSET.
+// Only the first rows are sorted in that case, so the result is checked
+// against the equivalent part of a full sort.
+// </summary>
+
+const rownr_t nrow = 20000;
+const String tabName("tTableSortLimit_tmp.tab");
+
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  SetupNewTable newtab(tabName, td, Table::New);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<String> nameCol(tab, "NAME");
+  // Use many equal keys to check that the sort is stable.
+  for (rownr_t i=0; i<nrow; ++i) {
+    scanCol.put (i, (i*7919)%37);
+    timeCol.put (i, Double((i*104729)%101));
+    nameCol.put (i, "name" + String::toString(i%13));
+  }
+}
+
+// Select the rows with and without limit/offset and compare the result
+// with the rows of the full sort.
+void checkSort (const String& orderby, const String& limit,
+                Int64 offset, Int64 nr, Int64 stride=1)
+{
+  Vector<rownr_t> all = tableCommand ("select from " + tabName + " orderby " +
+                                      orderby).table().rowNumbers();
+  Vector<rownr_t> part = tableCommand ("select from " + tabName +
+                                       " orderby " + orderby + ' ' +
+                                       limit).table().rowNumbers();
+  AlwaysAssertExit (Int64(part.size()) == nr);
+  for (Int64 i=0; i<nr; ++i) {
+    AlwaysAssertExit (part[i] == all[offset + i*stride]);
+  }
+  cout << part.size() << " rows for orderby " << orderby << ' '
+       << limit << endl;
+}
+
+void testSort()
+{
+  checkSort ("SCAN", "limit 10", 0, 10);
+  checkSort ("desc SCAN", "limit 10", 0, 10);
+  checkSort ("SCAN, TIME desc", "limit 25 offset 100", 100, 25);
+  checkSort ("NAME, TIME", "limit 1", 0, 1);
+  checkSort ("TIME, NAME desc", "offset 19990", 19990, 10);
+  checkSort ("SCAN, TIME", "limit 100:200:7", 100, 15, 7);
+  checkSort ("SCAN", "limit 15000", 0, 15000);
+  checkSort ("SCAN", "limit 5 offset -10", nrow-10, 5);
+  checkSort ("SCAN", "limit 30000", 0, nrow);
+  // Limit is applied after DISTINCT, so all rows have to be sorted.
+  Table sel = tableCommand ("select distinct SCAN from " + tabName +
+                            " orderby SCAN limit 5").table();
+  AlwaysAssertExit (allEQ (ScalarColumn<Int>(sel, "SCAN").getColumn(),
+                           Vector<Int>({0,1,2,3,4})));
+  sel = tableCommand ("select from " + tabName +
+                      " orderby NODUPLICATES desc SCAN limit 3").table();
+  AlwaysAssertExit (allEQ (ScalarColumn<Int>(sel, "SCAN").getColumn(),
+                           Vector<Int>({36,35,34})));
+  cout << "distinct ok" << endl;
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testSort();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -53,6 +53,7 @@
 #include <casacore/casa/Containers/RecordField.h>
 
 //#   table lookup
+#include <casacore/tables/Tables/ColumnIndexFile.h>
 #include <casacore/tables/Tables/ColumnsIndex.h>
 #include <casacore/tables/Tables/ColumnsIndexArray.h>
 
@@ -245,6 +245,15 @@ void ArrayColumnData::getArrayColumnCells (const RefRows& rownrs,
     autoReleaseLock();
 }
 
+const void* ArrayColumnData::getArrayColumnPtr (rownr_t startRow,
+                                               rownr_t nrow) const
+{
+    checkReadLock (True);
+    const void* ptr = dataColPtr_p->getArrayColumnPtr (startRow, nrow);
+    autoReleaseLock();
+    return ptr;
+}
+
 void ArrayColumnData::getColumnSlice (const Slicer& ns,
                                       ArrayBase& array) const
 {
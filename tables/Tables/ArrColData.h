@@ -175,6 +175,10 @@ public:
     // the actual length. This is checked by ArrayColumn.
     void getArrayColumnCells (const RefRows& rownrs, ArrayBase& arrayPtr) const;
 
+    // Get a pointer to the array values in the given consecutive rows
+    // if the data manager holds them contiguously in memory.
+    const void* getArrayColumnPtr (rownr_t startRow, rownr_t nrow) const;
+
     // Get subsections from all arrays in the column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
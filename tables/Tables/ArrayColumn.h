@@ -31,6 +31,7 @@
 #include <casacore/casa/aips.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/tables/Tables/ArrayColumnBase.h>
+#include <casacore/tables/Tables/ArrayColumnView.h>
 #include <casacore/tables/Tables/TableError.h>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -296,6 +297,22 @@ public:
     Array<T> getColumnCells (const RefRows& rownrs) const;
     // </group>
 
+    // Get a read-only view of the array in a cell or of the arrays in
+    // some cells. If the storage manager allows it, the array in the view
+    // references the data in the storage manager without copying them;
+    // otherwise it contains a copy. This is only possible if the rows
+    // are contiguous. See class <linkto class=ArrayColumnView>
+    // ArrayColumnView</linkto> for the conditions and for how long
+    // the view is valid.
+    // <br>Similar to <src>getColumnRange</src> and <src>getColumnCells</src>
+    // the array has an extra dimension representing the rows; the array
+    // returned by <src>getView</src> has the shape of the cell.
+    // <group>
+    ArrayColumnView<T> getView (rownr_t rownr) const;
+    ArrayColumnView<T> getColumnRangeView (const Slicer& rowRange) const;
+    ArrayColumnView<T> getColumnCellsView (const RefRows& rownrs) const;
+    // </group>
+
     // Get slices from some arrays in a column.
     // The first Slicer object can be used to specify start, end (or length),
     // and stride of the rows to get. The second Slicer object can be
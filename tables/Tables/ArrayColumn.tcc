@@ -294,6 +294,68 @@ void ArrayColumn<T>::getColumnCells (const RefRows& rownrs,
 }
 
 
+template<class T>
+ArrayColumnView<T> ArrayColumn<T>::getView (rownr_t rownr) const
+{
+    TABLECOLUMNCHECKROW(rownr);
+    const void* ptr = baseColPtr_p->getArrayColumnPtr (rownr, 1);
+    if (ptr) {
+        T* data = static_cast<T*>(const_cast<void*>(ptr));
+        return ArrayColumnView<T> (Array<T>(baseColPtr_p->shape(rownr),
+                                            data, SHARE),
+                                   baseTabPtr_p->shared_from_this(), True);
+    }
+    return ArrayColumnView<T> (get(rownr), baseTabPtr_p->shared_from_this(),
+                               False);
+}
+
+template<class T>
+ArrayColumnView<T> ArrayColumn<T>::getColumnRangeView
+                                          (const Slicer& rowRange) const
+{
+    IPosition blc, trc, inc;
+    rowRange.inferShapeFromSource (IPosition(1,nrow()), blc, trc, inc);
+    return getColumnCellsView (RefRows(blc(0), trc(0), inc(0)));
+}
+
+template<class T>
+ArrayColumnView<T> ArrayColumn<T>::getColumnCellsView
+                                          (const RefRows& rownrs) const
+{
+    //# A view can only be made for a contiguous range of rows.
+    rownr_t nrrow = rownrs.nrow();
+    Bool contiguous = (nrrow == 1);
+    const Vector<rownr_t>& rowvec = rownrs.rowVector();
+    if (nrrow > 1) {
+        if (rownrs.isSliced()) {
+            contiguous = (rowvec.size() == 3  &&  rowvec[2] == 1);
+        } else {
+            contiguous = True;
+            for (rownr_t i=1; i<nrrow; ++i) {
+                if (rowvec[i] != rowvec[0] + i) {
+                    contiguous = False;
+                    break;
+                }
+            }
+        }
+    }
+    if (contiguous) {
+        rownr_t start = rownrs.firstRow();
+        TABLECOLUMNCHECKROW(start + nrrow - 1);
+        const void* ptr = baseColPtr_p->getArrayColumnPtr (start, nrrow);
+        if (ptr) {
+            IPosition shp = baseColPtr_p->shape(start);
+            shp.append (IPosition(1, nrrow));
+            T* data = static_cast<T*>(const_cast<void*>(ptr));
+            return ArrayColumnView<T> (Array<T>(shp, data, SHARE),
+                                       baseTabPtr_p->shared_from_this(), True);
+        }
+    }
+    return ArrayColumnView<T> (getColumnCells(rownrs),
+                               baseTabPtr_p->shared_from_this(), False);
+}
+
+
 template<class T>
 Array<T> ArrayColumn<T>::getColumnRange (const Slicer& rowRange,
                                          const Slicer& arraySection) const
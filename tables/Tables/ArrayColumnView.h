@@ -0,0 +1,142 @@
+//# ArrayColumnView.h: Read-only view of the arrays in a table column
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_ARRAYCOLUMNVIEW_H
+#define TABLES_ARRAYCOLUMNVIEW_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/tables/Tables/BaseTable.h>
+#include <memory>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+
+// <summary>
+// Read-only view of the arrays in a table column
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tArrayColumnView">
+// </reviewed>
+
+// <prerequisite>
+//   <li> ArrayColumn
+// </prerequisite>
+
+// <synopsis>
+// An ArrayColumnView object is returned by the <src>getView</src>,
+// <src>getColumnRangeView</src> and <src>getColumnCellsView</src>
+// functions in class <linkto class=ArrayColumn>ArrayColumn</linkto>.
+// If the storage manager allows it, the array in the view references the
+// data in the storage manager directly, thus without copying them.
+// This is possible for a memory-mapped Tiled Storage Manager (see
+// <linkto class=TSMOption>TSMOption</linkto>) if the column is the only
+// one in its hypercube, its data do not need to be converted, and a tile
+// spans entire cells. It is also possible for a single cell in a
+// <linkto class=MemoryStMan>MemoryStMan</linkto>. Otherwise the array
+// contains a copy of the data. Function <src>isReference</src> tells
+// which of the two is the case.
+// <p>
+// The view keeps the table (and thereby its storage managers) alive.
+// However, the array only references valid data as long as the data in
+// the column are not changed, rows are not added or removed, and the table
+// lock is not released (so another process can change the table).
+// The array must never be changed if it references the storage.
+// Note that a copy of the array (made with the copy constructor) also
+// references the storage, but does not keep the table alive.
+// </synopsis>
+
+// <motivation>
+// Large data columns (e.g. visibility data) are often read only to be
+// inspected or reduced. Copying them into a new array is then a waste of
+// memory bandwidth.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  Table tab("my.ms", TableLock(), Table::Old, TSMOption::MMap);
+//  ArrayColumn<Complex> data(tab, "DATA");
+//  ArrayColumnView<Complex> view = data.getColumnRangeView (Slicer(
+//                                    IPosition(1,0), IPosition(1,1000)));
+//  Complex sum = casacore::sum (view.array());
+// </srcblock>
+// </example>
+
+template<class T>
+class ArrayColumnView
+{
+public:
+    // Construct an empty view.
+    ArrayColumnView()
+      : isReference_p (False)
+    {}
+
+    // Construct from the array and the table it is part of.
+    // <src>isReference</src> tells if the array references the storage.
+    ArrayColumnView (const Array<T>& array,
+                     const std::shared_ptr<BaseTable>& table,
+                     Bool isReference)
+      : array_p       (array),
+        table_p       (table),
+        isReference_p (isReference)
+    {}
+
+    // Copy constructor and assignment (reference semantics).
+    // <group>
+    ArrayColumnView (const ArrayColumnView<T>&) = default;
+    ArrayColumnView<T>& operator= (const ArrayColumnView<T>& that)
+    {
+      if (this != &that) {
+        array_p.reference (that.array_p);
+        table_p       = that.table_p;
+        isReference_p = that.isReference_p;
+      }
+      return *this;
+    }
+    // </group>
+
+    // Get the array.
+    const Array<T>& array() const
+      { return array_p; }
+
+    // Does the array reference the data in the storage manager?
+    // If False, the array contains a copy of the data.
+    Bool isReference() const
+      { return isReference_p; }
+
+private:
+    Array<T>                   array_p;
+    std::shared_ptr<BaseTable> table_p;   //# keeps the storage managers alive
+    Bool                       isReference_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
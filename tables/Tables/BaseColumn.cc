@@ -93,6 +93,11 @@ Bool BaseColumn::canChangeShape() const
     return False;                      // can not be changed
 }
 
+Bool BaseColumn::canReadConcurrently() const
+{
+    return False;
+}
+
 void BaseColumn::get (rownr_t, void*) const
 {
   throw (TableInvOper ("get() not implemented for column " +
@@ -135,6 +140,11 @@ void BaseColumn::getArrayColumnCells (const RefRows&, ArrayBase&) const
                        colDescPtr_p->name() + "; only valid for an array"));
 }
 
+const void* BaseColumn::getArrayColumnPtr (rownr_t, rownr_t) const
+{
+  return 0;
+}
+
 void BaseColumn::getColumnSliceCells (const RefRows&,
 				      const Slicer&, ArrayBase&) const
 {
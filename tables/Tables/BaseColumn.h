@@ -149,6 +149,10 @@ public:
     // Default is no.
     virtual Bool canChangeShape() const;
 
+    // Can the column be read by multiple threads at the same time?
+    // Default is no.
+    virtual Bool canReadConcurrently() const;
+
     // Initialize the rows from startRow till endRow (inclusive)
     // with the default value defined in the column description.
     virtual void initialize (rownr_t startRownr, rownr_t endRownr) = 0;
@@ -185,6 +189,13 @@ public:
     virtual void getArrayColumnCells (const RefRows& rownrs,
 				      ArrayBase& dataPtr) const;
 
+    // Get a pointer to the array values in the given consecutive rows
+    // if they are held contiguously in memory in local format, thus can
+    // be used without copying them.
+    // The default implementation returns a null pointer.
+    virtual const void* getArrayColumnPtr (rownr_t startRow,
+                                           rownr_t nrow) const;
+
     // Get subsections from some arrays in the column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
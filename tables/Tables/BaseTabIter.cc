@@ -28,6 +28,7 @@
 #include <casacore/tables/Tables/RefTable.h>
 #include <casacore/tables/Tables/TableColumn.h>
 #include <casacore/casa/Utilities/Sort.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <vector>
@@ -53,16 +54,29 @@ BaseTableIterator::BaseTableIterator (const std::shared_ptr<BaseTable>& btp,
     keyChangeAtLastNext_p(""),
     colPtr_p  (keys.size()),
     cmpObj_p  (cmp),
+    sortOrder_p    (keys.size(), Sort::Ascending),
+    sortIfNeeded_p (option == TableIterator::SortIfNeeded),
+    outOfOrder_p   (False),
+    sortedRest_p   (False),
     lastVal_p (keys.size()),
     curVal_p  (keys.size()),
     sortIterBoundaries_p   (nullptr),
     sortIterKeyIdxChange_p (nullptr),
     aRefTable_p(nullptr)
 {
+    for (uInt i=0; i<nrkeys_p; i++) {
+        if (order[i] == TableIterator::Descending) {
+            sortOrder_p[i] = Sort::Descending;
+        }
+    }
     // If needed sort the table in order of the iteration keys.
     // The passed in compare functions are for the iteration.
+    // If only sorted when needed, it is checked while iterating.
     if (option == TableIterator::NoSort) {
         sortTab_p = btp;
+    } else if (sortIfNeeded_p) {
+        origTab_p = btp;
+        sortTab_p = btp;
     }else{
         Sort::Option sortopt = Sort::QuickSort;
         if (option == TableIterator::HeapSort) {
@@ -71,18 +85,14 @@ BaseTableIterator::BaseTableIterator (const std::shared_ptr<BaseTable>& btp,
             sortopt = Sort::ParSort;
         } else if (option == TableIterator::InsSort) {
             sortopt = Sort::InsSort;
-        }
-        std::vector<Int> ord(nrkeys_p, Sort::Ascending);
-        for (uInt i=0; i<nrkeys_p; i++) {
-            if (order[i] == TableIterator::Descending) {
-                ord[i] = Sort::Descending;
-            }
+        } else if (option == TableIterator::RadixSort) {
+            sortopt = Sort::RadixSort;
         }
         if (cacheIterationBoundaries) {
             sortIterBoundaries_p   = std::make_shared<Vector<rownr_t>>();
             sortIterKeyIdxChange_p = std::make_shared<Vector<size_t>>();
         }
-        sortTab_p = btp->sort (keys, cmpObj_p, ord, sortopt,
+        sortTab_p = btp->sort (keys, cmpObj_p, sortOrder_p, sortopt,
                                sortIterBoundaries_p,
                                sortIterKeyIdxChange_p);
     }
@@ -92,7 +102,7 @@ BaseTableIterator::BaseTableIterator (const std::shared_ptr<BaseTable>& btp,
         colPtr_p[i] = sortTab_p->getColumn (keys[i]);
         colPtr_p[i]->allocIterBuf (lastVal_p[i], curVal_p[i], cmpObj_p[i]);
     }
-    if (cacheIterationBoundaries) {
+    if (sortIterBoundaries_p) {
         sortIterBoundariesIt_p   = sortIterBoundaries_p->begin();
         sortIterKeyIdxChangeIt_p = sortIterKeyIdxChange_p->begin();
         aBaseTable_p = sortTab_p->makeRefTable (False, 0);
@@ -114,6 +124,11 @@ BaseTableIterator::BaseTableIterator (const BaseTableIterator& that)
   nrkeys_p  (that.nrkeys_p),
   colPtr_p  (that.colPtr_p),
   cmpObj_p  (that.cmpObj_p),
+  origTab_p      (that.origTab_p),
+  sortOrder_p    (that.sortOrder_p),
+  sortIfNeeded_p (that.sortIfNeeded_p),
+  outOfOrder_p   (that.outOfOrder_p),
+  sortedRest_p   (that.sortedRest_p),
   lastVal_p (that.nrkeys_p),
   curVal_p  (that.nrkeys_p),
   sortIterBoundaries_p   (that.sortIterBoundaries_p),
@@ -137,6 +152,8 @@ BaseTableIterator::BaseTableIterator (const BaseTableIterator& that)
         aRefTable_p = dynamic_cast<RefTable*>(aBaseTable_p.get());
         DebugAssert (aRefTable_p, AipsError);
     }
+    // The copy starts at the beginning, so the table might need to be sorted.
+    reset();
 }
 
 BaseTableIterator::~BaseTableIterator()
@@ -147,9 +164,45 @@ BaseTableIterator::~BaseTableIterator()
     }
 }
 
+void BaseTableIterator::setSortTable (const std::shared_ptr<BaseTable>& tab)
+{
+    for (uInt i=0; i<nrkeys_p; i++) {
+        String name = colPtr_p[i]->columnDesc().name();
+        colPtr_p[i]->freeIterBuf (lastVal_p[i], curVal_p[i]);
+        colPtr_p[i] = tab->getColumn (name);
+        colPtr_p[i]->allocIterBuf (lastVal_p[i], curVal_p[i], cmpObj_p[i]);
+    }
+    sortTab_p = tab;
+}
+
+void BaseTableIterator::sortRows (Bool allRows)
+{
+    std::vector<String> keys(nrkeys_p);
+    std::vector<std::shared_ptr<BaseCompare>> cmp(nrkeys_p);
+    for (uInt i=0; i<nrkeys_p; i++) {
+        keys[i] = colPtr_p[i]->columnDesc().name();
+        cmp[i]  = cmpObj_p[i];
+    }
+    std::shared_ptr<BaseTable> tab = origTab_p;
+    if (!allRows) {
+        Vector<rownr_t> rows(sortTab_p->nrow() - lastRow_p);
+        indgen (rows, lastRow_p);
+        tab = sortTab_p->select (rows);
+    }
+    setSortTable (tab->sort (keys, cmp, sortOrder_p, Sort::ParSort));
+    lastRow_p = 0;
+}
+
 void BaseTableIterator::reset()
 {
     lastRow_p = 0;
+    // If the table appeared to be out of order, sort it entirely now.
+    if (sortIfNeeded_p  &&  (outOfOrder_p || sortedRest_p)) {
+        sortRows (True);
+        sortIfNeeded_p = False;
+        outOfOrder_p   = False;
+        sortedRest_p   = True;
+    }
     if (sortIterBoundaries_p) {
         sortIterBoundariesIt_p = sortIterBoundaries_p->begin();
     }
@@ -208,6 +261,14 @@ std::shared_ptr<BaseTable> BaseTableIterator::noCachedIterBoundariesNext()
     // This is an expensive way to find the next group boundary by calling
     // the sorting function for each individual row.
 
+    // If the previous step found that the next group is out of order,
+    // sort the remaining rows.
+    if (outOfOrder_p) {
+        sortRows (False);
+        outOfOrder_p = False;
+        sortedRest_p = True;
+    }
+
     // Allocate a RefTable to represent the rows in the iteration group.
     std::shared_ptr<BaseTable> baseTabPtr = sortTab_p->makeRefTable (False, 0);
     RefTable* itp = dynamic_cast<RefTable*>(baseTabPtr.get());
@@ -226,10 +287,15 @@ std::shared_ptr<BaseTable> BaseTableIterator::noCachedIterBoundariesNext()
 	match = True;
 	for (uInt i=0; i<nrkeys_p; i++) {
 	    colPtr_p[i]->get (lastRow_p, curVal_p[i]);
-	    if (cmpObj_p[i]->comp (curVal_p[i], lastVal_p[i])  != 0) {
+	    int cmp = cmpObj_p[i]->comp (curVal_p[i], lastVal_p[i]);
+	    if (cmp != 0) {
 		match = False;
 		// update so users can see which key changed
 		keyChangeAtLastNext_p=colPtr_p[i]->columnDesc().name();   
+		// Check if the next group is in the requested order.
+		if (sortIfNeeded_p  &&  cmp == sortOrder_p[i]) {
+		    outOfOrder_p = True;
+		}
 		break;
 	    }
 	}
@@ -252,6 +318,13 @@ std::shared_ptr<BaseTable> BaseTableIterator::noCachedIterBoundariesNext()
 void
 BaseTableIterator::copyState(const BaseTableIterator &other)
 {
+  // Iterate on the same table if the other one sorted it while iterating.
+  if (sortTab_p != other.sortTab_p) {
+      setSortTable (other.sortTab_p);
+  }
+  sortIfNeeded_p = other.sortIfNeeded_p;
+  outOfOrder_p   = other.outOfOrder_p;
+  sortedRest_p   = other.sortedRest_p;
   lastRow_p = other.lastRow_p;
   keyChangeAtLastNext_p = other.keyChangeAtLastNext_p;
 
@@ -71,6 +71,11 @@ class String;
 // order and then creating a RefTable for each step containing the
 // rows for that iteration step. Each iteration step assembles the
 // rows with equal key values.
+// <br>If option TableIterator::SortIfNeeded is given, the table is not
+// sorted beforehand, but it is checked in each step if the keys of the
+// next group follow the keys of the current group in the requested order.
+// If not, the rows not iterated yet are sorted and the iteration continues
+// on those.
 // </synopsis> 
 
 //# <todo asof="$DATE:$">
@@ -125,6 +130,11 @@ public:
     inline const String& keyChangeAtLastNext() const
       { return keyChangeAtLastNext_p; }
 
+    // Tell if the remaining rows had to be sorted because option
+    // TableIterator::SortIfNeeded was given and an out-of-order key was found.
+    Bool sortedWhileIterating() const
+      { return sortedRest_p; }
+
 protected:
     std::shared_ptr<BaseTable> sortTab_p; //# Table sorted in iteration order
     rownr_t                lastRow_p;     //# last row used from reftab
@@ -139,6 +149,20 @@ protected:
     std::shared_ptr<BaseTable> noCachedIterBoundariesNext();
 
 private:
+    // Use the given table to iterate on; get its key columns and
+    // allocate the value buffers.
+    void setSortTable (const std::shared_ptr<BaseTable>& tab);
+
+    // Sort the rows from lastRow_p on and continue iterating on them.
+    // If all rows are sorted, it restarts the iteration on the fully
+    // sorted original table.
+    void sortRows (Bool allRows);
+
+    std::shared_ptr<BaseTable> origTab_p; //# Table to iterate (SortIfNeeded)
+    std::vector<Int>       sortOrder_p;   //# sort order per column
+    Bool                   sortIfNeeded_p;//# sort only if out of order?
+    Bool                   outOfOrder_p;  //# out-of-order key found?
+    Bool                   sortedRest_p;  //# remaining rows have been sorted?
     Block<void*>           lastVal_p;     //# last value per column
     Block<void*>           curVal_p;      //# current value per column
 
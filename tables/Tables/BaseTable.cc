@@ -32,6 +32,8 @@
 #include <casacore/tables/Tables/PlainTable.h>
 #include <casacore/tables/Tables/RefTable.h>
 #include <casacore/tables/Tables/TableCopy.h>
+#include <casacore/tables/Tables/ColumnIndexFile.h>
+#include <casacore/tables/Tables/TableZoneFilter.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/BaseColumn.h>
 #include <casacore/tables/TaQL/ExprNode.h>
@@ -56,6 +58,10 @@
 #include <casacore/casa/OS/RegularFile.h>
 #include <casacore/casa/OS/Directory.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/OS/OMP.h>
+#include <exception>
+#include <memory>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -767,6 +773,98 @@ std::shared_ptr<BaseTable> BaseTable::select (rownr_t maxRow, rownr_t offset)
 }
 
 // Do the row selection.
+//# The number of rows evaluated by a thread at a time when selecting.
+static const rownr_t selectChunkRows = 16384;
+
+//# Evaluate a select expression using multiple threads.
+//# The rows are divided in chunks which are evaluated in parallel in
+//# batches. The matching rows of the chunks in a batch are added in order,
+//# so the evaluation can stop if the maximum nr of rows is reached.
+//# The first chunk is evaluated serially to let the nodes initialize
+//# themselves if done lazily.
+static void selectParallel (const TableExprNode& node, Bool useIndex,
+                            const Vector<rownr_t>& indexRows, rownr_t nrrow,
+                            rownr_t maxRow, rownr_t offset, uInt nthreads,
+                            RefTable& resultTable)
+{
+    rownr_t nchunk = (nrrow + selectChunkRows - 1) / selectChunkRows;
+    std::vector<std::vector<rownr_t>> rows(4*nthreads);
+    rownr_t chunk = 0;
+    while (chunk < nchunk) {
+      Int nb = (chunk == 0  ?  1 : std::min(rownr_t(rows.size()), nchunk-chunk));
+      std::exception_ptr error;
+      std::mutex errorMutex;
+#pragma omp parallel for num_threads(nthreads) if (nb > 1) schedule(dynamic)
+      for (Int b=0; b<nb; ++b) {
+        try {
+          rows[b].clear();
+          rownr_t st  = (chunk+b) * selectChunkRows;
+          rownr_t end = std::min (st + selectChunkRows, nrrow);
+          TableExprId id;
+          Bool val;
+          for (rownr_t j=st; j<end; ++j) {
+            rownr_t i = (useIndex  ?  indexRows[j] : j);
+            id.setRownr (i);
+            node.get (id, val);
+            if (val) {
+              rows[b].push_back (i);
+            }
+          }
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(errorMutex);
+          if (! error) {
+            error = std::current_exception();
+          }
+        }
+      }
+      if (error) {
+        std::rethrow_exception (error);
+      }
+      //# Add the matching rows, but skip the first offset rows.
+      for (Int b=0; b<nb; ++b) {
+        for (rownr_t i : rows[b]) {
+          if (offset == 0) {
+            resultTable.addRownr (i);
+            if (resultTable.nrow() == maxRow) {
+              return;
+            }
+          } else {
+            offset--;
+          }
+        }
+      }
+      chunk += nb;
+    }
+}
+
+//# The number of rows evaluated at a time by the chunked evaluation.
+static const size_t selectVectorRows = 4096;
+
+//# Evaluate a select expression a chunk of rows at a time, so the nodes
+//# can process the rows in tight loops instead of per row.
+static void selectChunked (const TableExprNode& node, rownr_t nrrow,
+                           rownr_t maxRow, rownr_t offset,
+                           RefTable& resultTable)
+{
+    std::unique_ptr<Bool[]> vals(new Bool[selectVectorRows]);
+    for (rownr_t st=0; st<nrrow; st+=selectVectorRows) {
+      size_t n = std::min (rownr_t(selectVectorRows), nrrow-st);
+      node.getRep()->getBoolChunk (st, n, vals.get());
+      for (size_t j=0; j<n; ++j) {
+        if (vals[j]) {
+          if (offset == 0) {
+            resultTable.addRownr (st+j);
+            if (resultTable.nrow() == maxRow) {
+              return;
+            }
+          } else {
+            offset--;
+          }
+        }
+      }
+    }
+}
+
 std::shared_ptr<BaseTable> BaseTable::select (const TableExprNode& node,
                                               rownr_t maxRow, rownr_t offset)
 {
@@ -808,10 +906,54 @@ std::shared_ptr<BaseTable> BaseTable::select (const TableExprNode& node,
     //# Adjust the row numbers to reflect row numbers in the root table.
     std::shared_ptr<RefTable> resultTable = makeRefTable (True, 0);
     DebugAssert (static_cast<bool>(resultTable), AipsError);
+    //# A persistent column index can tell which rows can match,
+    //# so only those rows have to be tested.
+    Vector<rownr_t> indexRows;
+    Bool useIndex = ColumnIndexFile::preselect (*this, node, indexRows);
+    //# Otherwise the min/max statistics of the data managers can tell
+    //# which zones of rows cannot match.
+    std::unique_ptr<TableZoneFilter> zoneFilter;
+    if (! useIndex) {
+      zoneFilter.reset (new TableZoneFilter (*this, node));
+      if (! zoneFilter->isActive()) {
+        zoneFilter.reset();
+      }
+    }
     Bool val;
-    rownr_t nrrow = nrow();
+    rownr_t nrrow = (useIndex  ?  indexRows.size() : nrow());
+    //# Use multiple threads if possible and worthwhile.
+    uInt nthreads = 1;
+    if (!zoneFilter  &&  nrrow > selectChunkRows) {
+      nthreads = Table::getSelectNThreads();
+      if (nthreads == 0) {
+        nthreads = OMP::maxThreads();
+      }
+      if (nthreads > 1
+      &&  !TableExprNodeUtil::canEvaluateInParallel (node.getRep().get())) {
+        nthreads = 1;
+      }
+    }
+    if (nthreads > 1) {
+      selectParallel (node, useIndex, indexRows, nrrow, maxRow, offset,
+                      nthreads, *resultTable);
+      adjustRownrs (resultTable->nrow(), resultTable->rowStorage(), False);
+      return resultTable;
+    }
+    //# Evaluate the expression a chunk of rows at a time if possible.
+    if (!useIndex  &&  !zoneFilter
+    &&  TableExprNodeUtil::canEvaluateInChunks (node.getRep().get())) {
+      selectChunked (node, nrrow, maxRow, offset, *resultTable);
+      adjustRownrs (resultTable->nrow(), resultTable->rowStorage(), False);
+      return resultTable;
+    }
+    rownr_t nextRow;
     TableExprId id;
-    for (rownr_t i=0; i<nrrow; i++) {
+    for (rownr_t j=0; j<nrrow; j++) {
+      if (zoneFilter  &&  ! zoneFilter->canMatch (j, nextRow)) {
+        j = nextRow - 1;
+        continue;
+      }
+      rownr_t i = (useIndex  ?  indexRows[j] : j);
       id.setRownr (i);
       node.get (id, val);
       if (val) {
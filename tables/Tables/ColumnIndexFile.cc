@@ -0,0 +1,388 @@
+//# ColumnIndexFile.cc: Persistent sorted index of a table column
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/Tables/ColumnIndexFile.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/PlainTable.h>
+#include <casacore/tables/Tables/PlainColumn.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/TableRecord.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprRange.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/IO/MMapIO.h>
+#include <casacore/casa/IO/RegularFileIO.h>
+#include <casacore/casa/OS/RegularFile.h>
+#include <casacore/casa/OS/Path.h>
+#include <casacore/casa/Utilities/GenSort.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# The index file consists of a header of 4 values
+//#   magic value (also used to check the byte order)
+//#   version
+//#   number of rows in the table when the index was made
+//#   number of keys
+//# followed by the sorted keys (as Double) and their row numbers.
+//# All values are 8 bytes in the local byte order.
+namespace {
+  const uInt64 theirMagic   = 0x5844494c4f43ULL;    // "COLIDX"
+  const uInt64 theirVersion = 1;
+  const uInt   theirNHeader = 4;
+  // Read the column values in chunks of this number of rows.
+  const rownr_t theirChunkSize = 1024*1024;
+
+  // Read the values of a column as Double. NaN values are left out.
+  template<typename T>
+  void readKeys (const Table& table, const String& columnName,
+                 std::vector<Double>& keys, std::vector<rownr_t>& rownrs)
+  {
+    ScalarColumn<T> col(table, columnName);
+    rownr_t nrow = table.nrow();
+    keys.reserve (nrow);
+    rownrs.reserve (nrow);
+    for (rownr_t st=0; st<nrow; st+=theirChunkSize) {
+      rownr_t nr = std::min (theirChunkSize, nrow-st);
+      Vector<T> vals = col.getColumnRange (Slicer(IPosition(1,st),
+                                                  IPosition(1,nr)));
+      for (rownr_t i=0; i<nr; ++i) {
+        Double val = vals[i];
+        if (! std::isnan(val)) {
+          keys.push_back (val);
+          rownrs.push_back (st+i);
+        }
+      }
+    }
+  }
+}
+
+
+ColumnIndexFile::ColumnIndexFile (const Table& table,
+                                  const String& columnName)
+  : itsColumnName (columnName),
+    itsNKeys      (0),
+    itsKeys       (0),
+    itsRownrs     (0)
+{
+  if (! isValid (table.tableName(), columnName, table.nrow())) {
+    throw TableError ("ColumnIndexFile: column " + columnName +
+                      " of table " + table.tableName() +
+                      " has no valid index");
+  }
+  itsFile.reset (new MMapIO (RegularFile(fileName (table.tableName(),
+                                                   columnName)),
+                             ByteIO::Old));
+  const uInt64* header =
+    static_cast<const uInt64*>(itsFile->getReadPointer (0));
+  itsNKeys  = header[3];
+  itsKeys   = reinterpret_cast<const Double*>(header + theirNHeader);
+  itsRownrs = header + theirNHeader + itsNKeys;
+}
+
+ColumnIndexFile::~ColumnIndexFile()
+{}
+
+void ColumnIndexFile::findRange (Double start, Double end,
+                                 rownr_t& first, rownr_t& last) const
+{
+  first = std::lower_bound (itsKeys, itsKeys+itsNKeys, start) - itsKeys;
+  last  = std::upper_bound (itsKeys+first, itsKeys+itsNKeys, end) - itsKeys;
+}
+
+rownr_t ColumnIndexFile::count (const Vector<Double>& start,
+                                const Vector<Double>& end) const
+{
+  rownr_t nr = 0;
+  for (size_t i=0; i<start.size(); ++i) {
+    rownr_t first, last;
+    findRange (start[i], end[i], first, last);
+    nr += last - first;
+  }
+  return nr;
+}
+
+Vector<rownr_t> ColumnIndexFile::rowNumbers (const Vector<Double>& start,
+                                             const Vector<Double>& end) const
+{
+  Vector<rownr_t> rownrs(count (start, end));
+  rownr_t nr = 0;
+  for (size_t i=0; i<start.size(); ++i) {
+    rownr_t first, last;
+    findRange (start[i], end[i], first, last);
+    std::copy (itsRownrs+first, itsRownrs+last, rownrs.data()+nr);
+    nr += last - first;
+  }
+  std::sort (rownrs.data(), rownrs.data() + nr);
+  return rownrs;
+}
+
+
+void ColumnIndexFile::create (Table& table, const String& columnName)
+{
+  if (! table.isRootTable()  ||  table.tableType() != Table::Plain) {
+    throw TableError ("ColumnIndexFile: an index can only be made for a "
+                      "persistent table, not for a selection");
+  }
+  if (! table.isWritable()) {
+    throw TableError ("ColumnIndexFile: table " + table.tableName() +
+                      " must be writable to make an index");
+  }
+  const ColumnDesc& cd = table.tableDesc().columnDesc (columnName);
+  if (! cd.isScalar()) {
+    throw TableError ("ColumnIndexFile: column " + columnName +
+                      " cannot be indexed; it is not a scalar column");
+  }
+  // Flush first, so writing pending data does not invalidate the index.
+  table.flush();
+  std::vector<Double>  keys;
+  std::vector<rownr_t> rownrs;
+  switch (cd.dataType()) {
+  case TpUChar:
+    readKeys<uChar> (table, columnName, keys, rownrs);
+    break;
+  case TpShort:
+    readKeys<Short> (table, columnName, keys, rownrs);
+    break;
+  case TpUShort:
+    readKeys<uShort> (table, columnName, keys, rownrs);
+    break;
+  case TpInt:
+    readKeys<Int> (table, columnName, keys, rownrs);
+    break;
+  case TpUInt:
+    readKeys<uInt> (table, columnName, keys, rownrs);
+    break;
+  case TpInt64:
+    readKeys<Int64> (table, columnName, keys, rownrs);
+    break;
+  case TpFloat:
+    readKeys<Float> (table, columnName, keys, rownrs);
+    break;
+  case TpDouble:
+    readKeys<Double> (table, columnName, keys, rownrs);
+    break;
+  default:
+    throw TableError ("ColumnIndexFile: column " + columnName +
+                      " cannot be indexed; its data type is not numeric");
+  }
+  // Sort the keys and write them with their row numbers.
+  rownr_t nkeys = keys.size();
+  Vector<rownr_t> index;
+  GenSortIndirect<Double,rownr_t>::sort (index, keys.data(), nkeys);
+  uInt64 header[theirNHeader];
+  header[0] = theirMagic;
+  header[1] = theirVersion;
+  header[2] = table.nrow();
+  header[3] = nkeys;
+  RegularFileIO file (RegularFile(fileName (table.tableName(), columnName)),
+                      ByteIO::New);
+  file.write (sizeof(header), header);
+  std::vector<Double> sortedKeys;
+  sortedKeys.reserve (std::min (nkeys, theirChunkSize));
+  for (rownr_t st=0; st<nkeys; st+=theirChunkSize) {
+    rownr_t nr = std::min (theirChunkSize, nkeys-st);
+    sortedKeys.clear();
+    for (rownr_t i=0; i<nr; ++i) {
+      sortedKeys.push_back (keys[index[st+i]]);
+    }
+    file.write (nr*sizeof(Double), sortedKeys.data());
+  }
+  std::vector<uInt64> sortedRows;
+  sortedRows.reserve (std::min (nkeys, theirChunkSize));
+  for (rownr_t st=0; st<nkeys; st+=theirChunkSize) {
+    rownr_t nr = std::min (theirChunkSize, nkeys-st);
+    sortedRows.clear();
+    for (rownr_t i=0; i<nr; ++i) {
+      sortedRows.push_back (rownrs[index[st+i]]);
+    }
+    file.write (nr*sizeof(uInt64), sortedRows.data());
+  }
+  file.flush();
+  // Register the index in the table keywords.
+  TableRecord& keySet = table.rwKeywordSet();
+  if (! keySet.isDefined (keywordName())) {
+    keySet.defineRecord (keywordName(), TableRecord());
+  }
+  keySet.rwSubRecord(keywordName()).define
+    (columnName, Path(fileName (table.tableName(), columnName)).baseName());
+  table.flush();
+}
+
+void ColumnIndexFile::remove (Table& table, const String& columnName)
+{
+  invalidate (table.tableName(), columnName);
+  TableRecord& keySet = table.rwKeywordSet();
+  if (keySet.isDefined (keywordName())) {
+    TableRecord& rec = keySet.rwSubRecord (keywordName());
+    if (rec.isDefined (columnName)) {
+      rec.removeField (columnName);
+    }
+    if (rec.nfields() == 0) {
+      keySet.removeField (keywordName());
+    }
+  }
+}
+
+void ColumnIndexFile::update (Table& table)
+{
+  Vector<String> names = indexedColumns (table);
+  for (const String& name : names) {
+    if (! table.tableDesc().isColumn (name)) {
+      remove (table, name);
+    } else if (! isValid (table, name)) {
+      create (table, name);
+    }
+  }
+}
+
+Vector<String> ColumnIndexFile::indexedColumns (const Table& table)
+{
+  return indexedColumns (table.keywordSet());
+}
+
+Vector<String> ColumnIndexFile::indexedColumns (const TableRecord& keySet)
+{
+  Int fld = keySet.fieldNumber (keywordName());
+  if (fld < 0  ||  keySet.dataType(fld) != TpRecord) {
+    return Vector<String>();
+  }
+  const TableRecord& rec = keySet.subRecord (fld);
+  Vector<String> names(rec.nfields());
+  for (uInt i=0; i<rec.nfields(); ++i) {
+    names[i] = rec.name(i);
+  }
+  return names;
+}
+
+Bool ColumnIndexFile::isValid (const Table& table, const String& columnName)
+{
+  return isValid (table.tableName(), columnName, table.nrow());
+}
+
+Bool ColumnIndexFile::isValid (const String& tableName,
+                               const String& columnName, rownr_t nrow)
+{
+  RegularFile file(fileName (tableName, columnName));
+  if (! file.exists()) {
+    return False;
+  }
+  uInt64 header[theirNHeader];
+  RegularFileIO fio(file);
+  if (fio.read (sizeof(header), header, False) != Int64(sizeof(header))) {
+    return False;
+  }
+  // A file made on a machine with another byte order is not valid.
+  return header[0] == theirMagic  &&  header[1] == theirVersion
+    &&  header[2] == nrow
+    &&  Int64(file.size()) == Int64((theirNHeader + 2*header[3]) *
+                                    sizeof(uInt64));
+}
+
+void ColumnIndexFile::invalidate (const String& tableName,
+                                  const String& columnName)
+{
+  RegularFile file(fileName (tableName, columnName));
+  if (file.exists()) {
+    file.remove();
+  }
+}
+
+Bool ColumnIndexFile::preselect (BaseTable& table, const TableExprNode& node,
+                                 Vector<rownr_t>& rownrs)
+{
+  // Only a plain table can have an index.
+  PlainTable* ptab = dynamic_cast<PlainTable*>(&table);
+  if (ptab == 0) {
+    return False;
+  }
+  Vector<String> names = indexedColumns (ptab->keywordSet());
+  if (names.empty()) {
+    return False;
+  }
+  std::vector<TableExprRange> ranges;
+  TableExprNode(node).ranges (ranges);
+  if (ranges.empty()) {
+    return False;
+  }
+  // Use the index giving the fewest rows.
+  std::unique_ptr<ColumnIndexFile> bestIndex;
+  const TableExprRange* bestRange = 0;
+  rownr_t bestCount = ptab->nrow();
+  for (const TableExprRange& range : ranges) {
+    // The column has to be a column in this table.
+    const TableColumn& col = range.getColumn();
+    const String& name = col.columnDesc().name();
+    Table colTab = col.table();
+    if (! colTab.isRootTable()  ||  colTab.tableName() != ptab->tableName()
+    ||  std::find (names.begin(), names.end(), name) == names.end()
+    ||  ! isValid (ptab->tableName(), name, ptab->nrow())) {
+      continue;
+    }
+    // The index reflects the flushed data only, so it cannot be used
+    // if the column has been changed since the last flush.
+    const PlainColumn* pcol =
+      dynamic_cast<const PlainColumn*>(ptab->getColumn (name));
+    if (pcol == 0  ||  pcol->isChanged()) {
+      continue;
+    }
+    std::unique_ptr<ColumnIndexFile> index
+      (new ColumnIndexFile (colTab, name));
+    rownr_t nr = index->count (range.start(), range.end());
+    if (nr < bestCount) {
+      bestIndex.swap (index);
+      bestRange = &range;
+      bestCount = nr;
+    }
+  }
+  if (! bestIndex) {
+    return False;
+  }
+  rownrs.reference (bestIndex->rowNumbers (bestRange->start(),
+                                           bestRange->end()));
+  return True;
+}
+
+const String& ColumnIndexFile::keywordName()
+{
+  static const String name("_COLUMN_INDEX_");
+  return name;
+}
+
+String ColumnIndexFile::fileName (const String& tableName,
+                                  const String& columnName)
+{
+  return tableName + "/table.colindex_" + columnName;
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,200 @@
+//# ColumnIndexFile.h: Persistent sorted index of a table column
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_COLUMNINDEXFILE_H
+#define TABLES_COLUMNINDEXFILE_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <memory>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class Table;
+class BaseTable;
+class TableRecord;
+class TableExprNode;
+class MMapIO;
+
+// <summary>
+// Persistent sorted index of a table column.
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tColumnIndexFile.cc" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=Table>Table</linkto>
+//   <li> <linkto class=ColumnsIndex>ColumnsIndex</linkto>
+//   <li> <linkto class=TableExprRange>TableExprRange</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Unlike <linkto class=ColumnsIndex>ColumnsIndex</linkto>, which is
+// built in memory each time a table is opened, a ColumnIndexFile is
+// stored in the table directory, so it can be used by every process
+// opening the table.
+// <br>An index is made for a single scalar column with a numeric data
+// type. The index file contains the column values in ascending order
+// (as Double) and the row numbers they belong to. NaN values are left
+// out. The file is memory-mapped when used, so a lookup only reads the
+// pages needed by the binary search and the row numbers found.
+// <p>
+// Function <src>create</src> makes the index file and registers the
+// column in the table keyword <src>_COLUMN_INDEX_</src>.
+// The index of a column is invalidated (i.e., its file is removed) when
+// the table is flushed after the data manager containing the column has
+// written data. Note that a data manager usually contains several columns,
+// so writing one of the other columns also invalidates the index.
+// Function <src>update</src> rebuilds the invalidated indices.
+// <p>
+// <src>Table::operator()(const TableExprNode&)</src> (thus also a TaQL
+// WHERE clause and MSSelection) uses a valid index to preselect the rows
+// to be tested. Therefore it uses the column ranges as found by
+// <src>TableExprNode::ranges</src>, which recognizes comparisons like
+// <src>col == x</src>, <src>col > x</src>, <src>col IN [...]</src>
+// and <src>col BETWEEN x AND y</src> combined with && and ||.
+// If ranges for multiple indexed columns are found, the index giving the
+// fewest rows is used. The expression is evaluated for the preselected
+// rows only, so the result is the same as without an index.
+// <br>The index file reflects the flushed data only. Therefore the index
+// of a column is not used if the column (or the number of rows) has been
+// changed since the table was flushed last; the table is not flushed
+// by a selection.
+// </synopsis>
+
+// <example>
+// <srcblock>
+// // Make an index for SCAN_NUMBER in a MeasurementSet.
+// Table tab("my.ms", Table::Update);
+// ColumnIndexFile::create (tab, "SCAN_NUMBER");
+// // Later in another process the index is used to select a scan
+// // without reading the entire column.
+// Table sel = Table("my.ms")(Table("my.ms").col("SCAN_NUMBER") == 10);
+// </srcblock>
+// </example>
+
+// <motivation>
+// Selecting a single scan from a MeasurementSet with 100 million rows
+// should not require a scan of the entire SCAN_NUMBER column.
+// </motivation>
+
+class ColumnIndexFile
+{
+public:
+  // Open the index of the given column.
+  // An exception is thrown if the column has no valid index.
+  ColumnIndexFile (const Table& table, const String& columnName);
+
+  ~ColumnIndexFile();
+
+  // Copying is not possible.
+  // <group>
+  ColumnIndexFile (const ColumnIndexFile&) = delete;
+  ColumnIndexFile& operator= (const ColumnIndexFile&) = delete;
+  // </group>
+
+  // Get the name of the indexed column.
+  const String& columnName() const
+    { return itsColumnName; }
+
+  // Get the number of values in the index.
+  rownr_t nkeys() const
+    { return itsNKeys; }
+
+  // Count the number of rows with a value in one of the given ranges.
+  // The ranges are closed intervals which must be in ascending order
+  // and must not overlap (as given by TableExprRange).
+  rownr_t count (const Vector<Double>& start,
+                 const Vector<Double>& end) const;
+
+  // Get the row numbers (in ascending order) of the rows with a value
+  // in one of the given ranges.
+  Vector<rownr_t> rowNumbers (const Vector<Double>& start,
+                              const Vector<Double>& end) const;
+
+  // Create the index for a column and register it in the table keywords.
+  // An existing index of the column is replaced.
+  // The table must be writable; it is flushed before the index is made.
+  static void create (Table& table, const String& columnName);
+
+  // Remove the index of a column (its file and keyword entry).
+  static void remove (Table& table, const String& columnName);
+
+  // Recreate the indices that have been invalidated.
+  static void update (Table& table);
+
+  // Get the names of the columns having an index (valid or not).
+  // <group>
+  static Vector<String> indexedColumns (const Table& table);
+  static Vector<String> indexedColumns (const TableRecord& keywordSet);
+  // </group>
+
+  // Does the column have a valid index?
+  static Bool isValid (const Table& table, const String& columnName);
+
+  // Invalidate the index of a column by removing its file.
+  // It is used by PlainTable when flushing data.
+  static void invalidate (const String& tableName, const String& columnName);
+
+  // Find the rows that can match a select expression using the ranges
+  // of indexed columns in the expression. False is returned if no
+  // index could be used. It is used by <src>BaseTable::select</src>.
+  static Bool preselect (BaseTable& table, const TableExprNode& node,
+                         Vector<rownr_t>& rownrs);
+
+  // Get the name of the table keyword holding the indexed columns.
+  static const String& keywordName();
+
+private:
+  // Get the name of the index file of a column in the given table.
+  static String fileName (const String& tableName, const String& columnName);
+
+  // Does the column have a valid index (given the table name and nrow)?
+  static Bool isValid (const String& tableName, const String& columnName,
+                       rownr_t nrow);
+
+  // Find the first and last+1 index of the values in a range.
+  void findRange (Double start, Double end,
+                  rownr_t& first, rownr_t& last) const;
+
+  //# Data members
+  String                  itsColumnName;
+  std::unique_ptr<MMapIO> itsFile;
+  rownr_t                 itsNKeys;
+  const Double*           itsKeys;
+  const uInt64*           itsRownrs;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
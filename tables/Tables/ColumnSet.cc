@@ -279,6 +279,7 @@ void ColumnSet::addRow (rownr_t nrrow)
 	}
     }
     nrrow_p += nrrow;
+    setColumnsChanged();
 }
 //# Remove a row from all data managers.
 void ColumnSet::removeRow (rownr_t rownr)
@@ -297,6 +298,15 @@ void ColumnSet::removeRow (rownr_t rownr)
 	BLOCKDATAMANVAL(i)->removeRow64 (rownr);
     }
     nrrow_p--;
+    //# The row numbers of the next rows change.
+    setColumnsChanged();
+}
+
+void ColumnSet::setColumnsChanged (Bool changed)
+{
+    for (uInt i=0; i<colMap_p.size(); i++) {
+        getColumn(i)->setChanged (changed);
+    }
 }
 
 
@@ -803,9 +813,22 @@ Bool ColumnSet::putFile (Bool writeTable, AipsIO& ios,
     if (multiFile_p) {
       multiFile_p->flush();
     }
+    //# All changes are in the data managers' files now.
+    setColumnsChanged (False);
     return written;
 }
 
+Bool ColumnSet::dataManChanged (const String& columnName) const
+{
+    const DataManager* dmPtr = getColumn(columnName)->dataManager();
+    for (uInt i=0; i<dataManChanged_p.size(); i++) {
+        if (BLOCKDATAMANVAL(i) == dmPtr) {
+            return dataManChanged_p[i];
+        }
+    }
+    return False;
+}
+
 
 rownr_t ColumnSet::getFile (AipsIO& ios, Table& tab, rownr_t nrrow, Bool bigEndian,
                             const TSMOption& tsmOption)
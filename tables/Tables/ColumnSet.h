@@ -154,6 +154,11 @@ public:
     // release it when another process needs the lock.
     void autoReleaseLock();
 
+    // Can the locking be used by multiple threads at the same time?
+    // That is the case if no automatic locking is used and if the read lock
+    // does not need to be acquired.
+    Bool canReadConcurrently() const;
+
     // If needed, get a temporary user lock.
     // It returns False if the lock was already there.
     Bool userLock (FileLocker::LockType, Bool wait);
@@ -238,6 +243,14 @@ public:
     // Get the data manager change flags (used by PlainTable).
     std::vector<Bool>& dataManChanged();
 
+    // Has the data manager of the given column written data in the last
+    // putFile (used by PlainTable to invalidate column indices)?
+    Bool dataManChanged (const String& columnName) const;
+
+    // Mark all columns as changed or unchanged since the last flush
+    // (see <src>PlainColumn::isChanged</src>).
+    void setColumnsChanged (Bool changed = True);
+
     // Synchronize the data managers when data in them have changed.
     // It returns the number of rows it think it has, which is needed for
     // storage managers like LofarStMan.
@@ -370,6 +383,12 @@ inline void ColumnSet::autoReleaseLock()
 {
     lockPtr_p->autoRelease();
 }
+inline Bool ColumnSet::canReadConcurrently() const
+{
+    return lockPtr_p->option() != TableLock::AutoLocking
+       &&  (! lockPtr_p->readLocking()
+            ||  lockPtr_p->hasLock (FileLocker::Read));
+}
 inline std::vector<Bool>& ColumnSet::dataManChanged()
 {
     return dataManChanged_p;
@@ -34,7 +34,10 @@
 #include <casacore/casa/Utilities/Sort.h>
 #include <casacore/casa/Utilities/Copy.h>
 #include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Arrays/Slice.h>
 #include <casacore/tables/Tables/TableError.h>
+#include <functional>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -56,6 +59,25 @@ ColumnsIndex::ColumnsIndex (const Table& table,
   create (table, columnNames, compareFunction, noSort);
 }
 
+ColumnsIndex::ColumnsIndex (const Table& table, const String& columnName,
+                            IndexType indexType)
+: itsLowerKeyPtr (0),
+  itsUpperKeyPtr (0)
+{
+  Vector<String> columnNames(1);
+  columnNames(0) = columnName;
+  create (table, columnNames, 0, False, indexType);
+}
+
+ColumnsIndex::ColumnsIndex (const Table& table,
+                            const Vector<String>& columnNames,
+                            IndexType indexType)
+: itsLowerKeyPtr (0),
+  itsUpperKeyPtr (0)
+{
+  create (table, columnNames, 0, False, indexType);
+}
+
 ColumnsIndex::ColumnsIndex (const ColumnsIndex& that)
 : itsLowerKeyPtr (0),
   itsUpperKeyPtr (0)
@@ -82,6 +104,7 @@ void ColumnsIndex::copy (const ColumnsIndex& that)
     itsNrrow   = itsTable.nrow();
     itsNoSort  = that.itsNoSort;
     itsCompare = that.itsCompare;
+    itsIndexType = that.itsIndexType;
     makeObjects (that.itsLowerKeyPtr->description());
   }
 }
@@ -186,12 +209,14 @@ void ColumnsIndex::addColumnToDesc (RecordDesc& description,
 void ColumnsIndex::create (const Table& table,
 			   const Vector<String>& columnNames,
 			   Compare* compareFunction,
-			   Bool noSort)
+			   Bool noSort,
+                           IndexType indexType)
 {
   itsTable = table;
   itsNrrow = itsTable.nrow();
   itsCompare = (compareFunction == 0  ?  compare : compareFunction);
   itsNoSort = noSort;
+  itsIndexType = indexType;
   // Loop through all column names.
   // Always add it to the RecordDesc.
   RecordDesc description;
@@ -200,6 +225,25 @@ void ColumnsIndex::create (const Table& table,
     addColumnToDesc (description,
 		     TableColumn (itsTable, columnNames(i)));
   }
+  // Floating point values cannot be hashed reliably.
+  if (itsIndexType == Hash) {
+    for (uInt i=0; i<nrfields; i++) {
+      switch (description.type(i)) {
+      case TpBool:
+      case TpUChar:
+      case TpShort:
+      case TpInt:
+      case TpUInt:
+      case TpInt64:
+      case TpString:
+        break;
+      default:
+        throw (TableError ("ColumnsIndex: column " + description.name(i) +
+                           " cannot be used in a hash index; its data type"
+                           " should be integer, Bool or String"));
+      }
+    }
+  }
   makeObjects (description);
   readData();
 }
@@ -314,6 +358,10 @@ void ColumnsIndex::makeObjects (const RecordDesc& description)
 
 void ColumnsIndex::readData()
 {
+  if (itsIndexType == Hash) {
+    readHashData();
+    return;
+  }
   // Acquire a lock if needed.
   TableLocker locker(itsTable, FileLocker::Read);
   rownr_t nrrow = itsTable.nrow();
@@ -463,6 +511,282 @@ void ColumnsIndex::readData()
   itsChanged = False;
 }
 
+// Read the values of a column from the given row on and append them.
+template<typename T>
+void* readHashColumn (const Table& table, const String& name, void* vecptr,
+                      rownr_t startRow, rownr_t nrrow)
+{
+  Vector<T>& vec = *static_cast<Vector<T>*>(vecptr);
+  ScalarColumn<T> column(table, name);
+  if (startRow == 0) {
+    column.getColumn (vec, True);
+  } else if (startRow < nrrow) {
+    Vector<T> values = column.getColumnRange
+      (Slicer(IPosition(1, startRow), IPosition(1, nrrow-startRow),
+              Slicer::endIsLength));
+    vec.resize (nrrow, True);
+    vec(Slice(startRow, nrrow-startRow)) = values;
+  }
+  return vec.data();
+}
+
+void ColumnsIndex::readHashData()
+{
+  // Acquire a lock if needed.
+  TableLocker locker(itsTable, FileLocker::Read);
+  rownr_t nrrow = itsTable.nrow();
+  // The index has to be recreated if rows have been removed.
+  if (nrrow < itsNrrow) {
+    setChanged();
+  }
+  if (!itsChanged  &&  nrrow == itsNrrow) {
+    return;
+  }
+  // Only the new rows have to be read if the columns have not changed.
+  rownr_t startRow = (itsChanged  ?  0 : itsNrrow);
+  const RecordDesc& desc = itsLowerKeyPtr->description();
+  uInt nrfield = itsDataTypes.nelements();
+  for (uInt i=0; i<nrfield; i++) {
+    const String& name = desc.name(i);
+    rownr_t readRow = (itsColumnChanged[i]  ?  0 : itsNrrow);
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      itsData[i] = readHashColumn<Bool> (itsTable, name, itsDataVectors[i],
+                                         readRow, nrrow);
+      break;
+    case TpUChar:
+      itsData[i] = readHashColumn<uChar> (itsTable, name, itsDataVectors[i],
+                                          readRow, nrrow);
+      break;
+    case TpShort:
+      itsData[i] = readHashColumn<Short> (itsTable, name, itsDataVectors[i],
+                                          readRow, nrrow);
+      break;
+    case TpInt:
+      itsData[i] = readHashColumn<Int> (itsTable, name, itsDataVectors[i],
+                                        readRow, nrrow);
+      break;
+    case TpUInt:
+      itsData[i] = readHashColumn<uInt> (itsTable, name, itsDataVectors[i],
+                                         readRow, nrrow);
+      break;
+    case TpInt64:
+      itsData[i] = readHashColumn<Int64> (itsTable, name, itsDataVectors[i],
+                                          readRow, nrrow);
+      break;
+    case TpString:
+      itsData[i] = readHashColumn<String> (itsTable, name, itsDataVectors[i],
+                                           readRow, nrrow);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+    itsColumnChanged[i] = False;
+  }
+  if (startRow == 0) {
+    itsHashMap.clear();
+    itsGroupFirst.clear();
+    itsGroupLast.clear();
+    itsGroupSize.clear();
+    itsGroupNext.clear();
+    itsRowNext.clear();
+  }
+  itsNrrow = nrrow;
+  itsChanged = False;
+  addHashRows (startRow, nrrow);
+}
+
+void ColumnsIndex::addHashRows (rownr_t startRow, rownr_t endRow)
+{
+  itsRowNext.resize (endRow, -1);
+  for (rownr_t row=startRow; row<endRow; ++row) {
+    Int64 newGroup = itsGroupFirst.size();
+    std::pair<Int64*,Bool> res = itsHashMap.insert (hashRow(row), newGroup);
+    Int64 group = *res.first;
+    Int64 prevGroup = -1;
+    // Look for the key among the groups with the same hash value.
+    while (group >= 0  &&  group != newGroup  &&
+           !equalRows (itsGroupFirst[group], row)) {
+      prevGroup = group;
+      group = itsGroupNext[group];
+    }
+    if (group < 0  ||  group == newGroup) {
+      // A new key, so add a group and chain it if needed.
+      if (prevGroup >= 0) {
+        itsGroupNext[prevGroup] = newGroup;
+      }
+      itsGroupFirst.push_back (row);
+      itsGroupLast.push_back (row);
+      itsGroupSize.push_back (1);
+      itsGroupNext.push_back (-1);
+    } else {
+      itsRowNext[itsGroupLast[group]] = row;
+      itsGroupLast[group] = row;
+      itsGroupSize[group]++;
+    }
+  }
+}
+
+// Combine the hash value of a key field with the previous ones.
+inline uInt64 combineHash (uInt64 hash, uInt64 fieldHash)
+{
+  return FlatHashMap<uInt64,Int64>::mix (hash ^
+                                         (fieldHash + 0x9e3779b97f4a7c15ULL));
+}
+
+template<typename T>
+inline uInt64 hashKeyField (void* fieldPtr)
+{
+  return std::hash<T>() (*(*static_cast<RecordFieldPtr<T>*>(fieldPtr)));
+}
+
+template<typename T>
+inline uInt64 hashDataField (const void* dataPtr, rownr_t row)
+{
+  return std::hash<T>() (static_cast<const T*>(dataPtr)[row]);
+}
+
+template<typename T>
+inline Bool equalDataField (const void* dataPtr, rownr_t row1, rownr_t row2)
+{
+  const T* data = static_cast<const T*>(dataPtr);
+  return data[row1] == data[row2];
+}
+
+uInt64 ColumnsIndex::hashKey (const Block<void*>& fieldPtrs) const
+{
+  uInt64 hash = 0;
+  uInt nfield = fieldPtrs.nelements();
+  for (uInt i=0; i<nfield; i++) {
+    uInt64 fieldHash = 0;
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      fieldHash = hashKeyField<Bool> (fieldPtrs[i]);
+      break;
+    case TpUChar:
+      fieldHash = hashKeyField<uChar> (fieldPtrs[i]);
+      break;
+    case TpShort:
+      fieldHash = hashKeyField<Short> (fieldPtrs[i]);
+      break;
+    case TpInt:
+      fieldHash = hashKeyField<Int> (fieldPtrs[i]);
+      break;
+    case TpUInt:
+      fieldHash = hashKeyField<uInt> (fieldPtrs[i]);
+      break;
+    case TpInt64:
+      fieldHash = hashKeyField<Int64> (fieldPtrs[i]);
+      break;
+    case TpString:
+      fieldHash = hashKeyField<String> (fieldPtrs[i]);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+    hash = combineHash (hash, fieldHash);
+  }
+  return hash;
+}
+
+uInt64 ColumnsIndex::hashRow (rownr_t row) const
+{
+  uInt64 hash = 0;
+  uInt nfield = itsDataTypes.nelements();
+  for (uInt i=0; i<nfield; i++) {
+    uInt64 fieldHash = 0;
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      fieldHash = hashDataField<Bool> (itsData[i], row);
+      break;
+    case TpUChar:
+      fieldHash = hashDataField<uChar> (itsData[i], row);
+      break;
+    case TpShort:
+      fieldHash = hashDataField<Short> (itsData[i], row);
+      break;
+    case TpInt:
+      fieldHash = hashDataField<Int> (itsData[i], row);
+      break;
+    case TpUInt:
+      fieldHash = hashDataField<uInt> (itsData[i], row);
+      break;
+    case TpInt64:
+      fieldHash = hashDataField<Int64> (itsData[i], row);
+      break;
+    case TpString:
+      fieldHash = hashDataField<String> (itsData[i], row);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+    hash = combineHash (hash, fieldHash);
+  }
+  return hash;
+}
+
+Bool ColumnsIndex::equalRows (rownr_t row1, rownr_t row2) const
+{
+  uInt nfield = itsDataTypes.nelements();
+  for (uInt i=0; i<nfield; i++) {
+    Bool equal = False;
+    switch (itsDataTypes[i]) {
+    case TpBool:
+      equal = equalDataField<Bool> (itsData[i], row1, row2);
+      break;
+    case TpUChar:
+      equal = equalDataField<uChar> (itsData[i], row1, row2);
+      break;
+    case TpShort:
+      equal = equalDataField<Short> (itsData[i], row1, row2);
+      break;
+    case TpInt:
+      equal = equalDataField<Int> (itsData[i], row1, row2);
+      break;
+    case TpUInt:
+      equal = equalDataField<uInt> (itsData[i], row1, row2);
+      break;
+    case TpInt64:
+      equal = equalDataField<Int64> (itsData[i], row1, row2);
+      break;
+    case TpString:
+      equal = equalDataField<String> (itsData[i], row1, row2);
+      break;
+    default:
+      throw (TableError ("ColumnsIndex: unknown data type"));
+    }
+    if (!equal) {
+      return False;
+    }
+  }
+  return True;
+}
+
+Int64 ColumnsIndex::hashFind (const Block<void*>& fieldPtrs) const
+{
+  const Int64* groupPtr = itsHashMap.find (hashKey (fieldPtrs));
+  if (groupPtr) {
+    for (Int64 group=*groupPtr; group>=0; group=itsGroupNext[group]) {
+      if (compare (fieldPtrs, itsData, itsDataTypes,
+                   itsGroupFirst[group]) == 0) {
+        return group;
+      }
+    }
+  }
+  return -1;
+}
+
+void ColumnsIndex::fillHashRowNumbers (Vector<rownr_t>& rows,
+                                       Int64 group) const
+{
+  rows.resize (itsGroupSize[group]);
+  Int64 row = itsGroupFirst[group];
+  for (rownr_t i=0; i<rows.size(); ++i) {
+    rows[i] = row;
+    row = itsRowNext[row];
+  }
+}
+
 rownr_t ColumnsIndex::bsearch (Bool& found, const Block<void*>& fieldPtrs) const
 {
   found = False;
@@ -631,6 +955,16 @@ rownr_t ColumnsIndex::getRowNumber (Bool& found, const Record& key)
 
 rownr_t ColumnsIndex::getRowNumber (Bool& found)
 {
+  if (itsIndexType == Hash) {
+    readData();
+    if (!isUnique()) {
+      throw (TableError ("ColumnsIndex::getRowNumber only possible "
+                         "when the index keys are unique"));
+    }
+    Int64 group = hashFind (itsLowerFields);
+    found = (group >= 0);
+    return (found  ?  itsGroupFirst[group] : 0);
+  }
   if (!isUnique()) {
     throw (TableError ("ColumnsIndex::getRowNumber only possible "
 		       "when the index keys are unique"));
@@ -654,9 +988,16 @@ RowNumbers ColumnsIndex::getRowNumbers()
 {
   // Read the data (if needed).
   readData();
+  RowNumbers rows;
+  if (itsIndexType == Hash) {
+    Int64 group = hashFind (itsLowerFields);
+    if (group >= 0) {
+      fillHashRowNumbers (rows, group);
+    }
+    return rows;
+  }
   Bool found;
   rownr_t inx = bsearch (found, itsLowerFields);
-  RowNumbers rows;
   if (found) {
     fillRowNumbers (rows, inx, inx+1);
   }
@@ -676,6 +1017,10 @@ RowNumbers ColumnsIndex::getRowNumbers (const Record& lowerKey,
 RowNumbers ColumnsIndex::getRowNumbers (Bool lowerInclusive,
                                         Bool upperInclusive)
 {
+  if (itsIndexType == Hash) {
+    throw (TableError ("ColumnsIndex::getRowNumbers cannot look up "
+                       "a key range in a hash index"));
+  }
   // Read the data (if needed).
   readData();
   Bool found;
@@ -33,6 +33,8 @@
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/Containers/FlatHashMap.h>
+#include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -108,6 +110,19 @@ template<typename T> class RecordFieldPtr;
 // <br>If data have changed, the entire index will be recreated by
 // rereading and optionally resorting the data. This will be deferred
 // until the next key lookup.
+// <p>
+// By default the index is sorted, but a hash index can be created
+// by giving <src>ColumnsIndex::Hash</src> as the index type.
+// A hash index finds a key in constant time instead of using a binary
+// search, which makes it much faster when a large index is used for many
+// lookups (e.g. of the antennae of each row in a MeasurementSet).
+// However, it can only be used for exact-match lookups; a key range
+// cannot be looked up. Furthermore, the key columns must have an integer,
+// Bool or String data type and a compare function cannot be used.
+// <br>If rows are added to the table, a hash index only reads the
+// key values of the new rows and adds them to the index, so the index
+// is not recreated. The row numbers of a key are returned in ascending
+// order.
 // </synopsis>
 
 // <example>
@@ -214,6 +229,19 @@ template<typename T> class RecordFieldPtr;
 //     rownr_t rownr = colInx.getRowNumber (found);
 // }
 // </srcblock>
+//
+// The following example uses a hash index to find the rows of
+// a baseline.
+// <srcblock>
+// Table tab("my.ms")
+// ColumnsIndex colInx(tab, stringToVector("ANTENNA1,ANTENNA2"),
+//                     ColumnsIndex::Hash);
+// RecordFieldPtr<Int> ant1(colInx.accessKey(), "ANTENNA1");
+// RecordFieldPtr<Int> ant2(colInx.accessKey(), "ANTENNA2");
+// *ant1 = 3;
+// *ant2 = 7;
+// RowNumbers rows = colInx.getRowNumbers();
+// </srcblock>
 // </example>
 
 // <motivation>
@@ -239,6 +267,15 @@ public:
 			 const Block<Int>& dataTypes,
 			 rownr_t index);
 
+    // Define the kind of index.
+    enum IndexType {
+      // A sorted index using binary search (the default).
+      // It can be used for exact-match and range lookups.
+      Sorted,
+      // A hash index which can only be used for exact-match lookups.
+      Hash
+    };
+
     // Create an index on the given table for the given column.
     // The column has to be a scalar column.
     // If <src>noSort==True</src>, the table is already in order of that
@@ -258,6 +295,16 @@ public:
     ColumnsIndex (const Table&, const Vector<String>& columnNames,
 		  Compare* compareFunction = 0, Bool noSort = False);
 
+    // Create an index of the given type on the given table for the given
+    // column(s). The columns have to be scalar columns.
+    // The default compare function is used.
+    // <group>
+    ColumnsIndex (const Table&, const String& columnName,
+                  IndexType indexType);
+    ColumnsIndex (const Table&, const Vector<String>& columnNames,
+                  IndexType indexType);
+    // </group>
+
     // Copy constructor (copy semantics).
     ColumnsIndex (const ColumnsIndex& that);
 
@@ -269,6 +316,9 @@ public:
     // Are all keys in the index unique?
     Bool isUnique() const;
 
+    // Get the type of the index.
+    IndexType indexType() const;
+
     // Return the names of the columns forming the index.
     Vector<String> columnNames() const;
 
@@ -322,6 +372,7 @@ public:
 
     // Find the row numbers matching the key range. The boolean arguments
     // tell if the lower and upper key are part of the range.
+    // An exception is thrown for a hash index.
     // The 2nd version makes it possible to pass in your own Records
     // instead of using the internal records via the
     // <src>accessLower/UpperKey</src> functions.
@@ -350,7 +401,8 @@ protected:
 
     // Create the various members in the object.
     void create (const Table& table, const Vector<String>& columnNames,
-		 Compare* compareFunction, Bool noSort);
+		 Compare* compareFunction, Bool noSort,
+                 IndexType indexType = Sorted);
 
     // Make the various internal <src>RecordFieldPtr</src> objects.
     void makeObjects (const RecordDesc& description);
@@ -359,6 +411,32 @@ protected:
     // form the index.
     void readData();
 
+    // Read the data of the columns forming a hash index and add them to
+    // the index. Only the new rows are read if rows were added to the
+    // table and the columns have not changed.
+    void readHashData();
+
+    // Add the given rows to the hash index.
+    void addHashRows (rownr_t startRow, rownr_t endRow);
+
+    // Get the hash value of the key in <src>fieldPtrs</src> or of the
+    // key in the given row of the index data.
+    // <group>
+    uInt64 hashKey (const Block<void*>& fieldPtrs) const;
+    uInt64 hashRow (rownr_t row) const;
+    // </group>
+
+    // Do the keys in the given rows of the index data match?
+    Bool equalRows (rownr_t row1, rownr_t row2) const;
+
+    // Find the key in <src>fieldPtrs</src> in the hash index.
+    // It returns the index of the group of rows with that key or
+    // -1 if not found.
+    Int64 hashFind (const Block<void*>& fieldPtrs) const;
+
+    // Fill the row numbers vector with the rows of a group in the hash index.
+    void fillHashRowNumbers (Vector<rownr_t>& rows, Int64 group) const;
+
     // Do a binary search on <src>itsUniqueIndex</src> for the key in
     // <src>fieldPtrs</src>.
     // If the key is found, <src>found</src> is set to True and the index
@@ -410,13 +488,30 @@ private:
     Vector<rownr_t> itsUniqueIndex;
     rownr_t*        itsDataInx;           //# pointer to data in itsDataIndex
     rownr_t*        itsUniqueInx;         //# pointer to data in itsUniqueIndex
+    IndexType       itsIndexType;
+    //# The hash index maps the hash value of a key to a group of rows with
+    //# that key. Groups with the same hash value are chained. The rows in
+    //# a group are chained in ascending order.
+    FlatHashMap<uInt64,Int64> itsHashMap;
+    std::vector<rownr_t> itsGroupFirst;   //# first row of each group
+    std::vector<rownr_t> itsGroupLast;    //# last row of each group
+    std::vector<rownr_t> itsGroupSize;    //# nr of rows in each group
+    std::vector<Int64>   itsGroupNext;    //# next group with same hash value
+    std::vector<Int64>   itsRowNext;      //# next row in the same group
 };
 
 
 inline Bool ColumnsIndex::isUnique() const
 {
+    if (itsIndexType == Hash) {
+      return (itsRowNext.size() == itsGroupFirst.size());
+    }
     return (itsDataIndex.nelements() == itsUniqueIndex.nelements());
 }
+inline ColumnsIndex::IndexType ColumnsIndex::indexType() const
+{
+    return itsIndexType;
+}
 inline const Table& ColumnsIndex::table() const
 {
     return itsTable;
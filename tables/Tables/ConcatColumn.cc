@@ -25,9 +25,15 @@
 
 #include <casacore/tables/Tables/ConcatColumn.h>
 #include <casacore/tables/Tables/ConcatTable.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/casa/Arrays/Vector.h>
 #include <casacore/casa/Arrays/IPosition.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/OMP.h>
 #include <casacore/casa/Utilities/GenSort.h>
+#include <algorithm>
+#include <exception>
+#include <mutex>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -216,116 +222,229 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
   void ConcatColumn::getArrayColumn (ArrayBase& arr) const
   {
-    accessColumn (0, arr, &getColumnPart);
+    accessColumn (0, arr, &getColumnPart, True);
   }
 
   void ConcatColumn::getColumnSlice (const Slicer& ns,
 				     ArrayBase& arr) const
   {
-    accessColumn (&ns, arr, &getColumnSlicePart);
+    accessColumn (&ns, arr, &getColumnSlicePart, True);
   }
 
   void ConcatColumn::getArrayColumnCells (const RefRows& rownrs,
 					  ArrayBase& arr) const
   {
-    accessRows (rownrs, 0, arr, &getRowsPart);
+    accessRows (rownrs, 0, arr, &getRowsPart, True);
   }
 
   void ConcatColumn::getColumnSliceCells (const RefRows& rownrs,
 					  const Slicer& ns,
 					  ArrayBase& arr) const
   {
-    accessRows (rownrs, &ns, arr, &getRowsSlicePart);
+    accessRows (rownrs, &ns, arr, &getRowsSlicePart, True);
   }
 
   void ConcatColumn::putArrayColumn (const ArrayBase& arr)
   {
-    accessColumn (0, const_cast<ArrayBase&>(arr), &putColumnPart);
+    accessColumn (0, const_cast<ArrayBase&>(arr), &putColumnPart, False);
   }
 
   void ConcatColumn::putColumnSlice (const Slicer& ns,
 				     const ArrayBase& arr)
   {
-    accessColumn (&ns, const_cast<ArrayBase&>(arr), &putColumnSlicePart);
+    accessColumn (&ns, const_cast<ArrayBase&>(arr), &putColumnSlicePart,
+                  False);
   }
 
   void ConcatColumn::putArrayColumnCells (const RefRows& rownrs,
 					  const ArrayBase& arr)
   {
-    accessRows (rownrs, 0, const_cast<ArrayBase&>(arr), &putRowsPart);
+    accessRows (rownrs, 0, const_cast<ArrayBase&>(arr), &putRowsPart, False);
   }
 
   void ConcatColumn::putColumnSliceCells (const RefRows& rownrs,
 					  const Slicer& ns,
 					  const ArrayBase& arr)
   {
-    accessRows (rownrs, &ns, const_cast<ArrayBase&>(arr), &putRowsSlicePart);
+    accessRows (rownrs, &ns, const_cast<ArrayBase&>(arr), &putRowsSlicePart,
+                False);
   }
 
   void ConcatColumn::accessColumn (const Slicer* ns,
 				   ArrayBase& arr,
-				   AccessColumnFunc* accessFunc) const
+				   AccessColumnFunc* accessFunc,
+                                   Bool parallel) const
   {
-    IPosition st(arr.ndim(), 0);
-    IPosition sz(arr.shape());
     uInt nlast = arr.ndim() - 1;
-    for (uInt i=0; i<refColPtr_p.size(); ++i) {
-      rownr_t nr = refColPtr_p[i]->nrow();
-      sz[nlast] = nr;
-      std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-      accessFunc (refColPtr_p[i], ns, *part);
-      st[nlast] += nr;
-    }
+    accessParts (columnParts(), parallel,
+                 [&](const RowsPart& part) {
+      IPosition st(arr.ndim(), 0);
+      IPosition sz(arr.shape());
+      st[nlast] = part.start;
+      sz[nlast] = part.nrow;
+      std::unique_ptr<ArrayBase> arrPart (arr.getSection (Slicer(st, sz)));
+      accessFunc (refColPtr_p[part.tableNr], ns, *arrPart);
+    });
   }
 
   void ConcatColumn::accessRows (const RefRows& rownrs,
 				 const Slicer* ns,
 				 ArrayBase& arr,
-				 AccessRowsFunc* accessFunc) const
-  {
-    // The rows to access.
-    Vector<rownr_t> rows = rownrs.convert();
-    // We have one or more slices of rows.
-    // Try to access them also in a sliced way, because that is faster.
-    // First make resources.
-    // The row number mapping.
-    const ConcatRows& ccRows = refTabPtr_p->rows();
-    // The RefRows vector for the rownrs to be handled in an underlying table.
-    // Make it as large as needed to avoid resizes.
-    Vector<rownr_t> tabRowNrs(rows.nelements());
-    // The rows are handled by combining them as much as possible in a RefRows
-    // slice. This is possible until a different underlying table needs to
-    // be accessed.
-    // First setup the various loop variables.
+				 AccessRowsFunc* accessFunc,
+                                 Bool parallel) const
+  {
+    // The rows are handled by combining them as much as possible in a
+    // RefRows object per table. Consecutive rows in the same table are
+    // combined, so the values of each part are contiguous in the array.
     uInt rowAxis = arr.ndim() - 1;   // row axis in array
-    IPosition st(arr.ndim(), 0);     // start of array part
-    IPosition sz(arr.shape());       // size of array part
-    Int lastTabNr = -1;
-    uInt tableNr;
-    // Step through all concat rownrs.
-    for (rownr_t i=0; i<rows.nelements(); ++i) {
-      // Map to the table and rownr in it.
-      ccRows.mapRownr (tableNr, tabRowNrs[i], rows[i]);
-      // An access has to be done if we have another table.
-      if (Int(tableNr) != lastTabNr) {
-	// Access the cells if not the first time.
-	if (lastTabNr >= 0) {
-	  rownr_t nrrow = i - st[rowAxis];
-	  sz[rowAxis] = nrrow;
-	  Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
-	  std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-	  accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns, *part);
-	}
-        st[rowAxis] = i;
-        lastTabNr = tableNr;
+    accessParts (splitRows (rownrs, False), parallel,
+                 [&](const RowsPart& part) {
+      IPosition st(arr.ndim(), 0);
+      IPosition sz(arr.shape());
+      st[rowAxis] = part.start;
+      sz[rowAxis] = part.nrow;
+      std::unique_ptr<ArrayBase> arrPart (arr.getSection (Slicer(st, sz)));
+      accessFunc (refColPtr_p[part.tableNr], part.refRows(), ns, *arrPart);
+    });
+  }
+
+  RefRows ConcatColumn::RowsPart::refRows() const
+  {
+    return RefRows (Vector<rownr_t>(rows), sliced);
+  }
+
+  std::vector<ConcatColumn::RowsPart> ConcatColumn::columnParts() const
+  {
+    const ConcatRows& ccRows = refTabPtr_p->rows();
+    std::vector<RowsPart> parts;
+    parts.reserve (ccRows.ntable());
+    for (uInt i=0; i<ccRows.ntable(); ++i) {
+      rownr_t nr = ccRows[i] - ccRows.offset(i);
+      if (nr > 0) {
+        parts.push_back (RowsPart{i, ccRows.offset(i), nr,
+                                  std::vector<rownr_t>(), True,
+                                  std::vector<rownr_t>()});
+      }
+    }
+    return parts;
+  }
+
+  std::vector<ConcatColumn::RowsPart> ConcatColumn::splitRows
+  (const RefRows& rownrs, Bool group) const
+  {
+    const ConcatRows& ccRows = refTabPtr_p->rows();
+    std::vector<RowsPart> parts;
+    // The index of the part of each table when grouping.
+    std::vector<Int64> tabParts;
+    rownr_t nrout = 0;
+    if (rownrs.isSliced()) {
+      // Split each slice at the table boundaries.
+      // The start row of the next table is found by a binary search.
+      RefRowsSliceIter iter(rownrs);
+      while (! iter.pastEnd()) {
+        rownr_t st   = iter.sliceStart();
+        rownr_t end  = iter.sliceEnd();
+        rownr_t incr = iter.sliceIncr();
+        while (st <= end) {
+          uInt tableNr = ccRows.tableNr (st);
+          rownr_t offset = ccRows.offset (tableNr);
+          rownr_t nr = (std::min(end, ccRows[tableNr] - 1) - st) / incr + 1;
+          if (parts.empty()  ||  parts.back().tableNr != tableNr) {
+            parts.push_back (RowsPart{tableNr, nrout, 0,
+                                      std::vector<rownr_t>(), True,
+                                      std::vector<rownr_t>()});
+          }
+          RowsPart& part = parts.back();
+          part.rows.push_back (st - offset);
+          part.rows.push_back (st - offset + (nr-1)*incr);
+          part.rows.push_back (incr);
+          part.nrow += nr;
+          nrout += nr;
+          st += nr*incr;
+        }
+        iter++;
+      }
+    } else {
+      const Vector<rownr_t>& rows = rownrs.rowVector();
+      if (group) {
+        tabParts.resize (ccRows.ntable(), -1);
+      }
+      uInt tableNr = 0;
+      rownr_t stRow = 1;
+      rownr_t endRow = 0;
+      for (rownr_t i=0; i<rows.size(); ++i) {
+        rownr_t row = rows[i];
+        // Only search the table if the row is in another one.
+        if (row < stRow  ||  row >= endRow) {
+          tableNr = ccRows.tableNr (row);
+          stRow   = ccRows.offset (tableNr);
+          endRow  = ccRows[tableNr];
+        }
+        RowsPart* part;
+        if (group) {
+          if (tabParts[tableNr] < 0) {
+            tabParts[tableNr] = parts.size();
+            parts.push_back (RowsPart{tableNr, i, 0,
+                                      std::vector<rownr_t>(), False,
+                                      std::vector<rownr_t>()});
+          }
+          part = &(parts[tabParts[tableNr]]);
+          part->index.push_back (i);
+        } else {
+          if (parts.empty()  ||  parts.back().tableNr != tableNr) {
+            parts.push_back (RowsPart{tableNr, i, 0,
+                                      std::vector<rownr_t>(), False,
+                                      std::vector<rownr_t>()});
+          }
+          part = &(parts.back());
+        }
+        part->rows.push_back (row - stRow);
+        part->nrow++;
+      }
+      // The index is not needed if the rows of a table are consecutive.
+      for (RowsPart& part : parts) {
+        if (! part.index.empty()  &&
+            part.index.back() - part.index.front() + 1 == part.nrow) {
+          part.index.clear();
+        }
+      }
+    }
+    return parts;
+  }
+
+  void ConcatColumn::accessParts
+  (const std::vector<RowsPart>& parts, Bool parallel,
+   const std::function<void(const RowsPart&)>& func) const
+  {
+    Int npart = parts.size();
+    uInt nthreads = 1;
+    if (parallel  &&  npart > 1  &&  refTabPtr_p->canAccessPartsInParallel()) {
+      // A table cannot be accessed by multiple threads.
+      std::vector<Bool> used(refColPtr_p.size(), False);
+      nthreads = std::min (OMP::maxThreads(), uInt(npart));
+      for (const RowsPart& part : parts) {
+        if (used[part.tableNr]) {
+          nthreads = 1;
+          break;
+        }
+        used[part.tableNr] = True;
+      }
+    }
+    std::exception_ptr error;
+    std::mutex errorMutex;
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1) schedule(dynamic)
+    for (Int i=0; i<npart; ++i) {
+      try {
+        func (parts[i]);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (! error) {
+          error = std::current_exception();
+        }
       }
     }
-    if (lastTabNr >= 0) {
-      rownr_t nrrow = rows.nelements() - st[rowAxis];
-      sz[rowAxis] = nrrow;
-      Vector<rownr_t> rowPart(tabRowNrs(Slice(st[rowAxis], nrrow))); 
-      std::unique_ptr<ArrayBase> part (arr.getSection (Slicer(st, sz)));
-      accessFunc (refColPtr_p[lastTabNr], RefRows(rowPart), ns, *part);
+    if (error) {
+      std::rethrow_exception (error);
     }
   }
 
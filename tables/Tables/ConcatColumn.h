@@ -33,6 +33,7 @@
 #include <casacore/tables/Tables/ColumnCache.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/casa/Arrays/ArrayFwd.h>
+#include <functional>
 #include <vector>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -232,15 +233,17 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
                                  const Slicer*, ArrayBase& array);
 
     // Access the data for an entire column.
+    // The tables are accessed in parallel if possible and if asked for.
     void accessColumn (const Slicer* ns,
 		       ArrayBase& dataPtr,
-		       AccessColumnFunc*) const;
+		       AccessColumnFunc*, Bool parallel) const;
 
     // Access the data with multiple rows combined.
+    // The tables are accessed in parallel if possible and if asked for.
     void accessRows (const RefRows& rownrs,
 		     const Slicer* ns,
 		     ArrayBase& dataPtr,
-		     AccessRowsFunc*) const;
+		     AccessRowsFunc*, Bool parallel) const;
 
     // Define the access functions.
     static void getColumnPart (BaseColumn* col,
@@ -262,6 +265,40 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // </group>
 
   protected:
+    // Description of the rows to access in one of the tables.
+    // The values of the rows are in the overall array from <src>start</src>
+    // on, unless <src>index</src> is filled which gives the position of
+    // each row in the overall array.
+    struct RowsPart {
+      uInt    tableNr;
+      rownr_t start;
+      rownr_t nrow;
+      // The row numbers in the table (start,end,incr triplets if sliced).
+      // All rows of the table are used if empty.
+      std::vector<rownr_t> rows;
+      Bool    sliced;
+      std::vector<rownr_t> index;
+      // Get the rows as a RefRows object.
+      RefRows refRows() const;
+    };
+
+    // Split the given row numbers into the parts to access in the
+    // tables. The table of a row is found by a binary search.
+    // Consecutive rows in the same table form a part.
+    // If <src>group=True</src>, all rows in a table form a single part,
+    // which is needed if the rows are not in table order.
+    std::vector<RowsPart> splitRows (const RefRows& rownrs,
+                                     Bool group) const;
+
+    // Get the parts for all rows in the column (one per table).
+    std::vector<RowsPart> columnParts() const;
+
+    // Execute the function for each part. If <src>parallel=True</src> and
+    // the parts are in different tables that can be accessed in parallel,
+    // multiple threads are used.
+    void accessParts (const std::vector<RowsPart>& parts, Bool parallel,
+                      const std::function<void(const RowsPart&)>& func) const;
+
     // Set the column cache to the cache of the given table.
     // The row numbers will be adjusted as needed.
     void setColumnCache (uInt tableNr, const ColumnCache&) const;
@@ -27,6 +27,7 @@
 #include <casacore/tables/Tables/ConcatRows.h>
 #include <casacore/tables/Tables/TableError.h>
 #include <casacore/casa/Utilities/BinarySearch.h>
+#include <algorithm>
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
 
@@ -40,6 +41,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     itsRows[itsNTable] = itsRows[itsNTable-1] + nrow;
   }
 
+  uInt ConcatRows::tableNr (rownr_t rownr) const
+  {
+    if (rownr >= itsRows[itsNTable]) {
+      throw TableError ("ConcatTable: rownr " + String::toString(rownr) +
+			" past nr of rows (=" +
+			String::toString(itsRows[itsNTable]) + ')');
+    }
+    // Find the last table starting at or before the row; empty tables
+    // before it are skipped that way.
+    return std::upper_bound (itsRows.begin(), itsRows.begin() + itsNTable,
+                             rownr) - itsRows.begin() - 1;
+  }
+
   void ConcatRows::findRownr (rownr_t rownr) const
   {
     if (rownr >= itsRows[itsNTable]) {
@@ -122,6 +122,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       tabRownr = rownr - itsLastStRow;
     }
 
+    // Find the table containing the given overall row number using a
+    // binary search. Unlike <src>mapRownr</src> it does not use the
+    // cached values, so it can be used by multiple threads.
+    uInt tableNr (rownr_t rownr) const;
+
   private:
     // Find the row number and fill in the lastXX_p values.
     void findRownr (rownr_t rownr) const;
@@ -30,7 +30,7 @@
 #include <casacore/tables/Tables/ConcatTable.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/casa/Arrays/Vector.h>
-#include <casacore/casa/Utilities/GenSort.h>
+#include <casacore/tables/Tables/RefRows.h>
 
 
 namespace casacore { //# NAMESPACE CASACORE - BEGIN
@@ -49,13 +49,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::getScalarColumn (ArrayBase& arr) const
   {
     Vector<T>& vec = static_cast<Vector<T>&>(arr);
-    rownr_t st = 0;
-    for (uInt i=0; i<refColPtr_p.size(); ++i) {
-      rownr_t nr = refColPtr_p[i]->nrow();
-      Vector<T> part = vec(Slice(st, nr));
-      refColPtr_p[i]->getScalarColumn (part);
-      st += nr;
-    }
+    // Read the tables in parallel if possible.
+    accessParts (columnParts(), True,
+                 [&](const RowsPart& part) {
+      Vector<T> vecPart = vec(Slice(part.start, part.nrow));
+      refColPtr_p[part.tableNr]->getScalarColumn (vecPart);
+    });
     // Set the column cache to the first table.
     ///setColumnCache (0, refColPtr_p[0]->columnCache());
   }
@@ -65,21 +64,23 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 						    ArrayBase& arr) const
   {
     Vector<T>& vec = static_cast<Vector<T>&>(arr);
-    // Get the rownrs as a vector and sort it.
-    // In this way the data will be read in sequential order.
-    Vector<rownr_t> rows = rownrs.convert();
-    Vector<rownr_t> inx;
-    GenSortIndirect<rownr_t,rownr_t>::sort (inx, rows);
-    const ConcatRows& ccRows = refTabPtr_p->rows();
-    rownr_t tabRownr;
-    uInt    tableNr=0;
-    // Map each row to rownr and tablenr.
-    // Note this is pretty fast because it is done in row order.
-    for (rownr_t i=0; i<inx.nelements(); ++i) {
-      rownr_t row = inx[i];
-      ccRows.mapRownr (tableNr, tabRownr, rows[row]);
-      refColPtr_p[tableNr]->get (tabRownr, &(vec[row]));
-    }
+    // Get the rows per table, so each table is read once (in parallel
+    // if possible). If the rows of a table are not consecutive in the
+    // result, they are read into a temporary vector.
+    accessParts (splitRows (rownrs, True), True,
+                 [&](const RowsPart& part) {
+      BaseColumn* col = refColPtr_p[part.tableNr];
+      if (part.index.empty()) {
+        Vector<T> vecPart = vec(Slice(part.start, part.nrow));
+        col->getScalarColumnCells (part.refRows(), vecPart);
+      } else {
+        Vector<T> vecPart(part.nrow);
+        col->getScalarColumnCells (part.refRows(), vecPart);
+        for (rownr_t i=0; i<part.nrow; ++i) {
+          vec[part.index[i]] = vecPart[i];
+        }
+      }
+    });
     // Set the column cache to the last table used.
     ///setColumnCache (tableNr, refColPtr_p[tableNr]->columnCache());
   }
@@ -88,13 +89,11 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::putScalarColumn (const ArrayBase& arr)
   {
     Vector<T> vec (static_cast<const Vector<T>&>(arr));
-    rownr_t st = 0;
-    for (uInt i=0; i<refColPtr_p.size(); ++i) {
-      rownr_t nr = refColPtr_p[i]->nrow();
-      Vector<T> part = vec(Slice(st, nr));
-      refColPtr_p[i]->putScalarColumn (part);
-      st += nr;
-    }
+    accessParts (columnParts(), False,
+                 [&](const RowsPart& part) {
+      Vector<T> vecPart = vec(Slice(part.start, part.nrow));
+      refColPtr_p[part.tableNr]->putScalarColumn (vecPart);
+    });
     // Set the column cache to the first table.
     ///setColumnCache (0, refColPtr_p[0]->columnCache());
   }
@@ -103,22 +102,22 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
   void ConcatScalarColumn<T>::putScalarColumnCells (const RefRows& rownrs,
 						    const ArrayBase& arr)
   {
-    const Vector<T>& vec = static_cast<const Vector<T>&>(arr);
-    // Get the rownrs as a vector and sort it.
-    // In this way the data will be read in sequential order.
-    Vector<rownr_t> rows = rownrs.convert();
-    Vector<rownr_t> inx;
-    GenSortIndirect<rownr_t,rownr_t>::sort (inx, rows);
-    const ConcatRows& ccRows = refTabPtr_p->rows();
-    rownr_t tabRownr;
-    uInt    tableNr=0;
-    // Map each row to rownr and tablenr.
-    // Note this is pretty fast because it is done in row order.
-    for (rownr_t i=0; i<inx.nelements(); ++i) {
-      rownr_t row = inx[i];
-      ccRows.mapRownr (tableNr, tabRownr, rows[row]);
-      refColPtr_p[tableNr]->put (tabRownr, &(vec[row]));
-    }
+    Vector<T> vec (static_cast<const Vector<T>&>(arr));
+    // Put the rows per table.
+    accessParts (splitRows (rownrs, True), False,
+                 [&](const RowsPart& part) {
+      BaseColumn* col = refColPtr_p[part.tableNr];
+      if (part.index.empty()) {
+        Vector<T> vecPart = vec(Slice(part.start, part.nrow));
+        col->putScalarColumnCells (part.refRows(), vecPart);
+      } else {
+        Vector<T> vecPart(part.nrow);
+        for (rownr_t i=0; i<part.nrow; ++i) {
+          vecPart[i] = vec[part.index[i]];
+        }
+        col->putScalarColumnCells (part.refRows(), vecPart);
+      }
+    });
     // Set the column cache to the last table used.
     ///setColumnCache (tableNr, refColPtr_p[tableNr]->columnCache());
   }
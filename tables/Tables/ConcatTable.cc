@@ -46,7 +46,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 			    int option, const TableLock& lockOptions,
                             const TSMOption& tsmOption)
     : BaseTable (name, option, nrrow),
-      changed_p (False)
+      changed_p (False),
+      parallelParts_p (False)
   {
     //# Read the file in.
     // Set initially to no write in destructor.
@@ -64,7 +65,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
       subTableNames_p (subTables),
       subDirName_p    (subDirName),
       tables_p        (tables),
-      changed_p       (True)
+      changed_p       (True),
+      parallelParts_p (False)
   {
     ///cout<<"cctab1="<<sizeof(*this)<<' '<<this<<' '<<&rows_p<<' '<<&(rows())<<endl;
     noWrite_p = True;
@@ -90,7 +92,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     : BaseTable       ("", Table::Scratch, 0),
       subTableNames_p (subTables),
       subDirName_p    (subDirName),
-      changed_p       (True)
+      changed_p       (True),
+      parallelParts_p (False)
   {
     ///cout<<"cctab1="<<sizeof(*this)<<' '<<this<<' '<<&rows_p<<' '<<&(rows())<<endl;
     noWrite_p = True;
@@ -356,6 +359,19 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     keywordSet_p = tables_p[0].keywordSet();
     // Handle the possible concatenated subtables.
     handleSubTables();
+    // The tables can be accessed in parallel if they are different.
+    // Nested ConcatTables might share tables, so they are not accepted.
+    parallelParts_p = tables_p.size() > 1;
+    for (uInt i=0; i<tables_p.size()  &&  parallelParts_p; ++i) {
+      if (dynamic_cast<ConcatTable*>(tables_p[i].baseTablePtr())) {
+        parallelParts_p = False;
+      }
+      for (uInt j=0; j<i  &&  parallelParts_p; ++j) {
+        if (tables_p[i].isSameRoot (tables_p[j])) {
+          parallelParts_p = False;
+        }
+      }
+    }
     // Create the concatColumns.
     // Do this last, to avoid leaks in case of exceptions above.
     makeConcatCol();
@@ -309,6 +309,12 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     // Get the column objects in the referenced tables.
     Block<BaseColumn*> getRefColumns (const String& columnName);
 
+    // Can different tables be accessed in parallel by multiple threads?
+    // That is the case if they are different tables (thus do not share
+    // a root table) and are not ConcatTables themselves.
+    Bool canAccessPartsInParallel() const
+      { return parallelParts_p; }
+
   private:
     // Show the extra table structure info (names of used tables).
     void showStructureExtra (std::ostream&) const;
@@ -318,7 +324,8 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 		     const TableLock& lockOptions, const TSMOption& tsmOption);
 
     // Initialize.
-    // It checks if the descriptions of all tables are equal.
+    // It checks if the descriptions of all tables are equal and
+    // determines if the tables can be accessed in parallel.
     // It creates the keyword setfor which it concatenates subtables as needed.
     void initialize();
 
@@ -359,6 +366,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
     std::map<String,ConcatColumn*> colMap_p;  //# map name to column
     TableRecord       keywordSet_p;
     Bool              changed_p;           //# True = changed since last write
+    Bool              parallelParts_p;     //# True = parallel access possible
     ConcatRows        rows_p;
   };
 
@@ -42,7 +42,8 @@ PlainColumn::PlainColumn (const BaseColumnDesc* cdp, ColumnSet* csp)
   dataManPtr_p  (0),
   dataColPtr_p  (0),
   colSetPtr_p   (csp),
-  originalName_p(cdp->name())
+  originalName_p(cdp->name()),
+  changed_p     (False)
 {
   int trace = TableTrace::traceColumn (columnDesc());
   rtraceColumn_p = (trace&TableTrace::READ)  != 0;
@@ -93,9 +94,26 @@ Bool PlainColumn::isWritable() const
 Bool PlainColumn::isStored() const
     { return dataManPtr_p->isStorageManager(); }
 
+Bool PlainColumn::canReadConcurrently() const
+{
+    return colSetPtr_p->canReadConcurrently()
+       &&  dataManPtr_p->canReadConcurrently();
+}
+
 ColumnCache& PlainColumn::columnCache()
     { return dataColPtr_p->columnCache(); }
 
+Bool PlainColumn::getZoneMinMax (rownr_t rownr, rownr_t& startRow,
+                                 rownr_t& endRow,
+                                 Double& minVal, Double& maxVal)
+{
+    checkReadLock (True);
+    Bool valid = dataColPtr_p->getZoneMinMax (rownr, startRow, endRow,
+                                              minVal, maxVal);
+    autoReleaseLock();
+    return valid;
+}
+
 void PlainColumn::setMaximumCacheSize (uInt nbytes)
     { dataManPtr_p->setMaximumCacheSize (nbytes); }
 
@@ -95,6 +95,10 @@ public:
     // Test if the column is stored (otherwise it is virtual).
     virtual Bool isStored() const;
 
+    // The column can be read by multiple threads if its data manager
+    // allows it and if the table locking is thread-safe.
+    virtual Bool canReadConcurrently() const;
+
     // Get access to the column keyword set.
     // <group>
     TableRecord& rwKeywordSet();
@@ -123,9 +127,25 @@ public:
     // Get the pointer to the data manager column.
     DataManagerColumn*& dataManagerColumn();
 
+    // Has the column been changed since the table was flushed?
+    // It tells if a persistent index of the column (see class
+    // ColumnIndexFile) can be used.
+    // <group>
+    Bool isChanged() const
+      { return changed_p; }
+    void setChanged (Bool changed)
+      { changed_p = changed; }
+    // </group>
+
     // Get a pointer to the underlying column cache.
     virtual ColumnCache& columnCache();
 
+    // Get the min/max statistics of the zone of rows containing the given
+    // row from the data manager column (after acquiring a read lock).
+    // See <linkto class=DataManagerColumn>DataManagerColumn</linkto>.
+    Bool getZoneMinMax (rownr_t rownr, rownr_t& startRow, rownr_t& endRow,
+                        Double& minVal, Double& maxVal);
+
     // Set the maximum cache size (in bytes) to be used by a storage manager.
     virtual void setMaximumCacheSize (uInt nbytes);
 
@@ -142,6 +162,7 @@ protected:
     String              originalName_p;  //# Column name before any rename
     Bool                rtraceColumn_p;  //# trace reads of the column?
     Bool                wtraceColumn_p;  //# trace writes of the column?
+    mutable Bool        changed_p;       //# changed since last flush?
 
     // Get the trace-id of the table.
     int traceId() const
@@ -169,6 +190,7 @@ protected:
     // Lock the table before reading or writing.
     // If manual or permanent locking is in effect, it checks if
     // the table is locked.
+    // Locking for writing also marks the column as changed.
     // <group>
     void checkReadLock (Bool wait) const;
     void checkWriteLock (Bool wait) const;
@@ -191,7 +213,7 @@ inline void PlainColumn::checkValueLength (const void*) const
 inline void PlainColumn::checkReadLock (Bool wait) const
     { colSetPtr_p->checkReadLock (wait); }
 inline void PlainColumn::checkWriteLock (Bool wait) const
-    { colSetPtr_p->checkWriteLock (wait); }
+    { changed_p = True; colSetPtr_p->checkWriteLock (wait); }
 inline void PlainColumn::autoReleaseLock() const
     { colSetPtr_p->autoReleaseLock(); }
 
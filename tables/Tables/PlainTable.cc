@@ -31,6 +31,7 @@
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableLockData.h>
 #include <casacore/tables/Tables/ColumnSet.h>
+#include <casacore/tables/Tables/ColumnIndexFile.h>
 #include <casacore/tables/Tables/TableTrace.h>
 #include <casacore/tables/Tables/PlainColumn.h>
 #include <casacore/tables/Tables/TableError.h>
@@ -576,6 +577,7 @@ Bool PlainTable::putFile (Bool always)
     }
     // Write the change info if anything has been written.
     if (written) {
+        invalidateColumnIndices();
         lockSync_p.write (nrrow_p, tdescPtr_p->ncolumn(), tableChanged_p,
 			  colSetPtr_p->dataManChanged());
 	lockPtr_p->putInfo (lockSync_p.memoryIO());
@@ -587,6 +589,18 @@ Bool PlainTable::putFile (Bool always)
     return writeTab;
 }
 
+void PlainTable::invalidateColumnIndices()
+{
+    Vector<String> names =
+        ColumnIndexFile::indexedColumns (tdescPtr_p->keywordSet());
+    for (const String& name : names) {
+        if (! tdescPtr_p->isColumn (name)
+        ||  colSetPtr_p->dataManChanged (name)) {
+            ColumnIndexFile::invalidate (tableName(), name);
+        }
+    }
+}
+
 MemoryIO* PlainTable::releaseCallBack (void* plainTableObject, Bool always)
 {
     return (*(PlainTable*)plainTableObject).doReleaseCallBack (always);
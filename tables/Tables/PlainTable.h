@@ -293,6 +293,10 @@ private:
     // been written.
     Bool putFile (Bool always);
 
+    // Invalidate the persistent indices of the columns whose data manager
+    // has written data (see class ColumnIndexFile).
+    void invalidateColumnIndices();
+
     // Synchronize the table after having acquired a lock which says
     // that main table data has changed.
     // It check if the columns did not change.
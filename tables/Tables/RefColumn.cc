@@ -93,6 +93,9 @@ Bool RefColumn::isDefined (rownr_t rownr) const
 Bool RefColumn::canChangeShape() const
     { return colPtr_p->canChangeShape(); }
 
+Bool RefColumn::canReadConcurrently() const
+    { return colPtr_p->canReadConcurrently(); }
+
 
 void RefColumn::get (rownr_t rownr, void* dataPtr) const
     { colPtr_p->get (refTabPtr_p->rootRownr(rownr), dataPtr); }
@@ -114,16 +117,16 @@ void RefColumn::putSlice (rownr_t rownr, const Slicer& ns, const ArrayBase& data
 
 void RefColumn::getScalarColumn (ArrayBase& data) const
 {
-    colPtr_p->getScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->getScalarColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::getArrayColumn (ArrayBase& data) const
 {
-    colPtr_p->getArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->getArrayColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::getColumnSlice (const Slicer& ns,
 				ArrayBase& data) const
 {
-    colPtr_p->getColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    colPtr_p->getColumnSliceCells (refTabPtr_p->refRows(), ns, data); 
 }
 void RefColumn::getScalarColumnCells (const RefRows& rownrs,
 				      ArrayBase& data) const
@@ -137,6 +140,17 @@ void RefColumn::getArrayColumnCells (const RefRows& rownrs,
     colPtr_p->getArrayColumnCells (rownrs.convert(refTabPtr_p->rowNumbers()),
 				   data);
 }
+const void* RefColumn::getArrayColumnPtr (rownr_t startRow,
+                                         rownr_t nrow) const
+{
+    rownr_t rootRow = refTabPtr_p->rootRownr (startRow);
+    for (rownr_t i=1; i<nrow; i++) {
+        if (refTabPtr_p->rootRownr (startRow+i) != rootRow+i) {
+            return 0;
+        }
+    }
+    return colPtr_p->getArrayColumnPtr (rootRow, nrow);
+}
 void RefColumn::getColumnSliceCells (const RefRows& rownrs,
 				     const Slicer& ns,
 				     ArrayBase& data) const
@@ -146,16 +160,16 @@ void RefColumn::getColumnSliceCells (const RefRows& rownrs,
 }
 void RefColumn::putScalarColumn (const ArrayBase& data)
 {
-    colPtr_p->putScalarColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putScalarColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::putArrayColumn (const ArrayBase& data)
 {
-    colPtr_p->putArrayColumnCells (refTabPtr_p->rowNumbers(), data);
+    colPtr_p->putArrayColumnCells (refTabPtr_p->refRows(), data);
 }
 void RefColumn::putColumnSlice (const Slicer& ns,
 				const ArrayBase& data)
 {
-    colPtr_p->putColumnSliceCells (refTabPtr_p->rowNumbers(), ns, data); 
+    colPtr_p->putColumnSliceCells (refTabPtr_p->refRows(), ns, data); 
 }
 void RefColumn::putScalarColumnCells (const RefRows& rownrs,
 				      const ArrayBase& data)
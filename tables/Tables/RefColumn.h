@@ -138,6 +138,9 @@ public:
     // It can change shape if the underlying column can.
     virtual Bool canChangeShape() const;
 
+    // It can be read concurrently if the underlying column can.
+    virtual Bool canReadConcurrently() const;
+
     // Initialize the rows from startRownr till endRownr (inclusive)
     // with the default value defined in the column description (if defined).
     void initialize (rownr_t startRownr, rownr_t endRownr);
@@ -175,6 +178,11 @@ public:
     virtual void getArrayColumnCells (const RefRows& rownrs,
 				      ArrayBase& dataPtr) const;
 
+    // Get a pointer to the array values in the given consecutive rows.
+    // It is only possible if these rows are consecutive in the parent.
+    virtual const void* getArrayColumnPtr (rownr_t startRow,
+                                           rownr_t nrow) const;
+
     // Get subsections from some arrays in the column.
     // If the column contains n-dim arrays, the resulting array is (n+1)-dim.
     // The arrays in the column have to have the same shape in all cells.
@@ -55,67 +55,91 @@ void RefRows::init (const Vector<rownr_t>& rowNumbers, Bool isSliced,
 	itsNrows = 0;
     } else if (collapse) {
 	//# Try to turn individual row numbers into slices.
-	//# Stop doing that when the number of elements in the
-	//# resulting array would exceed the input length, because
-	//# in that case we gain not anything at all.
-	Vector<rownr_t> rows(itsNrows+3);
-	rownr_t start = 0;
-	rownr_t end = 0;
-	rownr_t incr = 0;
-	rownr_t nv = 0;
-	rownr_t nr = 0;
-	for (rownr_t i=0; i<itsNrows  &&  nr<itsNrows; i++) {
-	    rownr_t value = rowNumbers(i);
-	    if (nv == 0) {
+	//# First count the number of values needed, so the result array
+	//# is only created if it is smaller than the input.
+	rownr_t nr = collapseRows (rowNumbers, 0);
+	if (nr > 0) {
+	    Vector<rownr_t> rows(nr);
+	    collapseRows (rowNumbers, rows.data());
+	    itsRows.reference (rows);
+	    itsSliced = True;
+	}
+    }
+}
+
+rownr_t RefRows::collapseRows (const Vector<rownr_t>& rowNumbers,
+                               rownr_t* rows)
+{
+    //# Stop when the number of elements in the resulting array would
+    //# exceed the input length, because in that case we gain not anything.
+    //# The values are only stored if an output array is given.
+    rownr_t nrows = rowNumbers.nelements();
+    rownr_t start = 0;
+    rownr_t end = 0;
+    rownr_t incr = 0;
+    rownr_t nv = 0;
+    rownr_t nr = 0;
+    auto put = [&nr, rows] (rownr_t value)
+      { if (rows) rows[nr] = value; nr++; };
+    for (rownr_t i=0; i<nrows  &&  nr<nrows; i++) {
+	rownr_t value = rowNumbers(i);
+	if (nv == 0) {
+	    start = value;
+	    nv++;
+	} else if (nv == 1) {
+	    if (value <= start) {
+		put (start);
+		put (start);
+		put (1);
 		start = value;
-		nv++;
-	    } else if (nv == 1) {
-		if (value <= start) {
-		    rows(nr++) = start;
-		    rows(nr++) = start;
-		    rows(nr++) = 1;
-		    start = value;
-		} else {
-		    end = value;
-		    incr = end - start;
-		    nv++;
-		}
-	    } else if (value-end == incr) {
+	    } else {
 		end = value;
+		incr = end - start;
 		nv++;
+	    }
+	} else if (value > end  &&  value-end == incr) {
+	    end = value;
+	    nv++;
+	} else {
+	    put (start);
+	    if (nv > 2) {
+		put (end);
+		put (incr);
+		start = value;
+		nv = 1;
 	    } else {
-		rows(nr++) = start;
-		if (nv > 2) {
-		    rows(nr++) = end;
-		    rows(nr++) = incr;
-		    start = value;
-		    nv = 1;
-		} else {
-		    rows(nr++) = start;
-		    rows(nr++) = 1;
+		put (start);
+		put (1);
+		//# Only start a new slice if the rows are ascending.
+		//# Otherwise the increment would wrap around or be zero.
+		if (value > end) {
 		    start = end;
 		    end = value;
 		    incr = end - start;
-		    nv = 2;
+		} else {
+		    put (end);
+		    put (end);
+		    put (1);
+		    start = value;
+		    nv = 1;
 		}
 	    }
 	}
-	// Great, our result is smaller than the input. So use the result
-	// after filling in the last slice.
-	if (nr < itsNrows) {
-	    rows(nr++) = start;
-	    if (nv == 1) {
-		rows(nr++) = start;
-		rows(nr++) = 1;
-	    } else {
-		rows(nr++) = end;
-		rows(nr++) = incr;
-	    }
-	    rows.resize (nr, True);
-	    itsRows.reference (rows);
-	    itsSliced = True;
-	}
     }
+    if (nr >= nrows) {
+	return 0;
+    }
+    // Great, our result is smaller than the input.
+    // So fill in the last slice.
+    put (start);
+    if (nv == 1) {
+	put (start);
+	put (1);
+    } else {
+	put (end);
+	put (incr);
+    }
+    return nr;
 }
 
 RefRows::RefRows (rownr_t start, rownr_t end, rownr_t incr)
@@ -151,6 +151,13 @@ private:
     void init (const Vector<rownr_t>& rowNumbers, Bool isSliced,
                Bool collapse);
 
+    // Collapse the row numbers to slices (start,end,incr).
+    // It returns the number of values needed for the slices or 0 if
+    // collapsing does not result in fewer values.
+    // The values are stored in <src>rows</src> if not a null pointer.
+    static rownr_t collapseRows (const Vector<rownr_t>& rowNumbers,
+                                 rownr_t* rows);
+
     // Fill the itsNrows variable.
     rownr_t fillNrows() const;
 
@@ -25,6 +25,7 @@
 
 #include <casacore/tables/Tables/RefTable.h>
 #include <casacore/tables/Tables/RefColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/TableDesc.h>
 #include <casacore/tables/Tables/TableLock.h>
@@ -737,6 +738,12 @@ Vector<rownr_t> RefTable::rowNumbers() const
 }
 
 
+RefRows RefTable::refRows() const
+{
+    return RefRows (rowNumbers(), False, True);
+}
+
+
 Bool RefTable::checkAddColumn (const String& name, Bool addToParent)
 {
   if (! isWritable()) {
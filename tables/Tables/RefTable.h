@@ -39,6 +39,7 @@ namespace casacore { //# NAMESPACE CASACORE - BEGIN
 //# Forward Declarations
 class TSMOption;
 class RefColumn;
+class RefRows;
 class AipsIO;
 
 
@@ -73,6 +74,10 @@ class AipsIO;
 // while (if needed) converting the given row number to the row number
 // in the referenced table. For that purpose RefTable maintains a
 // Vector of the row numbers in the referenced table.
+// When getting or putting an entire column, runs of row numbers are
+// passed as slices to the referenced column (see <src>refRows</src>).
+// The Vector itself is always kept in full, also for a contiguous
+// selection.
 //
 // The RefTable constructor acts in a way that it will always reference
 // the original table. This means that if a select is done on a RefTable,
@@ -89,6 +94,10 @@ class AipsIO;
 //   <li> Maybe not allocating the row number vector for a projection.
 //          This saves space and time, but each rownr conversion will
 //          take a bit more time because it has to test if there is a vector.
+//   <li> Maybe keep the row numbers in a run-length or bitmap form
+//          to reduce the memory of a large selection. It requires a
+//          change of <src>rowStorage</src>, which hands out the Vector
+//          for sorting, iteration and the set operations.
 //   <li> Maybe maintain a Vector<String> telling on which columns
 //          the table is ordered. This may speed up selection, but
 //          it is hard to check if the order is changed by a put.
@@ -295,6 +304,13 @@ public:
     // Get a vector of row numbers.
     virtual Vector<rownr_t> rowNumbers() const;
 
+    // Get the row numbers as a RefRows object in which runs of row numbers
+    // are collapsed to slices (if that results in fewer values).
+    // It is used to read or write an entire column, so data managers
+    // can access a run of rows as a range instead of row by row.
+    // It is made on each call, so no extra memory is kept in the table.
+    RefRows refRows() const;
+
     // Get parent of this table.
     virtual BaseTable* root();
 
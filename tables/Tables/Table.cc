@@ -44,6 +44,8 @@
 #include <casacore/casa/Arrays/Slice.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Containers/Record.h>
+#include <casacore/casa/System/AipsrcValue.h>
+#include <atomic>
 #include <vector>
 #include <casacore/casa/IO/AipsIO.h>
 #include <casacore/casa/OS/File.h>
@@ -778,6 +780,26 @@ TableExprNode Table::nodeRandom() const
 Table Table::operator() (const TableExprNode& expr,
                          rownr_t maxRow, rownr_t offset) const
     { return Table (baseTabPtr_p->select (expr, maxRow, offset)); }
+
+//# The number of threads to use for a selection (-1 is not set yet).
+static std::atomic<Int> theSelectNThreads(-1);
+
+void Table::setSelectNThreads (uInt nthreads)
+{
+    theSelectNThreads = nthreads;
+}
+uInt Table::getSelectNThreads()
+{
+    Int nthreads = theSelectNThreads;
+    if (nthreads < 0) {
+        uInt nthr;
+        AipsrcValue<uInt>::find (nthr, "table.select.nthreads", 1);
+        nthreads = nthr;
+        theSelectNThreads = nthreads;
+    }
+    return nthreads;
+}
+
 //# Select rows based on row numbers.
 Table Table::operator() (const RowNumbers& rownrs) const
     { return Table (baseTabPtr_p->select (rownrs)); }
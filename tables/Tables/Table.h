@@ -794,6 +794,24 @@ public:
     // the <src>maxRow/offset</src> arguments are taken into account.
     Table operator() (const TableExprNode&, rownr_t maxRow=0, rownr_t offset=0) const;
 
+    // Set or get the number of threads used to evaluate a select expression
+    // (by the function above, thus also by a TaQL WHERE clause).
+    // The value 0 means that as many threads as cores are used.
+    // The default is 1 or the value of the aipsrc variable
+    // <src>table.select.nthreads</src>.
+    // <br>Multiple threads are only used if all columns in the expression
+    // can be read concurrently (see
+    // <linkto class=TableColumn>TableColumn::canReadConcurrently</linkto>)
+    // and if the expression does not contain user defined, aggregate,
+    // or random functions or columns in a join table.
+    // The result is the same as when using a single thread.
+    // <br>The same number of threads is used by TaQL's GROUPBY and
+    // aggregate functions if all aggregate results can be merged.
+    // <group>
+    static void setSelectNThreads (uInt nthreads);
+    static uInt getSelectNThreads();
+    // </group>
+
     // Select rows using a vector of row numbers.
     // This can, for instance, be used to select the same rows as
     // were selected in another table (using the rowNumbers function).
@@ -201,6 +201,13 @@ public:
     Bool canChangeShape() const
         { return canChangeShape_p; }
 
+    // Can the column be read by multiple threads at the same time?
+    // That is only possible for storage managers in a concurrent read mode
+    // (e.g. StandardStMan and IncrementalStMan) and if the table does not
+    // use automatic locking.
+    Bool canReadConcurrently() const
+        { return baseColPtr_p->canReadConcurrently(); }
+
     // Get the global #dimensions of an array (ie. for all cells in column).
     // This is always set for fixed shape arrays.
     // Otherwise, 0 will be returned.
@@ -26,6 +26,7 @@
 
 //# Includes
 #include <casacore/tables/Tables/TableCopy.h>
+#include <casacore/tables/Tables/TableCopyEngine.h>
 #include <casacore/tables/Tables/SetupNewTab.h>
 #include <casacore/tables/Tables/TableRow.h>
 #include <casacore/tables/Tables/TableDesc.h>
@@ -112,12 +113,9 @@ void TableCopy::copyRows (Table& out, const Table& in, rownr_t startout,
     if (startout + nrrow > out.nrow()) {
       out.addRow (startout + nrrow - out.nrow());
     }
-    ROTableRow inrow(in, cols);
-    outrow = TableRow(out, cols);
-    for (rownr_t i=0; i<nrrow; i++) {
-      inrow.get (startin + i);
-      outrow.put (startout + i, inrow.record(), inrow.getDefined(), False);
-    }
+    // Copy the rows in chunks.
+    TableCopyEngine engine(out, in, cols);
+    engine.copy (startout, startin, nrrow);
     if (flush) {
       out.flush();
     }
@@ -113,6 +113,9 @@ public:
   // column with the same name in table <src>in</src>. In principle only
   // stored columns will be filled; however if the output table has only
   // one column, it can also be a virtual one.
+  // <br>The rows are copied in chunks using a
+  // <linkto class=TableCopyEngine>TableCopyEngine</linkto>, which reads
+  // the next chunk while the previous one is written.
   // <group>
   static void copyRows (Table& out, const Table& in, Bool flush=True)
     { copyRows (out, in, 0, 0, in.nrow(), flush); }
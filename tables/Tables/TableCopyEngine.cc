@@ -0,0 +1,537 @@
+//# TableCopyEngine.cc: Copy rows of a table in chunks using a pipeline
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+//# Includes
+#include <casacore/tables/Tables/TableCopyEngine.h>
+#include <casacore/tables/Tables/TableRow.h>
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/TableLock.h>
+#include <casacore/tables/DataMan/DataManager.h>
+#include <casacore/casa/Arrays/Array.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/OS/OMP.h>
+#include <casacore/casa/BasicSL/Complex.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+// The values of a column in a chunk of rows.
+class TableCopyBuffer
+{
+public:
+  virtual ~TableCopyBuffer()
+  {}
+};
+
+// A chunk of rows read from the input table.
+class TableCopyChunk
+{
+public:
+  explicit TableCopyChunk (rownr_t nrow, uInt ncol)
+    : nrow_p    (nrow),
+      buffers_p (ncol)
+  {}
+  rownr_t                                       nrow_p;
+  std::vector<std::unique_ptr<TableCopyBuffer>> buffers_p;
+};
+
+// Copy the values of a column in chunks.
+class TableCopyColumn
+{
+public:
+  virtual ~TableCopyColumn()
+  {}
+  // Get the approximate number of bytes in a cell.
+  virtual uInt64 cellSize (rownr_t row) const = 0;
+  // Read the values in the given rows.
+  virtual TableCopyBuffer* read (rownr_t startin, rownr_t nrow) = 0;
+  // Write the values into the given rows and return the number of bytes.
+  virtual uInt64 write (const TableCopyBuffer&, rownr_t startout,
+                        rownr_t nrow) = 0;
+protected:
+  static Slicer rowRange (rownr_t start, rownr_t nrow)
+    { return Slicer (IPosition(1, start), IPosition(1, nrow),
+                     Slicer::endIsLength); }
+};
+
+template<typename T>
+class TableCopyScalar : public TableCopyColumn
+{
+public:
+  struct Buffer : public TableCopyBuffer
+  {
+    Vector<T> values;
+  };
+  TableCopyScalar (const Table& out, const Table& in, const String& name)
+    : out_p (out, name),
+      in_p  (in, name)
+  {}
+  virtual uInt64 cellSize (rownr_t) const
+    { return sizeof(T); }
+  virtual TableCopyBuffer* read (rownr_t startin, rownr_t nrow)
+  {
+    std::unique_ptr<Buffer> buf(new Buffer);
+    in_p.getColumnRange (rowRange(startin, nrow), buf->values);
+    return buf.release();
+  }
+  virtual uInt64 write (const TableCopyBuffer& buf, rownr_t startout,
+                        rownr_t nrow)
+  {
+    const Buffer& sbuf = static_cast<const Buffer&>(buf);
+    out_p.putColumnRange (rowRange(startout, nrow), sbuf.values);
+    return nrow * sizeof(T);
+  }
+private:
+  ScalarColumn<T> out_p;
+  ScalarColumn<T> in_p;
+};
+
+template<typename T>
+class TableCopyArray : public TableCopyColumn
+{
+public:
+  // The arrays are read as a single array if they all have the same shape.
+  // Otherwise they are read one by one.
+  struct Buffer : public TableCopyBuffer
+  {
+    Array<T>              block;
+    std::vector<Array<T>> cells;
+    std::vector<Bool>     defined;
+  };
+  TableCopyArray (const Table& out, const Table& in, const String& name)
+    : out_p (out, name),
+      in_p  (in, name)
+  {}
+  virtual uInt64 cellSize (rownr_t row) const
+  {
+    if (in_p.isDefined (row)) {
+      return in_p.shape(row).product() * sizeof(T);
+    }
+    return sizeof(T);
+  }
+  virtual TableCopyBuffer* read (rownr_t startin, rownr_t nrow)
+  {
+    std::unique_ptr<Buffer> buf(new Buffer);
+    if (sameShape (startin, nrow)) {
+      in_p.getColumnRange (rowRange(startin, nrow), buf->block);
+    } else {
+      buf->cells.resize (nrow);
+      buf->defined.resize (nrow);
+      for (rownr_t i=0; i<nrow; ++i) {
+        buf->defined[i] = in_p.isDefined (startin+i);
+        if (buf->defined[i]) {
+          in_p.get (startin+i, buf->cells[i]);
+        }
+      }
+    }
+    return buf.release();
+  }
+  virtual uInt64 write (const TableCopyBuffer& buf, rownr_t startout,
+                        rownr_t nrow)
+  {
+    const Buffer& abuf = static_cast<const Buffer&>(buf);
+    if (abuf.defined.empty()) {
+      out_p.putColumnRange (rowRange(startout, nrow), abuf.block);
+      return abuf.block.size() * sizeof(T);
+    }
+    uInt64 nbytes = 0;
+    for (rownr_t i=0; i<nrow; ++i) {
+      // Like TableRow, an undefined cell is not written.
+      if (abuf.defined[i]) {
+        out_p.put (startout+i, abuf.cells[i]);
+        nbytes += abuf.cells[i].size() * sizeof(T);
+      }
+    }
+    return nbytes;
+  }
+private:
+  // Are all cells defined with the same non-empty shape?
+  Bool sameShape (rownr_t startin, rownr_t nrow) const
+  {
+    if (! in_p.isDefined (startin)) {
+      return False;
+    }
+    IPosition shape = in_p.shape (startin);
+    if (shape.product() == 0) {
+      return False;
+    }
+    for (rownr_t i=1; i<nrow; ++i) {
+      if (! in_p.isDefined (startin+i)
+      ||  ! in_p.shape(startin+i).isEqual (shape)) {
+        return False;
+      }
+    }
+    return True;
+  }
+  ArrayColumn<T> out_p;
+  ArrayColumn<T> in_p;
+};
+
+// Make the object to copy a column in chunks.
+// A null pointer is returned if the column cannot be copied that way.
+template<typename T>
+TableCopyColumn* makeTableCopyColumn (const Table& out, const Table& in,
+                                      const String& name, Bool isScalar)
+{
+  if (isScalar) {
+    return new TableCopyScalar<T> (out, in, name);
+  }
+  return new TableCopyArray<T> (out, in, name);
+}
+
+TableCopyColumn* makeTableCopyColumn (const Table& out, const Table& in,
+                                      const String& name)
+{
+  const ColumnDesc& outDesc = out.tableDesc()[name];
+  const ColumnDesc& inDesc  = in.tableDesc()[name];
+  if (outDesc.dataType() != inDesc.dataType()
+  ||  outDesc.isScalar() != inDesc.isScalar()
+  ||  outDesc.isArray()  != inDesc.isArray()) {
+    return 0;
+  }
+  Bool isScalar = inDesc.isScalar();
+  switch (inDesc.dataType()) {
+  case TpBool:
+    return makeTableCopyColumn<Bool> (out, in, name, isScalar);
+  case TpUChar:
+    return makeTableCopyColumn<uChar> (out, in, name, isScalar);
+  case TpShort:
+    return makeTableCopyColumn<Short> (out, in, name, isScalar);
+  case TpUShort:
+    return makeTableCopyColumn<uShort> (out, in, name, isScalar);
+  case TpInt:
+    return makeTableCopyColumn<Int> (out, in, name, isScalar);
+  case TpUInt:
+    return makeTableCopyColumn<uInt> (out, in, name, isScalar);
+  case TpInt64:
+    return makeTableCopyColumn<Int64> (out, in, name, isScalar);
+  case TpFloat:
+    return makeTableCopyColumn<Float> (out, in, name, isScalar);
+  case TpDouble:
+    return makeTableCopyColumn<Double> (out, in, name, isScalar);
+  case TpComplex:
+    return makeTableCopyColumn<Complex> (out, in, name, isScalar);
+  case TpDComplex:
+    return makeTableCopyColumn<DComplex> (out, in, name, isScalar);
+  case TpString:
+    return makeTableCopyColumn<String> (out, in, name, isScalar);
+  default:
+    return 0;
+  }
+}
+
+// Can the columns in different data managers be accessed in parallel?
+// That cannot be done if the table lock can be released automatically.
+Bool canAccessInParallel (const Table& tab)
+{
+  switch (tab.lockOptions().option()) {
+  case TableLock::PermanentLocking:
+  case TableLock::PermanentLockingWait:
+  case TableLock::UserLocking:
+  case TableLock::UserNoReadLocking:
+  case TableLock::NoLocking:
+    return True;
+  default:
+    return False;
+  }
+}
+
+// Process the columns in the groups, possibly in parallel, followed by
+// the serial columns.
+template<typename Func>
+void processGroups (const std::vector<std::vector<uInt>>& groups,
+                    const std::vector<uInt>& serial, uInt nthreads,
+                    Func func)
+{
+  Int ngroup = groups.size();
+  std::exception_ptr error;
+  std::mutex errorMutex;
+#pragma omp parallel for num_threads(nthreads) if (nthreads > 1  &&  ngroup > 1) schedule(dynamic)
+  for (Int i=0; i<ngroup; ++i) {
+    try {
+      for (uInt col : groups[i]) {
+        func (col);
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (! error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  if (error) {
+    std::rethrow_exception (error);
+  }
+  for (uInt col : serial) {
+    func (col);
+  }
+}
+
+
+TableCopyEngine::TableCopyEngine (Table& out, const Table& in,
+                                  const Vector<String>& columns)
+: out_p          (out),
+  in_p           (in),
+  chunkSize_p    (16*1024*1024),
+  queueSize_p    (2),
+  nthreads_p     (0),
+  stageThreads_p (1),
+  chunkRows_p    (0),
+  nbytes_p       (0),
+  pipelined_p    (False)
+{
+  std::vector<String> bulkNames;
+  std::vector<String> rowNames;
+  // Rows copied within the same table might overlap, so they have to be
+  // copied row by row as before.
+  Bool sameRoot = out_p.isSameRoot (in_p);
+  for (const String& name : columns) {
+    TableCopyColumn* col = 0;
+    if (! sameRoot) {
+      col = makeTableCopyColumn (out_p, in_p, name);
+    }
+    if (col) {
+      columns_p.emplace_back (col);
+      bulkNames.push_back (name);
+    } else {
+      rowNames.push_back (name);
+    }
+  }
+  bulkNames_p = Vector<String>(bulkNames);
+  rowNames_p  = Vector<String>(rowNames);
+  makeGroups (in_p, readGroups_p, readSerial_p);
+  makeGroups (out_p, writeGroups_p, writeSerial_p);
+}
+
+TableCopyEngine::~TableCopyEngine()
+{}
+
+void TableCopyEngine::setChunkSize (uInt64 nbytes)
+{
+  chunkSize_p = std::max (nbytes, uInt64(1));
+}
+
+void TableCopyEngine::setQueueSize (uInt nchunk)
+{
+  queueSize_p = std::max (nchunk, 1u);
+}
+
+void TableCopyEngine::setNThreads (uInt nthreads)
+{
+  nthreads_p = nthreads;
+}
+
+void TableCopyEngine::makeGroups (const Table& tab,
+                                  std::vector<std::vector<uInt>>& groups,
+                                  std::vector<uInt>& serial) const
+{
+  // Virtual columns might use other columns, so they cannot be handled
+  // in parallel.
+  std::map<const DataManager*, uInt> groupMap;
+  for (uInt i=0; i<bulkNames_p.size(); ++i) {
+    const DataManager* dm = tab.findDataManager (bulkNames_p[i], True);
+    if (dm->isStorageManager()) {
+      auto iter = groupMap.find (dm);
+      if (iter == groupMap.end()) {
+        groupMap[dm] = groups.size();
+        groups.push_back (std::vector<uInt>(1, i));
+      } else {
+        groups[iter->second].push_back (i);
+      }
+    } else {
+      serial.push_back (i);
+    }
+  }
+}
+
+rownr_t TableCopyEngine::calcChunkRows (rownr_t startin, rownr_t nrrow) const
+{
+  uInt64 rowSize = 0;
+  for (const auto& col : columns_p) {
+    rowSize += col->cellSize (startin);
+  }
+  rownr_t nrow = chunkSize_p / std::max (rowSize, uInt64(1));
+  return std::max (rownr_t(1), std::min (nrow, nrrow));
+}
+
+void TableCopyEngine::readChunk (TableCopyChunk& chunk, rownr_t startin)
+{
+  uInt nthreads = canAccessInParallel(in_p)  ?  stageThreads_p : 1;
+  processGroups (readGroups_p, readSerial_p, nthreads,
+                 [&] (uInt col)
+                 {
+                   chunk.buffers_p[col].reset
+                     (columns_p[col]->read (startin, chunk.nrow_p));
+                 });
+}
+
+void TableCopyEngine::writeChunk (const TableCopyChunk& chunk,
+                                  rownr_t startout)
+{
+  uInt nthreads = canAccessInParallel(out_p)  ?  stageThreads_p : 1;
+  std::vector<uInt64> nbytes(columns_p.size(), 0);
+  processGroups (writeGroups_p, writeSerial_p, nthreads,
+                 [&] (uInt col)
+                 {
+                   nbytes[col] = columns_p[col]->write
+                     (*chunk.buffers_p[col], startout, chunk.nrow_p);
+                 });
+  for (uInt64 nb : nbytes) {
+    nbytes_p += nb;
+  }
+}
+
+void TableCopyEngine::copy (rownr_t startout, rownr_t startin, rownr_t nrrow)
+{
+  nbytes_p    = 0;
+  chunkRows_p = 0;
+  pipelined_p = False;
+  if (nrrow == 0) {
+    return;
+  }
+  if (! columns_p.empty()) {
+    uInt nthreads = nthreads_p;
+    if (nthreads == 0) {
+      nthreads = std::max (OMP::maxThreads(), 2u);
+    }
+    chunkRows_p = calcChunkRows (startin, nrrow);
+    pipelined_p = nthreads > 1  &&  chunkRows_p < nrrow;
+    if (pipelined_p) {
+      // Each stage gets half of the threads.
+      stageThreads_p = std::max (nthreads/2, 1u);
+      copyPipelined (startout, startin, nrrow);
+    } else {
+      stageThreads_p = nthreads;
+      copySerial (startout, startin, nrrow);
+    }
+  }
+  copyRowWise (startout, startin, nrrow);
+}
+
+void TableCopyEngine::copySerial (rownr_t startout, rownr_t startin,
+                                  rownr_t nrrow)
+{
+  for (rownr_t done=0; done<nrrow; done+=chunkRows_p) {
+    TableCopyChunk chunk (std::min (chunkRows_p, nrrow-done),
+                          columns_p.size());
+    readChunk (chunk, startin+done);
+    writeChunk (chunk, startout+done);
+  }
+}
+
+void TableCopyEngine::copyPipelined (rownr_t startout, rownr_t startin,
+                                     rownr_t nrrow)
+{
+  std::mutex mutex;
+  std::condition_variable cond;
+  std::deque<std::unique_ptr<TableCopyChunk>> queue;
+  Bool stop = False;
+  Bool finished = False;
+  std::exception_ptr readError;
+  // The reader thread puts the chunks in the queue; it waits while the
+  // queue is full.
+  std::thread reader ([&] ()
+  {
+    try {
+      for (rownr_t done=0; done<nrrow; done+=chunkRows_p) {
+        std::unique_ptr<TableCopyChunk> chunk
+          (new TableCopyChunk (std::min (chunkRows_p, nrrow-done),
+                               columns_p.size()));
+        readChunk (*chunk, startin+done);
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait (lock, [&] { return stop  ||  queue.size() < queueSize_p; });
+        if (stop) {
+          break;
+        }
+        queue.push_back (std::move(chunk));
+        cond.notify_all();
+      }
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex);
+      readError = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = True;
+    cond.notify_all();
+  });
+  // Write the chunks in the order they are read.
+  try {
+    rownr_t rownr = startout;
+    while (True) {
+      std::unique_ptr<TableCopyChunk> chunk;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cond.wait (lock, [&] { return finished  ||  !queue.empty(); });
+        if (queue.empty()) {
+          break;
+        }
+        chunk = std::move (queue.front());
+        queue.pop_front();
+        cond.notify_all();
+      }
+      writeChunk (*chunk, rownr);
+      rownr += chunk->nrow_p;
+    }
+  } catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = True;
+      cond.notify_all();
+    }
+    reader.join();
+    throw;
+  }
+  reader.join();
+  if (readError) {
+    std::rethrow_exception (readError);
+  }
+}
+
+void TableCopyEngine::copyRowWise (rownr_t startout, rownr_t startin,
+                                   rownr_t nrrow)
+{
+  if (rowNames_p.empty()) {
+    return;
+  }
+  ROTableRow inrow(in_p, rowNames_p);
+  TableRow outrow(out_p, rowNames_p);
+  for (rownr_t i=0; i<nrrow; i++) {
+    inrow.get (startin + i);
+    outrow.put (startout + i, inrow.record(), inrow.getDefined(), False);
+  }
+}
+
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,203 @@
+//# TableCopyEngine.h: Copy rows of a table in chunks using a pipeline
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLECOPYENGINE_H
+#define TABLES_TABLECOPYENGINE_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <casacore/casa/BasicSL/String.h>
+#include <memory>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class TableCopyColumn;
+class TableCopyChunk;
+
+
+// <summary>
+// Copy rows of a table in chunks using a pipeline
+// </summary>
+
+// <use visibility=export>
+
+// <reviewed reviewer="" date="" tests="tTableCopyEngine">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=TableCopy>TableCopy</linkto>
+// </prerequisite>
+
+// <synopsis>
+// TableCopyEngine copies the values of columns in one table to the columns
+// with the same name in another table. It is used by
+// <src>TableCopy::copyRows</src>, thus also by <src>Table::deepCopy</src>.
+// <p>
+// The rows are copied in chunks. The size of a chunk is determined by
+// the number of bytes in a row, such that a chunk holds about
+// <src>chunkSize</src> bytes. For each column the values in a chunk are
+// read with <src>getColumnRange</src> and written with
+// <src>putColumnRange</src>, which is much faster than copying
+// cell by cell for most storage managers.
+// Array columns are read cell by cell for a chunk in which the arrays do
+// not have the same shape or are not all defined.
+// Columns that cannot be copied in bulk (e.g. record columns or columns
+// whose data types differ) are copied row by row after the other columns.
+// All columns are copied row by row if both tables share the same root
+// table, because the input and output rows might overlap.
+// <p>
+// The copy is pipelined if more than one thread can be used and the
+// rows do not fit in a single chunk. A separate thread reads
+// the chunks from the input table and passes them via a bounded queue
+// to the calling thread writing them into the output table. So reading
+// and writing are done at the same time.
+// Furthermore, if more than two threads can be used (using OpenMP),
+// the columns in different storage managers are read or written in
+// parallel. That is only done if the table does not use AutoLocking,
+// because acquiring and releasing the table lock is not thread-safe.
+// Columns in the same storage manager and virtual columns are always
+// handled sequentially.
+// </synopsis>
+
+// <motivation>
+// Copying large tables (e.g. splitting a MeasurementSet) was done row by
+// row and column by column, thus alternately reading and writing.
+// </motivation>
+
+// <example>
+// <srcblock>
+//  Table in("my.ms");
+//  Table out = TableCopy::makeEmptyTable ("new.ms", Record(), in,
+//                                         Table::New, Table::AipsrcEndian);
+//  TableCopyEngine engine(out, in, out.tableDesc().columnNames());
+//  engine.setChunkSize (64*1024*1024);
+//  engine.copy (0, 0, in.nrow());
+// </srcblock>
+// </example>
+
+class TableCopyEngine
+{
+public:
+  // Set up the copy of the given columns. They must exist in both tables.
+  TableCopyEngine (Table& out, const Table& in, const Vector<String>& columns);
+
+  ~TableCopyEngine();
+
+  // Copy constructor and assignment cannot be used.
+  // <group>
+  TableCopyEngine (const TableCopyEngine&) = delete;
+  TableCopyEngine& operator= (const TableCopyEngine&) = delete;
+  // </group>
+
+  // Set the approximate number of bytes in a chunk of rows
+  // (default 16 MiB).
+  void setChunkSize (uInt64 nbytes);
+
+  // Set the maximum number of chunks waiting to be written (default 2).
+  void setQueueSize (uInt nchunk);
+
+  // Set the number of threads to use. 1 means that the copy is not
+  // pipelined. 0 (the default) means at least 2 and at most
+  // OMP::maxThreads().
+  void setNThreads (uInt nthreads);
+
+  // Copy <src>nrrow</src> rows starting at row <src>startin</src> in the
+  // input table to the rows starting at <src>startout</src> in the
+  // output table. The output table must contain sufficient rows.
+  void copy (rownr_t startout, rownr_t startin, rownr_t nrrow);
+
+  // Get the names of the columns copied in chunks.
+  const Vector<String>& bulkColumns() const
+    { return bulkNames_p; }
+
+  // Get the names of the columns copied row by row.
+  const Vector<String>& rowColumns() const
+    { return rowNames_p; }
+
+  // Get the number of rows per chunk in the last copy.
+  rownr_t chunkRows() const
+    { return chunkRows_p; }
+
+  // Get the (approximate) number of bytes copied by the last copy.
+  uInt64 nbytes() const
+    { return nbytes_p; }
+
+  // Was the last copy pipelined?
+  Bool isPipelined() const
+    { return pipelined_p; }
+
+private:
+  // Group the columns by data manager. Groups can be handled in parallel.
+  // Virtual columns are put in the serial vector.
+  void makeGroups (const Table& tab,
+                   std::vector<std::vector<uInt>>& groups,
+                   std::vector<uInt>& serial) const;
+
+  // Determine the number of rows per chunk.
+  rownr_t calcChunkRows (rownr_t startin, rownr_t nrrow) const;
+
+  // Read a chunk of rows from the input table.
+  void readChunk (TableCopyChunk& chunk, rownr_t startin);
+
+  // Write a chunk of rows into the output table.
+  void writeChunk (const TableCopyChunk& chunk, rownr_t startout);
+
+  // Copy the chunks without pipelining.
+  void copySerial (rownr_t startout, rownr_t startin, rownr_t nrrow);
+
+  // Copy the chunks using a reader thread.
+  void copyPipelined (rownr_t startout, rownr_t startin, rownr_t nrrow);
+
+  // Copy the row-wise columns.
+  void copyRowWise (rownr_t startout, rownr_t startin, rownr_t nrrow);
+
+  //# Data members
+  Table                                         out_p;
+  Table                                         in_p;
+  std::vector<std::unique_ptr<TableCopyColumn>> columns_p;
+  Vector<String>                                bulkNames_p;
+  Vector<String>                                rowNames_p;
+  std::vector<std::vector<uInt>>                readGroups_p;
+  std::vector<uInt>                             readSerial_p;
+  std::vector<std::vector<uInt>>                writeGroups_p;
+  std::vector<uInt>                             writeSerial_p;
+  uInt64                                        chunkSize_p;
+  uInt                                          queueSize_p;
+  uInt                                          nthreads_p;
+  uInt                                          stageThreads_p;
+  rownr_t                                       chunkRows_p;
+  uInt64                                        nbytes_p;
+  Bool                                          pipelined_p;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
@@ -142,6 +142,11 @@ const String& TableIterator::keyChangeAtLastNext() const
   return tabIterPtr_p->keyChangeAtLastNext(); 
 }
 
+Bool TableIterator::sortedWhileIterating() const
+{
+  return tabIterPtr_p->sortedWhileIterating();
+}
+
 
 } //# NAMESPACE CASACORE - END
 
@@ -74,6 +74,14 @@ template<class T> class Block;
 //
 // The table is sorted before doing the iteration unless TableIterator::NoSort
 // is given.
+// <br>Sorting a large table takes time and memory before the first iteration
+// step can be returned. If the table is usually in iteration order already
+// (e.g., a MeasurementSet written in TIME order), the option
+// TableIterator::SortIfNeeded can be given. In that case the groups are
+// formed while iterating and each group is returned immediately, while it
+// is checked that the key values are in the requested order. Only if an
+// out-of-order key value is found, the remaining rows are sorted and the
+// iteration continues on those.
 // </synopsis> 
 
 // <example>
@@ -123,7 +131,9 @@ public:
                  HeapSort = Sort::HeapSort,
                  InsSort  = Sort::InsSort,
                  ParSort  = Sort::ParSort,
-                 NoSort   = 64};
+                 RadixSort= Sort::RadixSort,
+                 NoSort   = 64,
+                 SortIfNeeded = 128};
 
     // Create a null TableIterator object (i.e. no iterator is attached yet).
     // The sole purpose of this constructor is to allow construction
@@ -149,9 +159,19 @@ public:
     // sorting algorithms. Usually ParSort is the fastest, but for
     // a single core machine QuickSort usually performs better.
     // InsSort (insertion sort) should only be used if the input
-    // is almost in order.
+    // is almost in order. RadixSort is usually the fastest if all
+    // columns have a numeric data type and no compare objects are given.
     // If it is known that the table is already in order, the sort step can be
     // bypassed by giving the option TableIterator::NoSort.
+    // If the table is probably in order, the option TableIterator::SortIfNeeded
+    // can be given to avoid an upfront sort. The order is checked while
+    // iterating. If an out-of-order key is found, the rows not iterated yet
+    // are sorted (using ParSort) and the iteration continues on them.
+    // Note that in such a case a key value can occur in two iteration steps
+    // (once before and once after the sort); function
+    // <src>sortedWhileIterating</src> tells if it happened. After a reset
+    // the entire table is sorted.
+    // Iteration boundaries are never cached for this option.
     // The default option is ParSort.
     // <group>
     TableIterator (const Table&, const String& columnName,
@@ -216,6 +236,10 @@ public:
     // Report Name of slowest column that changes at end of current iteration
     const String& keyChangeAtLastNext() const;
 
+    // Tell if option SortIfNeeded was used and the table turned out to be
+    // out of order, thus if the remaining rows had to be sorted.
+    Bool sortedWhileIterating() const;
+
     // Get the current group.
     Table table() const;
 
@@ -0,0 +1,114 @@
+//# TableZoneFilter.cc: Skip zones of rows not matching a select expression
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableZoneFilter.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/PlainTable.h>
+#include <casacore/tables/Tables/PlainColumn.h>
+#include <casacore/tables/Tables/ColumnDesc.h>
+#include <casacore/tables/Tables/TableColumn.h>
+#include <casacore/tables/TaQL/ExprNode.h>
+#include <casacore/tables/TaQL/ExprRange.h>
+#include <algorithm>
+
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+TableZoneFilter::TableZoneFilter (BaseTable& table, const TableExprNode& node)
+{
+  // Only the columns of a plain table have data managers.
+  PlainTable* ptab = dynamic_cast<PlainTable*>(&table);
+  if (ptab == 0  ||  ptab->nrow() == 0) {
+    return;
+  }
+  std::vector<TableExprRange> ranges;
+  TableExprNode(node).ranges (ranges);
+  for (const TableExprRange& range : ranges) {
+    // The column has to be a scalar column in this table.
+    const TableColumn& col = range.getColumn();
+    Table colTab = col.table();
+    if (! colTab.isRootTable()  ||  colTab.tableName() != ptab->tableName()
+    ||  ! col.columnDesc().isScalar()) {
+      continue;
+    }
+    ColumnRanges colRanges;
+    colRanges.column = dynamic_cast<PlainColumn*>
+      (ptab->getColumn (col.columnDesc().name()));
+    if (colRanges.column == 0) {
+      continue;
+    }
+    colRanges.start.reference (range.start());
+    colRanges.end.reference (range.end());
+    // Get the first zone to find out if the data manager has statistics.
+    if (getZone (colRanges, 0)) {
+      itsColumns.push_back (colRanges);
+    }
+  }
+}
+
+Bool TableZoneFilter::canMatch (rownr_t rownr, rownr_t& nextRow)
+{
+  Bool match = True;
+  nextRow = rownr;
+  for (std::vector<ColumnRanges>::iterator iter = itsColumns.begin();
+       iter != itsColumns.end();) {
+    if (rownr < iter->zoneStart  ||  rownr > iter->zoneEnd) {
+      if (! getZone (*iter, rownr)) {
+        // Statistics are not available anymore (e.g. concurrent reading).
+        iter = itsColumns.erase (iter);
+        continue;
+      }
+    }
+    if (! iter->match) {
+      // Skip as many rows as possible.
+      match = False;
+      nextRow = std::max (nextRow, iter->zoneEnd + 1);
+    }
+    ++iter;
+  }
+  return match;
+}
+
+Bool TableZoneFilter::getZone (ColumnRanges& col, rownr_t rownr)
+{
+  Double minVal, maxVal;
+  if (! col.column->getZoneMinMax (rownr, col.zoneStart, col.zoneEnd,
+                                   minVal, maxVal)) {
+    return False;
+  }
+  // The zone can match if its [min,max] overlaps one of the ranges.
+  // Note that minVal > maxVal if the zone only contains NaN values,
+  // which cannot match either.
+  col.match = False;
+  for (uInt i=0; i<col.start.size(); ++i) {
+    if (col.start[i] <= maxVal  &&  col.end[i] >= minVal) {
+      col.match = True;
+      break;
+    }
+  }
+  return True;
+}
+
+} //# NAMESPACE CASACORE - END
@@ -0,0 +1,122 @@
+//# TableZoneFilter.h: Skip zones of rows not matching a select expression
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This library is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU Library General Public License as published by
+//# the Free Software Foundation; either version 2 of the License, or (at your
+//# option) any later version.
+//#
+//# This library is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Library General Public
+//# License for more details.
+//#
+//# You should have received a copy of the GNU Library General Public License
+//# along with this library; if not, write to the Free Software Foundation,
+//# Inc., 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#ifndef TABLES_TABLEZONEFILTER_H
+#define TABLES_TABLEZONEFILTER_H
+
+
+//# Includes
+#include <casacore/casa/aips.h>
+#include <casacore/casa/Arrays/Vector.h>
+#include <vector>
+
+namespace casacore { //# NAMESPACE CASACORE - BEGIN
+
+//# Forward Declarations
+class BaseTable;
+class PlainColumn;
+class TableExprNode;
+
+// <summary>
+// Skip zones of rows not matching a select expression.
+// </summary>
+
+// <use visibility=local>
+
+// <reviewed reviewer="" date="" tests="tTableZoneFilter.cc" demos="">
+// </reviewed>
+
+// <prerequisite>
+//   <li> <linkto class=TableExprRange>TableExprRange</linkto>
+//   <li> <linkto class=DataManagerColumn>DataManagerColumn</linkto>
+// </prerequisite>
+
+// <synopsis>
+// Storage managers like StandardStMan and IncrementalStMan can tell
+// the minimum and maximum value of a numeric scalar column in a zone of
+// rows (a bucket) by means of function
+// <src>DataManagerColumn::getZoneMinMax</src>.
+// A TableZoneFilter combines these statistics with the column ranges
+// found by <src>TableExprNode::ranges</src> for a select expression.
+// If the [min,max] interval of a zone does not overlap any of the ranges
+// of a column, no row in the zone can match the expression, so the
+// expression does not need to be evaluated for those rows.
+// <br>It is used by <src>BaseTable::select</src> (thus by a TaQL WHERE
+// clause) for columns in a plain table. Columns for which the data
+// manager has no statistics are ignored.
+// </synopsis>
+
+// <motivation>
+// Selecting a time range in a time-ordered MeasurementSet should not
+// require the evaluation of the expression for every row.
+// </motivation>
+
+class TableZoneFilter
+{
+public:
+  // Set up the filter for the given select expression on the table.
+  // The filter is not active if the table is not a plain table or if
+  // the expression has no usable column ranges.
+  TableZoneFilter (BaseTable& table, const TableExprNode& node);
+
+  // Copying is not possible.
+  // <group>
+  TableZoneFilter (const TableZoneFilter&) = delete;
+  TableZoneFilter& operator= (const TableZoneFilter&) = delete;
+  // </group>
+
+  // Is the filter active, thus can it skip rows?
+  Bool isActive() const
+    { return ! itsColumns.empty(); }
+
+  // Can the given row match the expression?
+  // If not, <src>nextRow</src> is set to the first row after the zone(s)
+  // that cannot match.
+  Bool canMatch (rownr_t rownr, rownr_t& nextRow);
+
+private:
+  // The ranges of a column and the statistics of its current zone.
+  struct ColumnRanges {
+    PlainColumn*   column;
+    Vector<Double> start;
+    Vector<Double> end;
+    rownr_t        zoneStart;
+    rownr_t        zoneEnd;
+    Bool           match;
+  };
+
+  // Get the statistics of the zone containing the row and determine
+  // if the ranges overlap them.
+  // False is returned if the column has no statistics.
+  static Bool getZone (ColumnRanges& col, rownr_t rownr);
+
+  //# Data members
+  std::vector<ColumnRanges> itsColumns;
+};
+
+
+} //# NAMESPACE CASACORE - END
+
+#endif
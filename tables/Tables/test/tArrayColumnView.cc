@@ -0,0 +1,185 @@
+//# tArrayColumnView.cc: Test program for views on array columns
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables/TableDesc.h>
+#include <casacore/tables/Tables/SetupNewTab.h>
+#include <casacore/tables/Tables/Table.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
+#include <casacore/tables/Tables/RefRows.h>
+#include <casacore/tables/DataMan/TiledColumnStMan.h>
+#include <casacore/tables/DataMan/MemoryStMan.h>
+#include <casacore/casa/Arrays/Matrix.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <casacore/casa/Exceptions/Error.h>
+#include <casacore/casa/iostream.h>
+
+#include <casacore/casa/namespace.h>
+// <summary>
+// Test program for getting views on the data in an array column.
+// </summary>
+
+const uInt nrow = 30;
+const IPosition arrayShape(2, 4, 5);
+
+Matrix<Float> makeArray (uInt row)
+{
+  Matrix<Float> arr(arrayShape);
+  indgen (arr, Float(row*100));
+  return arr;
+}
+
+// Create a table using the given data manager.
+Table writeTable (const String& name, const DataManager& dm)
+{
+  TableDesc td;
+  td.addColumn (ArrayColumnDesc<Float> ("Data", arrayShape,
+                                        ColumnDesc::FixedShape));
+  SetupNewTable newtab(name, td, Table::New);
+  newtab.bindAll (dm);
+  Table table(newtab, nrow);
+  ArrayColumn<Float> data (table, "Data");
+  for (uInt row=0; row<nrow; ++row) {
+    data.put (row, makeArray(row));
+  }
+  return table;
+}
+
+// Check the data in a view.
+void checkView (const ArrayColumnView<Float>& view, uInt startRow, uInt nr,
+                Bool isReference)
+{
+  AlwaysAssertExit (view.isReference() == isReference);
+  IPosition shp(arrayShape);
+  shp.append (IPosition(1, nr));
+  AlwaysAssertExit (view.array().shape().isEqual (shp));
+  for (uInt i=0; i<nr; ++i) {
+    Array<Float> cell = view.array()[i];
+    AlwaysAssertExit (allEQ (cell, makeArray(startRow+i)));
+  }
+}
+
+void checkColumn (const ArrayColumn<Float>& data, Bool isReference)
+{
+  // A single row.
+  ArrayColumnView<Float> view = data.getView (3);
+  AlwaysAssertExit (view.isReference() == isReference);
+  AlwaysAssertExit (allEQ (view.array(), makeArray(3)));
+  // A range of rows spanning several tiles.
+  checkView (data.getColumnRangeView (Slicer(IPosition(1,5),
+                                             IPosition(1,20),
+                                             Slicer::endIsLength)),
+             5, 20, isReference);
+  checkView (data.getColumnCellsView (RefRows(2, 17)), 2, 16, isReference);
+  Vector<rownr_t> rows(3);
+  indgen (rows, rownr_t(7));
+  checkView (data.getColumnCellsView (RefRows(rows)), 7, 3, isReference);
+  // Non-contiguous rows are always copied.
+  view = data.getColumnRangeView (Slicer(IPosition(1,0), IPosition(1,10),
+                                         IPosition(1,2), Slicer::endIsLength));
+  AlwaysAssertExit (!view.isReference());
+  AlwaysAssertExit (allEQ (view.array()[4], makeArray(8)));
+}
+
+void checkTiled()
+{
+  // The tiles span entire cells, so a view is possible if memory-mapped.
+  writeTable ("tArrayColumnView_tmp.data",
+              TiledColumnStMan ("TSM", IPosition(3,4,5,8)));
+  {
+    Table table("tArrayColumnView_tmp.data", Table::Old, TSMOption::MMap);
+    ArrayColumn<Float> data (table, "Data");
+    checkColumn (data, True);
+    // A view on a reference table is possible for contiguous rows.
+    Vector<rownr_t> rows(10);
+    indgen (rows, rownr_t(10));
+    Table sel = table(rows);
+    ArrayColumn<Float> seldata (sel, "Data");
+    checkView (seldata.getColumnRangeView (Slicer(IPosition(1,2),
+                                                  IPosition(1,5),
+                                                  Slicer::endIsLength)),
+               12, 5, True);
+    rows[5] = 25;
+    Table sel2 = table(rows);
+    ArrayColumn<Float> seldata2 (sel2, "Data");
+    checkView (seldata2.getColumnRangeView (Slicer(IPosition(1,2),
+                                                   IPosition(1,3),
+                                                   Slicer::endIsLength)),
+               12, 3, True);
+    AlwaysAssertExit (!seldata2.getColumnCellsView(RefRows(4,5)).isReference());
+  }
+  {
+    // The view keeps the table alive.
+    ArrayColumnView<Float> view;
+    {
+      Table table("tArrayColumnView_tmp.data", Table::Old, TSMOption::MMap);
+      view = ArrayColumn<Float>(table, "Data").getView (29);
+    }
+    AlwaysAssertExit (view.isReference());
+    AlwaysAssertExit (allEQ (view.array(), makeArray(29)));
+  }
+  {
+    // The cached TSM always copies.
+    Table table("tArrayColumnView_tmp.data", Table::Old, TSMOption::Cache);
+    ArrayColumn<Float> data (table, "Data");
+    checkColumn (data, False);
+  }
+  cout << "checked TiledColumnStMan" << endl;
+  // Tiles not spanning entire cells cannot be used for a view.
+  writeTable ("tArrayColumnView_tmp.data",
+              TiledColumnStMan ("TSM", IPosition(3,4,3,8)));
+  {
+    Table table("tArrayColumnView_tmp.data", Table::Old, TSMOption::MMap);
+    ArrayColumn<Float> data (table, "Data");
+    checkColumn (data, False);
+  }
+  cout << "checked TiledColumnStMan with partial tiles" << endl;
+}
+
+void checkMemory()
+{
+  Table table = writeTable ("tArrayColumnView_tmp.data", MemoryStMan ("MSM"));
+  ArrayColumn<Float> data (table, "Data");
+  // Only a single cell can be referenced.
+  AlwaysAssertExit (data.getView(3).isReference());
+  checkView (data.getColumnCellsView (RefRows(6,6)), 6, 1, True);
+  checkView (data.getColumnCellsView (RefRows(2,17)), 2, 16, False);
+  cout << "checked MemoryStMan" << endl;
+}
+
+int main()
+{
+  try {
+    checkTiled();
+    checkMemory();
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;                           // exit with success status
+}
@@ -0,0 +1,263 @@
+//# tColumnIndexFile.cc: Test program for class ColumnIndexFile
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/Tables/ColumnIndexFile.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+#include <cmath>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for class ColumnIndexFile and its use in table selection.
+// </summary>
+
+const rownr_t nrow = 1000;
+const String tabName("tColumnIndexFile_tmp.tab");
+
+// SCAN is stored in the ISM, TIME and FLAG in the SSM.
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("FLAG"));
+  td.addColumn (ScalarColumnDesc<String> ("NAME"));
+  td.addColumn (ArrayColumnDesc<Int>     ("ARR"));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm;
+  IncrementalStMan ism;
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("SCAN", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Bool>   flagCol(tab, "FLAG");
+  for (rownr_t i=0; i<nrow; ++i) {
+    scanCol.put (i, i/100);
+    // The times are not in order; every 10th time is NaN.
+    timeCol.put (i, (i%10 == 5  ?  NAN : Double((i*37)%nrow)));
+    flagCol.put (i, i%3 == 0);
+  }
+}
+
+// Check if the selection using an index matches the selection
+// using an expression which cannot use an index.
+void checkSelect (const Table& tab, const TableExprNode& node,
+                  const TableExprNode& nodeNoIndex)
+{
+  Table sel1 = tab(node);
+  Table sel2 = tab(nodeNoIndex);
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(), sel2.rowNumbers()));
+  cout << sel1.nrow() << ' ';
+}
+
+void checkTaql (const String& where)
+{
+  Table sel = tableCommand ("select from " + tabName + " where " +
+                            where).table();
+  cout << sel.nrow() << " rows for " << where << endl;
+}
+
+// Check if a TaQL selection using an index gives the same rows as the
+// selection using an expression which cannot use an index.
+void checkTaql (const String& where, const String& whereNoIndex)
+{
+  Table sel1 = tableCommand ("select from " + tabName + " where " +
+                             where).table();
+  Table sel2 = tableCommand ("select from " + tabName + " where " +
+                             whereNoIndex).table();
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(), sel2.rowNumbers()));
+  cout << sel1.nrow() << " rows for " << where << endl;
+}
+
+void testCreate()
+{
+  Table tab(tabName, Table::Update);
+  AlwaysAssertExit (ColumnIndexFile::indexedColumns(tab).empty());
+  ColumnIndexFile::create (tab, "SCAN");
+  ColumnIndexFile::create (tab, "TIME");
+  cout << "indexed columns " << ColumnIndexFile::indexedColumns(tab) << endl;
+  AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+  AlwaysAssertExit (ColumnIndexFile::isValid (tab, "TIME"));
+  AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "FLAG"));
+  // Only numeric scalar columns can be indexed.
+  try {
+    ColumnIndexFile::create (tab, "NAME");
+  } catch (const TableError& x) {
+    cout << x.what() << endl;
+  }
+  try {
+    ColumnIndexFile::create (tab, "ARR");
+  } catch (const TableError& x) {
+    cout << x.what() << endl;
+  }
+  try {
+    Table sel = tab(tab.col("SCAN") < 3);
+    ColumnIndexFile::create (sel, "SCAN");
+  } catch (const TableError& x) {
+    cout << x.what() << endl;
+  }
+}
+
+void testLookup()
+{
+  Table tab(tabName);
+  ColumnIndexFile scanIndex(tab, "SCAN");
+  ColumnIndexFile timeIndex(tab, "TIME");
+  AlwaysAssertExit (scanIndex.nkeys() == nrow);
+  AlwaysAssertExit (timeIndex.nkeys() == nrow - nrow/10);
+  Vector<Double> st(2), end(2);
+  st[0] = 2; end[0] = 2;
+  st[1] = 5; end[1] = 6;
+  Vector<rownr_t> rows = scanIndex.rowNumbers (st, end);
+  AlwaysAssertExit (scanIndex.count(st, end) == 300);
+  AlwaysAssertExit (rows.size() == 300);
+  for (rownr_t i=0; i<100; ++i) {
+    AlwaysAssertExit (rows[i] == 200+i);
+    AlwaysAssertExit (rows[100+i] == 500+i);
+    AlwaysAssertExit (rows[200+i] == 600+i);
+  }
+  Vector<Double> st1(1, 10.5), end1(1, 20.5);
+  rows = timeIndex.rowNumbers (st1, end1);
+  cout << "rows with time in [10.5,20.5]: " << rows << endl;
+  Bool failed = False;
+  try {
+    ColumnIndexFile flagIndex(tab, "FLAG");
+  } catch (const TableError&) {
+    failed = True;
+  }
+  AlwaysAssertExit (failed);
+}
+
+void testSelect()
+{
+  Table tab(tabName);
+  TableExprNode scan = tab.col("SCAN");
+  TableExprNode time = tab.col("TIME");
+  TableExprNode flag = tab.col("FLAG");
+  // Adding 0 makes it an expression for which no index can be used.
+  checkSelect (tab, scan == 3, scan+0 == 3);
+  checkSelect (tab, 3 == scan, 3 == scan+0);
+  checkSelect (tab, scan > 7, scan+0 > 7);
+  checkSelect (tab, scan <= 1, scan+0 <= 1);
+  checkSelect (tab, scan == 4 && flag, scan+0 == 4 && flag);
+  checkSelect (tab, scan == 4 || scan == 8, scan+0 == 4 || scan+0 == 8);
+  checkSelect (tab, scan == 4 || flag, scan+0 == 4 || flag);
+  checkSelect (tab, !(scan == 4), !(scan+0 == 4));
+  checkSelect (tab, time >= 100. && time < 120., time+0 >= 100. && time+0 < 120.);
+  checkSelect (tab, time > 10. && scan == 0, time+0 > 10. && scan+0 == 0);
+  checkSelect (tab, time == 333., time+0 == 333.);
+  checkSelect (tab, scan == 3 && scan == 5, scan+0 == 3 && scan+0 == 5);
+  cout << endl;
+  checkTaql ("SCAN == 2");
+  checkTaql ("SCAN BETWEEN 2 AND 4");
+  checkTaql ("SCAN IN [1,5,9,11]");
+  checkTaql ("SCAN IN [3:5]");
+  checkTaql ("SCAN IN [3=:=5]");
+  checkTaql ("SCAN IN [3<:<5] && FLAG");
+  checkTaql ("SCAN > 3 && TIME BETWEEN 10 AND 500");
+  checkTaql ("TIME IN [0<:<10.5]");
+  checkTaql ("TIME IN [101.,202.,303.] || SCAN == 9");
+  checkTaql ("SCAN NOT IN [0:8]");
+  checkTaql ("SCAN IN [8:3:-1]", "SCAN+0 IN [8:3:-1]");
+  checkTaql ("SCAN IN [5::-1]", "SCAN+0 IN [5::-1]");
+  checkTaql ("SCAN IN [9:1:-3]", "SCAN+0 IN [9:1:-3]");
+  checkTaql ("TIME IN [303.:101.:-101.]", "TIME+0 IN [303.:101.:-101.]");
+  // Check that the row numbers are in order and offset/limit are obeyed.
+  Table sel = tableCommand ("select from " + tabName +
+                            " where SCAN IN [7,2] limit 3 offset 150").table();
+  cout << "rows " << sel.rowNumbers() << endl;
+}
+
+void testInvalidate()
+{
+  {
+    Table tab(tabName, Table::Update);
+    // Writing FLAG (in the SSM) invalidates the TIME index, not the SCAN one.
+    // The index of TIME is still used, because TIME itself is unchanged.
+    // A selection does not flush the table, so it is still valid thereafter.
+    ScalarColumn<Bool> flagCol(tab, "FLAG");
+    flagCol.put (0, False);
+    checkSelect (tab, tab.col("TIME") > 10., tab.col("TIME")+0 > 10.);
+    cout << endl;
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "TIME"));
+    tab.flush();
+    AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "TIME"));
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+    // The index of a changed column is not used until the table is
+    // flushed, which invalidates the index.
+    ScalarColumn<Int> scanCol(tab, "SCAN");
+    scanCol.put (0, 9);
+    checkSelect (tab, tab.col("SCAN") == 9, tab.col("SCAN")+0 == 9);
+    cout << endl;
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+    tab.flush();
+    AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "SCAN"));
+    cout << "indexed columns " << ColumnIndexFile::indexedColumns(tab) << endl;
+    ColumnIndexFile::update (tab);
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "TIME"));
+    checkSelect (tab, tab.col("SCAN") == 9, tab.col("SCAN")+0 == 9);
+    cout << endl;
+    // Adding rows invalidates all indices.
+    tab.addRow (10);
+    tab.flush();
+    AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "SCAN"));
+    AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "TIME"));
+    ColumnIndexFile::update (tab);
+    AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+    checkSelect (tab, tab.col("SCAN") == 0, tab.col("SCAN")+0 == 0);
+    cout << endl;
+    ColumnIndexFile::remove (tab, "TIME");
+    cout << "indexed columns " << ColumnIndexFile::indexedColumns(tab) << endl;
+  }
+  // The index is persistent.
+  Table tab(tabName);
+  cout << "indexed columns " << ColumnIndexFile::indexedColumns(tab) << endl;
+  AlwaysAssertExit (ColumnIndexFile::isValid (tab, "SCAN"));
+  AlwaysAssertExit (! ColumnIndexFile::isValid (tab, "TIME"));
+  checkSelect (tab, tab.col("TIME") > 10., tab.col("TIME")+0 > 10.);
+  cout << endl;
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testCreate();
+    testLookup();
+    testSelect();
+    testInvalidate();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
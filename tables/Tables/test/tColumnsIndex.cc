@@ -29,6 +29,8 @@
 #include <casacore/tables/Tables/ScaColDesc.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
 #include <casacore/tables/Tables/ColumnsIndex.h>
+#include <casacore/tables/Tables/TableError.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
 #include <casacore/casa/Containers/Record.h>
@@ -323,6 +325,134 @@ void d()
     cout << "<<<" << endl;
 }
 
+// Test a hash index.
+void e()
+{
+    Table tab("tColumnsIndex_tmp.data", Table::Update);
+    Int nrrow = tab.nrow();
+    ScalarColumn<Int>    cint(tab, "aint");
+    ScalarColumn<Bool>   cbool(tab, "abool");
+    ScalarColumn<uInt>   cuint(tab, "auint");
+    ScalarColumn<String> cstring(tab, "astring");
+    Int i;
+    for (i=0; i<nrrow; i++) {
+        cint.put (i, -i);
+        cbool.put (i, i%2 == 0);
+        cuint.put (i, 1+2*(i/3));
+        cstring.put (i, "V" + String::toString(i));
+    }
+    ColumnsIndex colInx3 (tab, "aint", ColumnsIndex::Hash);
+    ColumnsIndex colInx5 (tab, stringToVector("abool,auint"),
+                          ColumnsIndex::Hash);
+    ColumnsIndex colInx9 (tab, "astring", ColumnsIndex::Hash);
+    AlwaysAssertExit (colInx3.indexType() == ColumnsIndex::Hash);
+    AlwaysAssertExit (colInx3.isUnique());
+    AlwaysAssertExit (! colInx5.isUnique());
+    AlwaysAssertExit (colInx9.isUnique());
+    RecordFieldPtr<Int> aint (colInx3.accessKey(), "aint");
+    RecordFieldPtr<Bool> abool5 (colInx5.accessKey(), "abool");
+    RecordFieldPtr<uInt> auint5 (colInx5.accessKey(), "auint");
+    Bool found;
+    for (i=0; i<nrrow; i++) {
+        *aint = -i;
+        AlwaysAssertExit (Int(colInx3.getRowNumber(found)) == i  &&  found);
+        *aint = i+1;
+        colInx3.getRowNumber (found);
+        AlwaysAssertExit (!found);
+        Record rec;
+        rec.define ("astring", "V" + String::toString(i));
+        AlwaysAssertExit (Int(colInx9.getRowNumber(found, rec)) == i  &&
+                          found);
+    }
+    // The same rows as found by the sorted index must be found.
+    for (i=0; i<4; i++) {
+        *auint5 = 1+2*i;
+	*abool5 = True;
+	cout << colInx5.getRowNumbers() << ' ';
+	*abool5 = False;
+	cout << colInx5.getRowNumbers() << endl;
+    }
+    // A key range cannot be used.
+    try {
+        colInx5.getRowNumbers (True, True);
+        AlwaysAssertExit (False);
+    } catch (const TableError& x) {
+        cout << x.what() << endl;
+    }
+    // Floating point columns cannot be used.
+    try {
+        ColumnsIndex colInx (tab, "adouble", ColumnsIndex::Hash);
+        AlwaysAssertExit (False);
+    } catch (const TableError& x) {
+        cout << x.what() << endl;
+    }
+    // Add rows; the new rows must be added to the index.
+    for (Int j=0; j<3; ++j) {
+        tab.addRow (5);
+        for (i=nrrow; i<nrrow+5; i++) {
+            cint.put (i, -i);
+            cbool.put (i, True);
+            cuint.put (i, 3);
+            cstring.put (i, "V" + String::toString(i));
+        }
+        nrrow += 5;
+        *aint = -(nrrow-1);
+        AlwaysAssertExit (Int(colInx3.getRowNumber(found)) == nrrow-1  &&
+                          found);
+        *auint5 = 3;
+        *abool5 = True;
+        cout << colInx5.getRowNumbers() << endl;
+    }
+    // Changed data need to be reread.
+    cint.put (2, 1000);
+    colInx3.setChanged ("aint");
+    *aint = 1000;
+    AlwaysAssertExit (colInx3.getRowNumber(found) == 2  &&  found);
+    *aint = -2;
+    colInx3.getRowNumber(found);
+    AlwaysAssertExit (!found);
+    cint.put (2, -2);
+    colInx3.setChanged();
+    // A copy is also a hash index.
+    ColumnsIndex colInxc (colInx5);
+    AlwaysAssertExit (colInxc.indexType() == ColumnsIndex::Hash);
+    Record rec;
+    rec.define ("abool", True);
+    rec.define ("auint", uInt(3));
+    AlwaysAssertExit (allEQ (colInxc.getRowNumbers(rec),
+                             colInx5.getRowNumbers(rec)));
+    // Removing rows recreates the index.
+    tab.removeRow (nrrow-1);
+    nrrow--;
+    cout << colInx5.getRowNumbers(rec) << endl;
+    // Compare the lookup speed of a sorted and hash index.
+    if (nrrow < 1000) {
+        tab.addRow (1000-nrrow);
+	nrrow = 1000;
+    }
+    for (i=0; i<nrrow; i++) {
+	cint.put (i, -i);
+    }
+    ColumnsIndex colInxs (tab, "aint");
+    RecordFieldPtr<Int> aints (colInxs.accessKey(), "aint");
+    cout << ">>>" << endl;
+    Timer timer;
+    for (i=0; i<100*nrrow; i++) {
+        *aints = -(i/100);
+        AlwaysAssertExit (Int(colInxs.getRowNumber(found)) == i/100  &&
+                          found);
+    }
+    timer.show ("100000*find sorted");
+    timer.mark();
+    for (i=0; i<100*nrrow; i++) {
+        *aint = -(i/100);
+        AlwaysAssertExit (Int(colInx3.getRowNumber(found)) == i/100  &&
+                          found);
+    }
+    timer.show ("100000*find hash  ");
+    cout << "<<<" << endl;
+}
+
 int main()
 {
     try {
@@ -330,6 +460,7 @@ int main()
 	b();
 	c();
 	d();
+	e();
     } catch (std::exception& x) {
         cout << "Exception caught: " << x.what() << endl;
 	return 1;
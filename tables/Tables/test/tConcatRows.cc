@@ -71,6 +71,33 @@ void doIt()
   }
   AlwaysAssertExit (!ok);
 
+  // Check if finding the table by binary search is fine,
+  // also if empty tables are used.
+  {
+    ConcatRows rows2;
+    rows2.add (3);
+    rows2.add (0);
+    rows2.add (0);
+    rows2.add (4);
+    rows2.add (0);
+    for (uInt i=0; i<3; ++i) {
+      AlwaysAssertExit (rows2.tableNr(i) == 0);
+    }
+    for (uInt i=3; i<7; ++i) {
+      AlwaysAssertExit (rows2.tableNr(i) == 3);
+    }
+    for (uInt i=0; i<rows.nrow(); ++i) {
+      AlwaysAssertExit (rows.tableNr(i) == (i<10 ? 0u : 1u));
+    }
+    ok = True;
+    try {
+      rows2.tableNr (7);
+    } catch (std::exception& x) {
+      ok = False;
+    }
+    AlwaysAssertExit (!ok);
+  }
+
   // Check if iteration is fine.
   {
     // Check for an empty object.
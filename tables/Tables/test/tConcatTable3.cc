@@ -28,10 +28,14 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ScaColDesc.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/tables/Tables/ArrColDesc.h>
+#include <casacore/tables/Tables/ArrayColumn.h>
 #include <casacore/tables/Tables/TableRecord.h>
 #include <casacore/tables/TaQL/ExprNode.h>
 #include <casacore/casa/IO/ArrayIO.h>
 #include <casacore/casa/Arrays/ArrayUtil.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Arrays/Slicer.h>
 #include <casacore/casa/Containers/Block.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
@@ -51,15 +55,19 @@ void createTable(const String& name, Int stval, Int nrrow)
   TableDesc td;
   td.addColumn (ScalarColumnDesc<Int>("aint"));
   td.addColumn (ScalarColumnDesc<Float>("afloat"));
+  td.addColumn (ArrayColumnDesc<Int>("aarr", IPosition(1,2),
+                                     ColumnDesc::FixedShape));
   // Now create a new table from the description.
   SetupNewTable newtab(name, td, Table::New);
   Table tab(newtab, nrrow);
   // Fill the table.
   ScalarColumn<Int>   icol(tab, "aint");
   ScalarColumn<Float> fcol(tab, "afloat");
+  ArrayColumn<Int>    acol(tab, "aarr");
   for (Int i=0; i<nrrow; ++i) {
     icol.put (i, i+stval);
     fcol.put (i, i+stval+1.);
+    acol.put (i, Vector<Int>({i+stval, -(i+stval)}));
   }
 }
 
@@ -96,6 +104,69 @@ void concatTables()
   concTab.rename ("tConcatTable3_tmp.conctab", Table::New);
 }
 
+// Check the values of the given rows read in bulk.
+void checkValues (const Vector<Int>& ivals, const Array<Int>& avals,
+                  const Vector<rownr_t>& rows)
+{
+  AlwaysAssertExit (ivals.size() == rows.size());
+  AlwaysAssertExit (avals.shape() == IPosition(2, 2, rows.size()));
+  for (uInt i=0; i<rows.size(); ++i) {
+    AlwaysAssertExit (ivals[i] == Int(rows[i]));
+    AlwaysAssertExit (avals(IPosition(2,0,i)) == Int(rows[i])  &&
+                      avals(IPosition(2,1,i)) == -Int(rows[i]));
+  }
+}
+
+// Check the bulk access of a column range and cells which are split over
+// the tables (in parallel if possible).
+void checkBulk()
+{
+  createTable ("tConcatTable3_tmp.bulk1", 0, 10);
+  createTable ("tConcatTable3_tmp.bulk2", 10, 0);
+  createTable ("tConcatTable3_tmp.bulk3", 10, 20);
+  createTable ("tConcatTable3_tmp.bulk4", 30, 5);
+  Block<Table> tabs(4);
+  for (uInt i=0; i<tabs.size(); ++i) {
+    tabs[i] = Table("tConcatTable3_tmp.bulk" + String::toString(i+1),
+                    Table::Update);
+  }
+  Table tab(tabs);
+  ScalarColumn<Int> aint(tab, "aint");
+  ArrayColumn<Int> aarr(tab, "aarr");
+  Vector<rownr_t> rows(35);
+  indgen (rows);
+  checkValues (aint.getColumn(), aarr.getColumn(), rows);
+  // A strided range crossing the table boundaries.
+  Slicer range(IPosition(1,5), IPosition(1,28), IPosition(1,3),
+               Slicer::endIsLast);
+  rows.resize (8);
+  indgen (rows, rownr_t(5), rownr_t(3));
+  checkValues (aint.getColumnRange(range), aarr.getColumnRange(range), rows);
+  // Rows not in table order.
+  rows = Vector<rownr_t>({33, 2, 15, 3, 29, 0, 34, 10, 11, 1});
+  checkValues (aint.getColumnCells(rows), aarr.getColumnCells(rows), rows);
+  // Put unordered rows and check if they are written correctly.
+  Vector<Int> ivals = aint.getColumnCells(rows);
+  aint.putColumnCells (rows, -ivals);
+  Vector<Int> all = aint.getColumn();
+  for (uInt i=0; i<all.size(); ++i) {
+    Bool changed = anyEQ (rows, rownr_t(i));
+    AlwaysAssertExit (all[i] == (changed  ?  -Int(i) : Int(i)));
+  }
+  aint.putColumnCells (rows, ivals);
+  // Concatenating the same table twice cannot be done in parallel.
+  Block<Table> tabs2(2);
+  tabs2[0] = tabs[2];
+  tabs2[1] = tabs[2];
+  Table tab2(tabs2);
+  ScalarColumn<Int> aint2(tab2, "aint");
+  Vector<Int> vals2 = aint2.getColumnRange (Slicer(IPosition(1,15),
+                                                   IPosition(1,10)));
+  for (uInt i=0; i<vals2.size(); ++i) {
+    AlwaysAssertExit (vals2[i] == Int(10 + (15+i)%20));
+  }
+}
+
 int main()
 {
   try {
@@ -104,6 +175,7 @@ int main()
     createTable ("tConcatTable3_tmp.tab3", 30, 5);
     concatTables();
     checkTable (0, 35);
+    checkBulk();
   } catch (std::exception& x) {
     cout << "Exception caught: " << x.what() << endl;
     return 1;
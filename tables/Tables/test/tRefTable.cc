@@ -28,6 +28,7 @@
 #include <casacore/tables/Tables/Table.h>
 #include <casacore/tables/Tables/ScaColDesc.h>
 #include <casacore/tables/Tables/ScalarColumn.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
 #include <casacore/casa/Utilities/Assert.h>
 #include <casacore/casa/Exceptions/Error.h>
 #include <casacore/casa/iostream.h>
@@ -106,6 +107,38 @@ void makeRef()
   readTab ("tRefTable_tmp.dataref", 10, 4);
 }
 
+// Get and put an entire column of selections with and without runs
+// of row numbers (which are collapsed to slices), also after the
+// selection has changed.
+void testRefRows()
+{
+  Table tab("tRefTable_tmp.data", Table::Update);
+  Table sel = tab(Vector<rownr_t>({0,1,2,3,6,7,8}));
+  ScalarColumn<Int> ab(sel, "ab");
+  AlwaysAssertExit (allEQ (ab.getColumn(), Vector<Int>({0,1,2,3,6,7,8})));
+  ab.putColumn (Vector<Int>({0,1,2,3,6,7,8}) + 100);
+  AlwaysAssertExit (ScalarColumn<Int>(tab, "ab")(6) == 106);
+  ab.putColumn (Vector<Int>({0,1,2,3,6,7,8}));
+  sel.removeRow (2);
+  AlwaysAssertExit (allEQ (ab.getColumn(), Vector<Int>({0,1,3,6,7,8})));
+  Table sel2 = tab(Vector<rownr_t>({1,5,2,9}));
+  AlwaysAssertExit (allEQ (ScalarColumn<Int>(sel2, "ab").getColumn(),
+                           Vector<Int>({1,5,2,9})));
+  // A descending run and a duplicate row after an ascending pair
+  // must not be collapsed to a slice (the other rows still are).
+  Table sel3 = tab(Vector<rownr_t>({0,5,4,3,4,5,6,7,8,9}));
+  ScalarColumn<Int> ab3(sel3, "ab");
+  AlwaysAssertExit (allEQ (ab3.getColumn(),
+                           Vector<Int>({0,5,4,3,4,5,6,7,8,9})));
+  ab3.putColumn (Vector<Int>({100,105,104,103,104,105,106,107,108,109}));
+  AlwaysAssertExit (allEQ (ScalarColumn<Int>(tab, "ab").getColumn(),
+                           Vector<Int>({100,1,2,103,104,105,106,107,108,109})));
+  ab3.putColumn (Vector<Int>({0,5,4,3,4,5,6,7,8,9}));
+  Table sel4 = tab(Vector<rownr_t>({0,2,2,2,3,4,5,6,7,8,9}));
+  AlwaysAssertExit (allEQ (ScalarColumn<Int>(sel4, "ab").getColumn(),
+                           Vector<Int>({0,2,2,2,3,4,5,6,7,8,9})));
+}
+
 int main()
 {
   try {
@@ -113,6 +146,7 @@ int main()
     makeRef();
     readTab ("tRefTable_tmp.data", 10, 5);
     readTab ("tRefTable_tmp.dataref", 10, 4);
+    testRefRows();
   } catch (std::exception& x) {
     cout << "Caught an exception: " << x.what() << endl;
     return 1;
@@ -0,0 +1,211 @@
+//# tTableCopyEngine.cc: Test program for copying table rows in chunks
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/Tables/TableCopyEngine.h>
+#include <casacore/casa/Arrays/ArrayMath.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for class TableCopyEngine, also used by TableCopy::copyRows.
+// </summary>
+
+const rownr_t nrow = 500;
+
+Int intValue (rownr_t row)
+  { return 3*row - 100; }
+String stringValue (rownr_t row)
+  { return "str" + String::toString(row); }
+Double timeValue (rownr_t row)
+  { return 1e9 + row/10; }
+// Variable shaped arrays; every 7th cell is undefined.
+Bool varDefined (rownr_t row)
+  { return row%7 != 3; }
+Vector<Int> varValue (rownr_t row)
+{
+  Vector<Int> vec(row%3 + 1);
+  indgen (vec, Int(row));
+  return vec;
+}
+
+// Make a table with columns in different storage managers.
+// The output table stores INT as an Int64 column.
+Table makeTable (const String& name, rownr_t nr, Bool output,
+                 const TableLock& lockOptions = TableLock())
+{
+  TableDesc td;
+  if (output) {
+    td.addColumn (ScalarColumnDesc<Int64>  ("INT"));
+  } else {
+    td.addColumn (ScalarColumnDesc<Int>    ("INT"));
+  }
+  td.addColumn (ScalarColumnDesc<String>   ("STRING"));
+  td.addColumn (ScalarColumnDesc<Double>   ("TIME"));
+  td.addColumn (ArrayColumnDesc<Complex>   ("DATA", IPosition(2,2,8),
+                                            ColumnDesc::FixedShape));
+  td.addColumn (ArrayColumnDesc<Int>       ("VAR"));
+  td.addColumn (ScalarRecordColumnDesc     ("REC"));
+  SetupNewTable newtab(name, td, Table::New);
+  StandardStMan ssm("SSM", 4096);
+  IncrementalStMan ism("ISM");
+  TiledShapeStMan tsm("TSM", IPosition(3,2,8,16));
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("TIME", ism);
+  newtab.bindColumn ("DATA", tsm);
+  return Table(newtab, lockOptions, nr);
+}
+
+void fillTable (Table& tab)
+{
+  ScalarColumn<Int>       intCol  (tab, "INT");
+  ScalarColumn<String>    strCol  (tab, "STRING");
+  ScalarColumn<Double>    timeCol (tab, "TIME");
+  ArrayColumn<Complex>    dataCol (tab, "DATA");
+  ArrayColumn<Int>        varCol  (tab, "VAR");
+  ScalarColumn<TableRecord> recCol (tab, "REC");
+  Matrix<Complex> data(2,8);
+  for (rownr_t row=0; row<tab.nrow(); ++row) {
+    intCol.put  (row, intValue(row));
+    strCol.put  (row, stringValue(row));
+    timeCol.put (row, timeValue(row));
+    indgen (data, Complex(row, 1));
+    dataCol.put (row, data);
+    if (varDefined(row)) {
+      varCol.put (row, varValue(row));
+    }
+    TableRecord rec;
+    rec.define ("row", Int(row));
+    recCol.put (row, rec);
+  }
+}
+
+// Check that the output rows contain the input rows starting at startin.
+void checkTable (const Table& tab, rownr_t startout, rownr_t startin,
+                 rownr_t nr)
+{
+  ScalarColumn<Int64>     intCol  (tab, "INT");
+  ScalarColumn<String>    strCol  (tab, "STRING");
+  ScalarColumn<Double>    timeCol (tab, "TIME");
+  ArrayColumn<Complex>    dataCol (tab, "DATA");
+  ArrayColumn<Int>        varCol  (tab, "VAR");
+  ScalarColumn<TableRecord> recCol (tab, "REC");
+  Matrix<Complex> data(2,8);
+  for (rownr_t i=0; i<nr; ++i) {
+    rownr_t row = startout+i;
+    rownr_t inrow = startin+i;
+    AlwaysAssertExit (intCol(row)  == intValue(inrow));
+    AlwaysAssertExit (strCol(row)  == stringValue(inrow));
+    AlwaysAssertExit (timeCol(row) == timeValue(inrow));
+    indgen (data, Complex(inrow, 1));
+    AlwaysAssertExit (allEQ (dataCol(row), data));
+    AlwaysAssertExit (varCol.isDefined(row) == varDefined(inrow));
+    if (varDefined(inrow)) {
+      AlwaysAssertExit (allEQ (varCol(row), varValue(inrow)));
+    }
+    AlwaysAssertExit (recCol(row).asInt("row") == Int(inrow));
+  }
+}
+
+void testEngine (Table& in, uInt nthreads, uInt64 chunkSize,
+                 const TableLock& lockOptions)
+{
+  Table out = makeTable ("tTableCopyEngine_tmp.out", nrow+150, True,
+                         lockOptions);
+  TableCopyEngine engine(out, in, in.tableDesc().columnNames());
+  engine.setNThreads (nthreads);
+  engine.setChunkSize (chunkSize);
+  engine.setQueueSize (3);
+  engine.copy (0, 0, nrow);
+  cout << "nthreads=" << nthreads << " chunksize=" << chunkSize
+       << " bulk=" << engine.bulkColumns()
+       << " rowwise=" << engine.rowColumns()
+       << " pipelined=" << engine.isPipelined()
+       << " chunked=" << (engine.chunkRows() < nrow) << endl;
+  checkTable (out, 0, 0, nrow);
+  // Copy a part of the rows to the end.
+  engine.copy (nrow, 250, 150);
+  checkTable (out, 0, 0, nrow);
+  checkTable (out, nrow, 250, 150);
+}
+
+void testCopyRows (const Table& in)
+{
+  // Rows are added as needed.
+  Table out = makeTable ("tTableCopyEngine_tmp.out", 0, True);
+  TableCopy::copyRows (out, in, 10, 20, 300);
+  AlwaysAssertExit (out.nrow() == 310);
+  checkTable (out, 10, 20, 300);
+  // Copy within the same table; the ranges overlap.
+  TableCopy::copyRows (out, out, 12, 10, 5);
+  checkTable (out, 10, 20, 2);
+  checkTable (out, 12, 20, 2);
+  checkTable (out, 14, 20, 2);
+  checkTable (out, 16, 20, 1);
+  cout << "copyRows done" << endl;
+}
+
+void testDeepCopy (const Table& in)
+{
+  // Deep copy a selection.
+  Table sel = in(in.col("TIME") >= timeValue(100));
+  sel.deepCopy ("tTableCopyEngine_tmp.deep", Table::New);
+  Table out("tTableCopyEngine_tmp.deep");
+  AlwaysAssertExit (out.nrow() == nrow-100);
+  // Note that INT is an Int column here.
+  ScalarColumn<Int> intCol(out, "INT");
+  ArrayColumn<Int>  varCol(out, "VAR");
+  for (rownr_t row=0; row<out.nrow(); ++row) {
+    AlwaysAssertExit (intCol(row) == intValue(row+100));
+    AlwaysAssertExit (varCol.isDefined(row) == varDefined(row+100));
+  }
+  cout << "deepCopy done" << endl;
+}
+
+int main()
+{
+  try {
+    Table in = makeTable ("tTableCopyEngine_tmp.in", nrow, False);
+    fillTable (in);
+    // Serial copy in a single chunk.
+    testEngine (in, 1, 16*1024*1024, TableLock());
+    // Serial copy in small chunks.
+    testEngine (in, 1, 2000, TableLock());
+    // Pipelined copy.
+    testEngine (in, 2, 2000, TableLock());
+    // Pipelined copy with parallel storage managers.
+    testEngine (in, 4, 1000, TableLock(TableLock::PermanentLocking));
+    testCopyRows (in);
+    testDeepCopy (in);
+  } catch (const std::exception& x) {
+    cout << "Caught an exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}
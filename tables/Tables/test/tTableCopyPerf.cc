@@ -24,6 +24,7 @@
 //#                        Charlottesville, VA 22903-2475 USA
 
 #include <casacore/tables/Tables.h>
+#include <casacore/tables/Tables/TableCopyEngine.h>
 #include <casacore/casa/OS/Timer.h>
 #include <stdexcept>
 #include <iostream>
@@ -65,6 +66,31 @@ void testPerf (Int nrowPerf)
   timer.show ("copytaql");
 }
 
+void testCopyRows (Int nrowPerf)
+{
+  cout << "testCopyRows with " << nrowPerf << " rows ..." << endl;
+  Table tab("tTableCopyPerf_tmp.data");
+  Vector<String> columns(2);
+  columns[0] = "DATA";
+  columns[1] = "SCALAR";
+  // Copy serially and pipelined.
+  for (uInt nthreads=1; nthreads<=2; ++nthreads) {
+    Table out = TableCopy::makeEmptyTable ("tTableCopyPerf_tmp.copy",
+                                           Record(), tab, Table::New,
+                                           Table::AipsrcEndian);
+    Timer timer;
+    TableCopyEngine engine(out, tab, columns);
+    engine.setNThreads (nthreads);
+    engine.copy (0, 0, tab.nrow());
+    out.flush();
+    double sec = timer.real();
+    timer.show (nthreads == 1  ?  "copyrows serial   " : "copyrows pipelined");
+    if (sec > 0) {
+      cout << "  " << engine.nbytes() / sec / (1024*1024) << " MB/s" << endl;
+    }
+  }
+}
+
 int main (int argc, const char* argv[])
 {
   Int nrowPerf = 10;
@@ -73,6 +99,7 @@ int main (int argc, const char* argv[])
   }
   try {
     testPerf (nrowPerf);
+    testCopyRows (nrowPerf);
   } catch (const exception& x) {
     cout << x.what() << endl;
     return 1;
@@ -55,6 +55,7 @@ void doiter1();
 void doiter2();
 void doiter3();
 void test_cache_boundaries();
+void test_sort_if_needed();
 
 int main (int argc, const char* argv[])
 {
@@ -70,6 +71,7 @@ int main (int argc, const char* argv[])
     doiter2();               // do two column iteration
     doiter3();               // do interval iteration
     test_cache_boundaries(); // test option to cache group boundaries
+    test_sort_if_needed();   // test option to sort only if out of order
     return 0;                // successfully executed
 }
 
@@ -332,3 +334,54 @@ void test_cache_boundaries()
         iter2.next();
     }
 }
+
+// Iterate and return the number of steps. Check that each row is
+// returned once.
+Int countIter (TableIterator& iter, const Table& tab)
+{
+    Vector<Bool> done(tab.nrow(), False);
+    Int nr = 0;
+    while (!iter.pastEnd()) {
+        Vector<rownr_t> rows = iter.table().rowNumbers(tab);
+        for (rownr_t row : rows) {
+            AlwaysAssertExit (!done[row]);
+            done[row] = True;
+        }
+        nr++;
+        iter.next();
+    }
+    AlwaysAssertExit (allTrue(done));
+    return nr;
+}
+
+void test_sort_if_needed()
+{
+    Table tab1 ("tTableIter_tmp.data");
+    Block<String> iv1(1, "col1");
+    // A table in order gives the same groups as a sorted iteration.
+    Table sortab = tab1.sort ("col1", Sort::Descending);
+    TableIterator iter1(sortab, iv1, TableIterator::Descending,
+                        TableIterator::SortIfNeeded);
+    TableIterator iter2(tab1, iv1, TableIterator::Descending);
+    while (!iter1.pastEnd()) {
+        AlwaysAssertExit (allEQ (iter1.table().rowNumbers(tab1),
+                                 iter2.table().rowNumbers(tab1)));
+        iter1.next();
+        iter2.next();
+    }
+    AlwaysAssertExit (iter2.pastEnd());
+    AlwaysAssertExit (! iter1.sortedWhileIterating());
+    // col1 is 0..9 repeated, thus the remaining rows get sorted after the
+    // first 10 steps.
+    TableIterator iter3(tab1, iv1, TableIterator::Ascending,
+                        TableIterator::SortIfNeeded);
+    AlwaysAssertExit (iter3.table().nrow() == 1);
+    AlwaysAssertExit (! iter3.sortedWhileIterating());
+    cout << "   #iterSortIfNeeded=" << countIter (iter3, tab1);
+    AlwaysAssertExit (iter3.sortedWhileIterating());
+    // After a reset or copy the entire table is sorted.
+    TableIterator iter4(iter3);
+    iter3.reset();
+    cout << ' ' << countIter (iter3, tab1) << ' ' << countIter (iter4, tab1)
+         << endl;
+}
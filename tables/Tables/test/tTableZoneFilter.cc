@@ -0,0 +1,212 @@
+//# tTableZoneFilter.cc: Test program for selections using zone statistics
+//# Copyright (C) 2026
+//# Associated Universities, Inc. Washington DC, USA.
+//#
+//# This program is free software; you can redistribute it and/or modify it
+//# under the terms of the GNU General Public License as published by the Free
+//# Software Foundation; either version 2 of the License, or (at your option)
+//# any later version.
+//#
+//# This program is distributed in the hope that it will be useful, but WITHOUT
+//# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//# FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+//# more details.
+//#
+//# You should have received a copy of the GNU General Public License along
+//# with this program; if not, write to the Free Software Foundation, Inc.,
+//# 675 Massachusetts Ave, Cambridge, MA 02139, USA.
+//#
+//# Correspondence concerning AIPS++ should be addressed as follows:
+//#        Internet email: casa-feedback@nrao.edu.
+//#        Postal address: AIPS++ Project Office
+//#                        National Radio Astronomy Observatory
+//#                        520 Edgemont Road
+//#                        Charlottesville, VA 22903-2475 USA
+
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan/SSMBase.h>
+#include <casacore/tables/DataMan/SSMColumn.h>
+#include <casacore/tables/DataMan/ISMBase.h>
+#include <casacore/tables/DataMan/ISMColumn.h>
+#include <casacore/tables/TaQL/TableParse.h>
+#include <casacore/casa/Arrays/ArrayLogical.h>
+#include <casacore/casa/Utilities/Assert.h>
+#include <stdexcept>
+#include <iostream>
+#include <cmath>
+using namespace casacore;
+using namespace std;
+
+// <summary>
+// Test program for the min/max zone statistics of the SSM and ISM
+// and their use in table selection.
+// </summary>
+
+const rownr_t nrow = 1000;
+const String tabName("tTableZoneFilter_tmp.tab");
+
+// TIME, VAL and FLAG are stored in the SSM with 100 rows per bucket,
+// SCAN and ANT in the ISM.
+void makeTable()
+{
+  TableDesc td;
+  td.addColumn (ScalarColumnDesc<Double> ("TIME"));
+  td.addColumn (ScalarColumnDesc<Float>  ("VAL"));
+  td.addColumn (ScalarColumnDesc<Bool>   ("FLAG"));
+  td.addColumn (ScalarColumnDesc<Int>    ("SCAN"));
+  td.addColumn (ScalarColumnDesc<Int>    ("ANT"));
+  SetupNewTable newtab(tabName, td, Table::New);
+  StandardStMan ssm("SSM", -100);
+  IncrementalStMan ism("ISM", 512);
+  newtab.bindAll (ssm);
+  newtab.bindColumn ("SCAN", ism);
+  newtab.bindColumn ("ANT", ism);
+  Table tab(newtab, nrow);
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  ScalarColumn<Float>  valCol(tab, "VAL");
+  ScalarColumn<Bool>   flagCol(tab, "FLAG");
+  ScalarColumn<Int>    scanCol(tab, "SCAN");
+  ScalarColumn<Int>    antCol(tab, "ANT");
+  for (rownr_t i=0; i<nrow; ++i) {
+    timeCol.put (i, 1000. + i);
+    // The values in rows 300-399 are all NaN; others every 7th row.
+    valCol.put (i, ((i>=300 && i<400) || i%7 == 0  ?  NAN : Float(i%200)));
+    flagCol.put (i, i%3 == 0);
+    scanCol.put (i, i/150);
+    antCol.put (i, i%5);
+  }
+}
+
+void showZone (DataManagerColumn& col, rownr_t rownr)
+{
+  rownr_t st, end;
+  Double minVal, maxVal;
+  if (col.getZoneMinMax (rownr, st, end, minVal, maxVal)) {
+    cout << "zone " << st << '-' << end << ": ";
+    if (minVal > maxVal) {
+      cout << "no values" << endl;
+    } else {
+      cout << minVal << " to " << maxVal << endl;
+    }
+  } else {
+    cout << "no zone statistics" << endl;
+  }
+}
+
+void testZones()
+{
+  Table tab(tabName);
+  SSMBase* ssm = dynamic_cast<SSMBase*>(tab.findDataManager ("SSM"));
+  ISMBase* ism = dynamic_cast<ISMBase*>(tab.findDataManager ("ISM"));
+  AlwaysAssertExit (ssm != 0  &&  ism != 0);
+  showZone (ssm->getColumn(0), 250);      // TIME
+  showZone (ssm->getColumn(0), 999);
+  showZone (ssm->getColumn(1), 150);      // VAL
+  showZone (ssm->getColumn(1), 350);
+  showZone (ssm->getColumn(2), 0);        // FLAG
+  showZone (ism->getColumn(0), 500);      // SCAN
+  // ANT changes every row, so it uses multiple ISM buckets.
+  rownr_t st, end;
+  Double minVal, maxVal;
+  AlwaysAssertExit (ism->getColumn(1).getZoneMinMax (0, st, end,
+                                                     minVal, maxVal));
+  AlwaysAssertExit (st == 0  &&  end < nrow-1);
+  AlwaysAssertExit (minVal == 0  &&  maxVal == 4);
+}
+
+// Check if the selection using zones matches the selection
+// using an expression for which no column ranges can be found.
+void checkSelect (const Table& tab, const TableExprNode& node,
+                  const TableExprNode& nodeNoRange)
+{
+  Table sel1 = tab(node);
+  Table sel2 = tab(nodeNoRange);
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(), sel2.rowNumbers()));
+  cout << sel1.nrow() << ' ';
+}
+
+void checkTaql (const String& where)
+{
+  Table sel = tableCommand ("select from " + tabName + " where " +
+                            where).table();
+  cout << sel.nrow() << " rows for " << where << endl;
+}
+
+// Check if a TaQL selection using zones gives the same rows as the
+// selection using an expression for which no column ranges can be found.
+void checkTaql (const String& where, const String& whereNoRange)
+{
+  Table sel1 = tableCommand ("select from " + tabName + " where " +
+                             where).table();
+  Table sel2 = tableCommand ("select from " + tabName + " where " +
+                             whereNoRange).table();
+  AlwaysAssertExit (allEQ (sel1.rowNumbers(), sel2.rowNumbers()));
+  cout << sel1.nrow() << " rows for " << where << endl;
+}
+
+void testSelect()
+{
+  Table tab(tabName);
+  TableExprNode time = tab.col("TIME");
+  TableExprNode val  = tab.col("VAL");
+  TableExprNode flag = tab.col("FLAG");
+  TableExprNode scan = tab.col("SCAN");
+  // Adding 0 makes it an expression for which no ranges are found.
+  checkSelect (tab, time >= 1250. && time < 1420., time+0 >= 1250. && time+0 < 1420.);
+  checkSelect (tab, time > 1995., time+0 > 1995.);
+  checkSelect (tab, time < 1000., time+0 < 1000.);
+  checkSelect (tab, time == 1555. || time == 1777., time+0 == 1555. || time+0 == 1777.);
+  checkSelect (tab, time > 1500. && flag, time+0 > 1500. && flag);
+  checkSelect (tab, time > 1500. || flag, time+0 > 1500. || flag);
+  checkSelect (tab, !(time < 1500.), !(time+0 < 1500.));
+  checkSelect (tab, val > 150., val+0 > 150.);
+  checkSelect (tab, val < 5.f && time < 1600., val+0 < 5.f && time+0 < 1600.);
+  checkSelect (tab, scan == 3 && time > 1480., scan+0 == 3 && time+0 > 1480.);
+  checkSelect (tab, scan == 30, scan+0 == 30);
+  cout << endl;
+  checkTaql ("TIME BETWEEN 1100 AND 1130");
+  checkTaql ("TIME IN [1010, 1500, 1990]");
+  checkTaql ("TIME > 1900 && SCAN == 6");
+  checkTaql ("TIME IN [1990.:1980.:-5.]", "TIME+0 IN [1990.:1980.:-5.]");
+  checkTaql ("TIME IN [1010.::-1.]", "TIME+0 IN [1010.::-1.]");
+  checkTaql ("SCAN IN [6:4:-1]", "SCAN+0 IN [6:4:-1]");
+  // Check that offset and limit are obeyed.
+  Table sel = tableCommand ("select from " + tabName +
+                            " where TIME > 1700 limit 3 offset 150").table();
+  cout << "rows " << sel.rowNumbers() << endl;
+}
+
+void testUpdate()
+{
+  Table tab(tabName, Table::Update);
+  SSMBase* ssm = dynamic_cast<SSMBase*>(tab.findDataManager ("SSM"));
+  AlwaysAssertExit (ssm != 0);
+  showZone (ssm->getColumn(0), 250);
+  // Changing a value updates the statistics.
+  ScalarColumn<Double> timeCol(tab, "TIME");
+  timeCol.put (250, 5000.);
+  showZone (ssm->getColumn(0), 250);
+  checkSelect (tab, tab.col("TIME") > 4000., tab.col("TIME")+0 > 4000.);
+  // Adding rows as well.
+  tab.addRow (10);
+  for (rownr_t i=nrow; i<nrow+10; ++i) {
+    timeCol.put (i, 6000. + i);
+  }
+  showZone (ssm->getColumn(0), nrow+5);
+  checkSelect (tab, tab.col("TIME") > 4000., tab.col("TIME")+0 > 4000.);
+  cout << endl;
+}
+
+int main()
+{
+  try {
+    makeTable();
+    testZones();
+    testSelect();
+    testUpdate();
+  } catch (const std::exception& x) {
+    cout << "Unexpected exception: " << x.what() << endl;
+    return 1;
+  }
+  return 0;
+}